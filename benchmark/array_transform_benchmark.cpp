@@ -0,0 +1,81 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Materializing permuted views of a volume. The element benchmarks copy 
+// with the view iterators, the blocked benchmarks use the mdarray 
+// constructor which copies transposed views in cache sized blocks.
+//
+#include <algorithm>
+#include <numeric>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+typedef dynamic_array<float32> array_type;
+
+//
+// results are stored here to keep the compiler from removing the copies
+//
+static float64 sink = 0;
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("size","n",
+                      "number of voxels along each dimension",256));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",5));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t n = config.value<size_t>("size");
+    size_t nruns = config.value<size_t>("nruns");
+
+    auto volume = array_type::create(shape_t{n,n,n});
+    std::iota(volume.begin(),volume.end(),0.f);
+    auto full = volume(slice(0,n),slice(0,n),slice(0,n));
+    auto buffer = array_type::create(shape_t{n,n,n});
+
+    for(auto axes: {shape_t{0,2,1},shape_t{2,0,1},shape_t{2,1,0}})
+    {
+        auto view = full.permute(axes);
+        std::string name = "permute ("+std::to_string(axes[0])+","+
+                           std::to_string(axes[1])+","+
+                           std::to_string(axes[2])+")";
+
+        run_benchmark(name+" elements",nruns,
+                      [&view,&buffer](){
+                        std::copy(view.begin(),view.end(),buffer.begin());
+                        sink += buffer[1];
+                      });
+        run_benchmark(name+" blocked",nruns,
+                      [&view](){
+                        array_type b(view);
+                        sink += b[1];
+                      });
+    }
+
+    return sink > 0 ? 0 : 1;
+}
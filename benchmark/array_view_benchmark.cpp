@@ -0,0 +1,153 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+//
+// Compares element access to contiguous and strided views and to a region 
+// of interest (half of every row) of a 3D stack.
+// The legacy benchmark computes the offsets the way array_view did before
+// the effective strides were introduced (copy of the index map and offset
+// computation via the selection for every element).
+//
+#include <algorithm>
+#include <numeric>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+typedef dynamic_array<float64> array_type;
+
+//
+// results are stored here to keep the compiler from removing the loops
+//
+static float64 sink = 0;
+
+//-----------------------------------------------------------------------------
+template<typename VTYPE> void sum_linear(const VTYPE &view)
+{
+    size_t n = view.size();
+    float64 sum = 0;
+    for(size_t i=0;i<n;++i) sum += view[i];
+    sink += sum;
+}
+
+//-----------------------------------------------------------------------------
+template<typename VTYPE> void sum_multi_index(const VTYPE &view)
+{
+    auto s = view.template shape<shape_t>();
+    float64 sum = 0;
+    for(size_t i=0;i<s[0];++i)
+        for(size_t j=0;j<s[1];++j)
+            for(size_t k=0;k<s[2];++k)
+                sum += view(i,j,k);
+    sink += sum;
+}
+
+//-----------------------------------------------------------------------------
+template<typename VTYPE> void sum_iterator(const VTYPE &view)
+{
+    sink += std::accumulate(view.begin(),view.end(),float64(0));
+}
+
+//-----------------------------------------------------------------------------
+template<typename VTYPE> void sum_runs(const VTYPE &view)
+{
+    float64 sum = 0;
+    auto iter = view.begin();
+    auto end  = view.end();
+    while(iter!=end)
+    {
+        size_t n = iter.run_length();
+        const float64 *ptr = iter.data();
+        for(size_t i=0;i<n;++i) sum += ptr[i];
+        iter += n;
+    }
+    sink += sum;
+}
+
+//-----------------------------------------------------------------------------
+void sum_legacy(const array_type &a,const array_selection &selection)
+{
+    auto view_map = map_utils<dynamic_cindex_map>::create(
+                        selection.shape<shape_t>());
+    size_t n = selection.size();
+    float64 sum = 0;
+    for(size_t i=0;i<n;++i)
+    {
+        auto index = view_map.index<shape_t>(i);
+        auto map = a.map();
+        sum += a[map.offset(selection,index)];
+    }
+    sink += sum;
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("nz","z",
+                      "number of frames in the stack",32));
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of rows per frame",512));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of columns per frame",512));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",10));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t nz = config.value<size_t>("nz");
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    auto a = array_type::create(shape_t{nz,ny,nx});
+    std::fill(a.begin(),a.end(),1.);
+
+    //all views have the same number of elements
+    auto contiguous = a(slice(0,nz/2),slice(0,ny),slice(0,nx));
+    auto strided    = a(slice(0,nz),slice(0,ny),slice(0,nx,2));
+    auto roi        = a(slice(0,nz),slice(0,ny),slice(0,nx/2));
+    array_selection selection(shape_t{nz,ny,nx/2},shape_t{0,0,0},
+                              shape_t{1,1,2});
+
+    run_benchmark("contiguous view []",nruns,
+                  [&contiguous](){ sum_linear(contiguous); });
+    run_benchmark("contiguous view ()",nruns,
+                  [&contiguous](){ sum_multi_index(contiguous); });
+    run_benchmark("contiguous view iterator",nruns,
+                  [&contiguous](){ sum_iterator(contiguous); });
+    run_benchmark("roi view []",nruns,[&roi](){ sum_linear(roi); });
+    run_benchmark("roi view iterator",nruns,[&roi](){ sum_iterator(roi); });
+    run_benchmark("roi view runs",nruns,[&roi](){ sum_runs(roi); });
+    run_benchmark("strided view []",nruns,
+                  [&strided](){ sum_linear(strided); });
+    run_benchmark("strided view ()",nruns,
+                  [&strided](){ sum_multi_index(strided); });
+    run_benchmark("strided view iterator",nruns,
+                  [&strided](){ sum_iterator(strided); });
+    run_benchmark("strided legacy",nruns,
+                  [&a,&selection](){ sum_legacy(a,selection); });
+
+    return sink > 0 ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <pni/core/types.hpp>
+#include <pni/core/benchmark.hpp>
+#include <pni/core/configuration.hpp>
+
+typedef pni::core::chrono_timer<std::chrono::high_resolution_clock,
+                                std::chrono::microseconds> timer_type;
+
+//-----------------------------------------------------------------------------
+// run a benchmark function nruns times and print the result
+//
+inline void run_benchmark(const pni::core::string &name,size_t nruns,
+                          pni::core::benchmark_runner::function_t func)
+{
+    using namespace pni::core;
+
+    benchmark_runner runner;
+    runner.run<timer_type>(nruns,func);
+
+    std::cout<<std::setw(40)<<std::left<<name<<" "
+             <<average(runner)<<" +/- "<<standard_deviation(runner)
+             <<std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// parse the command line of a benchmark program - returns false if the
+// program should terminate (help requested)
+//
+inline bool parse_benchmark_options(pni::core::configuration &config,
+                                    int argc,char **argv)
+{
+    using namespace pni::core;
+
+    config.add_option(config_option<bool>("help","h",
+                      "show help text",false));
+    parse(config,cliargs2vector(argc,argv));
+
+    if(config.value<bool>("help"))
+    {
+        std::cerr<<config<<std::endl;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,133 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Compares masks of bool_t (one byte per pixel) with bitmask_array (one 
+// bit per pixel) for the typical operations on detector masks: creating
+// a mask from a threshold, combining masks, counting the selected pixels
+// and applying a mask to a frame.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,size_t ny,size_t nx,
+                         size_t nruns)
+{
+    typedef dynamic_array<T> array_type;
+    typedef dynamic_array<bool_t> byte_mask_type;
+
+    auto frame = array_type::create(shape_t{ny,nx});
+    for(size_t i=0;i<frame.size();++i) frame[i] = T((i*7919)%1000);
+
+    auto bytes = byte_mask_type::create(shape_t{ny,nx});
+    auto other = byte_mask_type::create(shape_t{ny,nx});
+    auto bits = bitmask_array::create(shape_t{ny,nx});
+
+    //threshold
+    run_benchmark(tname+" threshold bool_t",nruns,[&]()
+    {
+        const T *p = frame.data();
+        for(size_t i=0;i<bytes.size();++i) bytes[i] = p[i]>T(900);
+    });
+
+    run_benchmark(tname+" threshold bitmask",nruns,[&]()
+    {
+        bits = threshold_mask(frame,T(900));
+    });
+
+    for(size_t i=0;i<other.size();++i) other[i] = frame[i]<T(10);
+    auto other_bits = to_bitmask(other);
+
+    //combine two masks
+    auto result = byte_mask_type::create(shape_t{ny,nx});
+    run_benchmark(tname+" or bool_t",nruns,[&]()
+    {
+        for(size_t i=0;i<result.size();++i) 
+            result[i] = bytes[i] || other[i];
+    });
+
+    bitmask_array bits_result;
+    run_benchmark(tname+" or bitmask",nruns,[&]()
+    {
+        bits_result = bits | other_bits;
+    });
+
+    //count
+    size_t n = 0;
+    run_benchmark(tname+" count bool_t",nruns,[&]()
+    {
+        n += mask_count(result);
+    });
+
+    run_benchmark(tname+" count bitmask",nruns,[&]()
+    {
+        n += mask_count(bits_result);
+    });
+
+    //apply to the frame
+    run_benchmark(tname+" masked fill bool_t",nruns,[&]()
+    {
+        frame[result] = T(0);
+    });
+
+    run_benchmark(tname+" masked fill bitmask",nruns,[&]()
+    {
+        frame[bits_result] = T(0);
+    });
+
+    //convert back
+    auto weights = dynamic_array<float32>::create(shape_t{ny,nx});
+    run_benchmark(tname+" unpack bitmask",nruns,[&]()
+    {
+        unpack_mask(bits_result,weights);
+    });
+
+    std::cout<<"selected: "<<n<<std::endl;
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of pixels along the first dimension",4096));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of pixels along the second dimension",4096));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<uint16>("uint16",ny,nx,nruns);
+    run_type_benchmarks<float32>("float32",ny,nx,nruns);
+
+    return 0;
+}
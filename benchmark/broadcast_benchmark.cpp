@@ -0,0 +1,132 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Compares expressions and inplace operations with broadcast operands - a 
+// per pixel map of shape (ny,nx) and a per frame vector of shape (nf,1,1) 
+// combined with a frame stack of shape (nf,ny,nx) - with the same 
+// operations on operands of the full shape.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,size_t nf,size_t ny,size_t nx,
+                         size_t nruns)
+{
+    typedef dynamic_array<T> array_type;
+    typedef mdarray<std::vector<T>,dynamic_cindex_map,
+                    simd_inplace_arithmetics> simd_array_type;
+
+    auto frames = array_type::create(shape_t{nf,ny,nx});
+    auto r = array_type::create(shape_t{nf,ny,nx});
+    auto dark = array_type::create(shape_t{ny,nx});
+    auto norm = array_type::create(shape_t{nf,1,1});
+    auto full_dark = array_type::create(shape_t{nf,ny,nx});
+    auto full_norm = array_type::create(shape_t{nf,ny,nx});
+    std::fill(frames.begin(),frames.end(),T(100));
+    std::fill(dark.begin(),dark.end(),T(2));
+    std::fill(norm.begin(),norm.end(),T(3));
+    std::fill(full_dark.begin(),full_dark.end(),T(2));
+    std::fill(full_norm.begin(),full_norm.end(),T(3));
+
+    run_benchmark(tname+" (frames-dark)*norm full shape",nruns,[&]()
+    {
+        r = (frames-full_dark)*full_norm;
+    });
+
+    run_benchmark(tname+" (frames-dark)*norm broadcast",nruns,[&]()
+    {
+        r = (frames-dark)*norm;
+    });
+
+    run_benchmark(tname+" (frames-dark)*norm expanded",nruns,[&]()
+    {
+        //what had to be done without broadcasting
+        auto tmp_dark = array_type::create(shape_t{nf,ny,nx});
+        auto tmp_norm = array_type::create(shape_t{nf,ny,nx});
+        size_t npix = ny*nx;
+        for(size_t f=0;f<nf;++f)
+        {
+            std::copy(dark.begin(),dark.end(),tmp_dark.begin()+f*npix);
+            std::fill(tmp_norm.begin()+f*npix,tmp_norm.begin()+(f+1)*npix,
+                      norm[f]);
+        }
+        r = (frames-tmp_dark)*tmp_norm;
+    });
+
+    run_benchmark(tname+" frames -= dark full shape",nruns,[&]()
+    {
+        frames -= full_dark;
+    });
+
+    run_benchmark(tname+" frames -= dark broadcast",nruns,[&]()
+    {
+        frames -= dark;
+    });
+
+    auto sframes = simd_array_type::create(shape_t{nf,ny,nx});
+    auto sdark = simd_array_type::create(shape_t{ny,nx});
+    auto sfull_dark = simd_array_type::create(shape_t{nf,ny,nx});
+    std::fill(sframes.begin(),sframes.end(),T(100));
+
+    run_benchmark(tname+" frames -= dark full shape (SIMD)",nruns,[&]()
+    {
+        sframes -= sfull_dark;
+    });
+
+    run_benchmark(tname+" frames -= dark broadcast (SIMD)",nruns,[&]()
+    {
+        sframes -= sdark;
+    });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("nf","f",
+                      "number of frames",50));
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of pixels along the first dimension",512));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of pixels along the second dimension",512));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t nf = config.value<size_t>("nf");
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<float32>("float32",nf,ny,nx,nruns);
+    run_type_benchmarks<float64>("float64",nf,ny,nx,nruns);
+    run_type_benchmarks<int32>("int32",nf,ny,nx,nruns);
+
+    return 0;
+}
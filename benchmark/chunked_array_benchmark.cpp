@@ -0,0 +1,121 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Compares the processing of an array made of separately allocated chunks
+// chunk by chunk with the element wise access via iterators and with the 
+// same operations on a contiguous array. The number of threads is taken 
+// from PNICORE_NTHREADS.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,size_t nframes,size_t ny,
+                         size_t nx,size_t chunk,size_t nruns)
+{
+    typedef chunked_array<T> chunked_type;
+    typedef array_factory<chunked_type> factory;
+    typedef dynamic_array<T> array_type;
+
+    shape_t shape{nframes,ny,nx};
+    auto a = factory::create_chunked(shape,shape_t{chunk,ny,nx});
+    auto b = factory::create_chunked(shape,shape_t{chunk,ny,nx});
+    auto r = factory::create_chunked(shape,shape_t{chunk,ny,nx});
+    auto ca = array_type::create(shape);
+    auto cb = array_type::create(shape);
+    auto cr = array_type::create(shape);
+    for(size_t i=0;i<ca.size();++i) ca[i] = T(i%1000);
+    std::fill(cb.begin(),cb.end(),T(2));
+    r = ca;
+    a = ca;
+    b = cb;
+
+    T result = T(0);
+    run_benchmark(tname+" contiguous max",nruns,[&]()
+    {
+        result = *std::max_element(ca.begin(),ca.end());
+    });
+
+    run_benchmark(tname+" chunked max element wise",nruns,[&]()
+    {
+        result = *std::max_element(a.begin(),a.end());
+    });
+
+    run_benchmark(tname+" chunked max",nruns,[&]()
+    {
+        result = max(a);
+    });
+
+    run_benchmark(tname+" chunked clip",nruns,[&]()
+    {
+        clip(a,T(10),T(900));
+    });
+
+    run_benchmark(tname+" contiguous r = a*b+a",nruns,[&]()
+    {
+        assign(cr,ca*cb+ca,parallel_execution());
+    });
+
+    run_benchmark(tname+" chunked r = a*b+a element wise",nruns,[&]()
+    {
+        for(size_t i=0;i<r.size();++i) r[i] = a[i]*b[i]+a[i];
+    });
+
+    run_benchmark(tname+" chunked r = a*b+a",nruns,[&]()
+    {
+        assign(r,a*b+a,parallel_execution());
+    });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("nframes","n",
+                      "number of frames",64));
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of pixels along the first dimension",512));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of pixels along the second dimension",512));
+    config.add_option(config_option<size_t>("chunk","c",
+                      "number of frames per chunk",8));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",10));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t nframes = config.value<size_t>("nframes");
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t chunk = config.value<size_t>("chunk");
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<float32>("float32",nframes,ny,nx,chunk,nruns);
+    run_type_benchmarks<uint16>("uint16",nframes,ny,nx,chunk,nruns);
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+//
+// Compares the evaluation of r = a*b + c/d - 3 via expression templates 
+// with a handwritten fused loop. 
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+// the evaluation strategy used by mdarray before packet evaluation
+//
+template<
+         typename ATYPE,
+         typename ETYPE
+        >
+void assign_element_wise(ATYPE &r,const ETYPE &expr)
+{
+    size_t n = r.size();
+    for(size_t i=0;i<n;++i) r[i] = expr[i];
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,const shape_t &shape,
+                         size_t nruns)
+{
+    typedef dynamic_array<T> array_type;
+
+    auto a = array_type::create(shape);
+    auto b = array_type::create(shape);
+    auto c = array_type::create(shape);
+    auto d = array_type::create(shape);
+    auto r = array_type::create(shape);
+    std::fill(a.begin(),a.end(),T(1.5));
+    std::fill(b.begin(),b.end(),T(2.5));
+    std::fill(c.begin(),c.end(),T(3.5));
+    std::fill(d.begin(),d.end(),T(4.5));
+    T s(3);
+
+    run_benchmark(tname+" fused loop",nruns,[&]()
+    {
+        const T *pa = a.data(), *pb = b.data(), *pc = c.data(), *pd = d.data();
+        T *pr = r.data();
+        size_t n = r.size();
+        for(size_t i=0;i<n;++i) pr[i] = pa[i]*pb[i] + pc[i]/pd[i] - s;
+    });
+
+    run_benchmark(tname+" element wise",nruns,[&]()
+    {
+        assign_element_wise(r,a*b + c/d - s);
+    });
+
+    run_benchmark(tname+" expression",nruns,[&]() { r = a*b + c/d - s; });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of elements along the first dimension",2048));
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of elements along the second dimension",2048));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    shape_t shape{config.value<size_t>("nx"),config.value<size_t>("ny")};
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<float32>("float32",shape,nruns);
+    run_type_benchmarks<float64>("float64",shape,nruns);
+    run_type_benchmarks<int32>("int32",shape,nruns);
+
+    return 0;
+}
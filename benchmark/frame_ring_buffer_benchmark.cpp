@@ -0,0 +1,106 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Pushes frames into a frame_ring_buffer and compares the cost of keeping 
+// the mean over the last K frames up to date with what had to be done 
+// without it: copying the frame into a (K,...) stack and summing up all K
+// frames again.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,size_t nframes,size_t ny,
+                         size_t nx,size_t nruns)
+{
+    typedef dynamic_array<T> array_type;
+    typedef dynamic_array<float64> mean_type;
+
+    auto frame = array_type::create(shape_t{ny,nx});
+    auto mean = mean_type::create(shape_t{ny,nx});
+    std::fill(frame.begin(),frame.end(),T(100));
+
+    auto stack = array_type::create(shape_t{nframes,ny,nx});
+    std::fill(stack.begin(),stack.end(),T(0));
+    size_t slot = 0;
+    run_benchmark(tname+" push and mean stack",nruns,[&]()
+    {
+        std::copy(frame.begin(),frame.end(),stack.begin()+slot*frame.size());
+        slot = (slot+1)%nframes;
+
+        std::fill(mean.begin(),mean.end(),0.);
+        for(size_t f=0;f<nframes;++f)
+        {
+            const T *ptr = stack.data()+f*frame.size();
+            for(size_t i=0;i<mean.size();++i) mean[i] += ptr[i];
+        }
+        for(auto &m: mean) m /= nframes;
+    });
+
+    frame_ring_buffer<T> buffer(nframes,shape_t{ny,nx});
+    run_benchmark(tname+" push",nruns,[&]()
+    {
+        buffer.push(frame);
+    });
+
+    run_benchmark(tname+" push and mean",nruns,[&]()
+    {
+        buffer.push(frame);
+        buffer.copy_mean(mean);
+    });
+
+    run_benchmark(tname+" copy_frame",nruns,[&]()
+    {
+        buffer.copy_frame(0,frame);
+    });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("nframes","k",
+                      "number of frames in the buffer",32));
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of pixels along the first dimension",1024));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of pixels along the second dimension",1024));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t nframes = config.value<size_t>("nframes");
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<uint16>("uint16",nframes,ny,nx,nruns);
+    run_type_benchmarks<float32>("float32",nframes,ny,nx,nruns);
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+
+//
+// Conversion of a single precision frame to the 16Bit floating point types 
+// and back. The element benchmarks convert one value at a time with 
+// std::copy. The array benchmarks use the constructor and the assignment 
+// operator of mdarray which use the SIMD conversion kernels.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+typedef dynamic_array<float32> array_type;
+
+//
+// results are stored here to keep the compiler from removing the copies
+//
+static float32 sink = 0;
+
+//-----------------------------------------------------------------------------
+template<typename T> 
+void run_conversion(const string &name,const array_type &frame,size_t nruns)
+{
+    typedef dynamic_array<T> half_array_type;
+    auto packed = half_array_type::create(frame.template shape<shape_t>());
+    auto unpacked = array_type::create(frame.template shape<shape_t>());
+
+    run_benchmark("float32 to "+name+" elements",nruns,
+                  [&frame,&packed](){
+                    std::copy(frame.begin(),frame.end(),packed.begin());
+                    sink += packed[0];
+                  });
+    run_benchmark("float32 to "+name+" array",nruns,
+                  [&frame,&packed](){
+                    packed = frame;
+                    sink += packed[0];
+                  });
+    run_benchmark(name+" to float32 elements",nruns,
+                  [&packed,&unpacked](){
+                    std::copy(packed.begin(),packed.end(),unpacked.begin());
+                    sink += unpacked[0];
+                  });
+    run_benchmark(name+" to float32 array",nruns,
+                  [&packed,&unpacked](){
+                    unpacked = packed;
+                    sink += unpacked[0];
+                  });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of rows per frame",2048));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of columns per frame",2048));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",10));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    auto frame = array_type::create(shape_t{ny,nx});
+    float32 x = 1.f;
+    for(auto &v: frame) { v = x; x += 0.37f; if(x>60000.f) x = -60000.f; }
+
+    run_conversion<float16>("float16",frame,nruns);
+    run_conversion<bfloat16>("bfloat16",frame,nruns);
+
+    return sink != 0.f ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+//
+// Compares the default inplace_arithmetics policy with
+// simd_inplace_arithmetics for the floating point and complex types.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+template<typename T>
+using default_array = mdarray<std::vector<T>,dynamic_cindex_map,
+                              inplace_arithmetics>;
+template<typename T>
+using simd_array = mdarray<std::vector<T>,dynamic_cindex_map,
+                           simd_inplace_arithmetics>;
+
+//-----------------------------------------------------------------------------
+template<typename ATYPE>
+void run_array_benchmarks(const string &prefix,const shape_t &shape,
+                          size_t nruns)
+{
+    typedef typename ATYPE::value_type value_type;
+
+    auto a = ATYPE::create(shape);
+    auto b = ATYPE::create(shape);
+    std::fill(a.begin(),a.end(),value_type(1));
+    std::fill(b.begin(),b.end(),value_type(1.0001));
+    value_type s(1.0001);
+
+    run_benchmark(prefix+" a+=b",nruns,[&a,&b](){ a+=b; });
+    run_benchmark(prefix+" a*=s",nruns,[&a,&s](){ a*=s; });
+    run_benchmark(prefix+" a/=b",nruns,[&a,&b](){ a/=b; });
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,const shape_t &shape,
+                         size_t nruns)
+{
+    run_array_benchmarks<default_array<T>>(tname+" default",shape,nruns);
+    run_array_benchmarks<simd_array<T>>(tname+" simd",shape,nruns);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of elements along the first dimension",2048));
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of elements along the second dimension",2048));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    shape_t shape{config.value<size_t>("nx"),config.value<size_t>("ny")};
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<float32>("float32",shape,nruns);
+    run_type_benchmarks<float64>("float64",shape,nruns);
+    run_type_benchmarks<complex32>("complex32",shape,nruns);
+    run_type_benchmarks<complex64>("complex64",shape,nruns);
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Compares masked assignment, compress, gather and masked reductions on a
+// detector frame with the scalar loops over the [] operator which had to 
+// be written without them. The number of threads is taken from 
+// PNICORE_NTHREADS.
+//
+#include <algorithm>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,size_t ny,size_t nx,size_t nruns)
+{
+    typedef dynamic_array<T> array_type;
+
+    auto frame = array_type::create(shape_t{ny,nx});
+    auto mask = dynamic_array<bool_t>::create(shape_t{ny,nx});
+    auto lut = dynamic_array<uint32>::create(shape_t{nx,ny});
+    std::fill(frame.begin(),frame.end(),T(100));
+    //every 10th pixel is bad
+    for(size_t i=0;i<mask.size();++i) mask[i] = (i*7)%10==0;
+    for(size_t i=0;i<nx;++i)
+        for(size_t j=0;j<ny;++j) lut(i,j) = j*nx+i;
+
+    run_benchmark(tname+" a[mask] = v loop",nruns,[&]()
+    {
+        for(size_t i=0;i<frame.size();++i) if(mask[i]) frame[i] = T(0);
+    });
+
+    run_benchmark(tname+" a[mask] = v",nruns,[&]()
+    {
+        frame[mask] = T(0);
+    });
+
+    size_t n = mask_count(mask);
+    auto values = array_type::create(shape_t{n});
+    run_benchmark(tname+" compress loop",nruns,[&]()
+    {
+        size_t k = 0;
+        for(size_t i=0;i<frame.size();++i) if(mask[i]) values[k++] = frame[i];
+    });
+
+    run_benchmark(tname+" compress",nruns,[&]()
+    {
+        values = compress(frame,mask);
+    });
+
+    run_benchmark(tname+" a[mask] = values loop",nruns,[&]()
+    {
+        size_t k = 0;
+        for(size_t i=0;i<frame.size();++i) if(mask[i]) frame[i] = values[k++];
+    });
+
+    run_benchmark(tname+" a[mask] = values",nruns,[&]()
+    {
+        frame[mask] = values;
+    });
+
+    T sum = T(0);
+    run_benchmark(tname+" masked sum loop",nruns,[&]()
+    {
+        sum = T(0);
+        for(size_t i=0;i<frame.size();++i) if(mask[i]) sum += frame[i];
+    });
+
+    run_benchmark(tname+" masked sum",nruns,[&]()
+    {
+        sum = masked_sum(frame,mask);
+    });
+
+    auto image = array_type::create(shape_t{nx,ny});
+    run_benchmark(tname+" take loop",nruns,[&]()
+    {
+        for(size_t i=0;i<image.size();++i) image[i] = frame[lut[i]];
+    });
+
+    run_benchmark(tname+" take",nruns,[&]()
+    {
+        take(frame,lut,image);
+    });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of pixels along the first dimension",2048));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of pixels along the second dimension",2048));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<float32>("float32",ny,nx,nruns);
+    run_type_benchmarks<float64>("float64",ny,nx,nruns);
+    run_type_benchmarks<uint16>("uint16",ny,nx,nruns);
+
+    return 0;
+}
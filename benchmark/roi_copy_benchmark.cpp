@@ -0,0 +1,93 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+//
+// Extraction of a region of interest from a detector frame and writing it
+// back. The element benchmarks copy with the view iterators (the way the
+// mdarray constructor and the assignment of array_view did before the 
+// segment decomposition was introduced). The segment benchmarks use the 
+// constructor and the assignment operator which copy row by row.
+//
+#include <algorithm>
+#include <numeric>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+typedef dynamic_array<uint16> array_type;
+
+//
+// results are stored here to keep the compiler from removing the copies
+//
+static size_t sink = 0;
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of rows per frame",4096));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of columns per frame",4096));
+    config.add_option(config_option<size_t>("roi","s",
+                      "edge length of the region of interest",1024));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",10));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t n  = config.value<size_t>("roi");
+    size_t nruns = config.value<size_t>("nruns");
+
+    auto frame = array_type::create(shape_t{ny,nx});
+    std::iota(frame.begin(),frame.end(),0);
+
+    auto roi = frame(slice(ny/4,ny/4+n),slice(nx/4,nx/4+n));
+    auto buffer = array_type::create(shape_t{n,n});
+
+    run_benchmark("roi to array elements",nruns,
+                  [&roi,&buffer](){ 
+                    std::copy(roi.begin(),roi.end(),buffer.begin());
+                    sink += buffer[0];
+                  });
+    run_benchmark("roi to array segments",nruns,
+                  [&roi](){ 
+                    array_type b(roi);
+                    sink += b[0];
+                  });
+    run_benchmark("array to roi elements",nruns,
+                  [&roi,&buffer](){ 
+                    std::copy(buffer.begin(),buffer.end(),roi.begin());
+                    sink += roi[0];
+                  });
+    run_benchmark("array to roi segments",nruns,
+                  [&roi,&buffer](){ 
+                    roi = buffer;
+                    sink += roi[0];
+                  });
+
+    return sink > 0 ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Compares complex arrays stored interleaved (std::complex) with split 
+// real and imaginary planes (soa_complex_array) for the elementwise 
+// operations of Fourier domain processing: complex multiplication, 
+// magnitudes, and the conversion between both layouts.
+//
+#include <cmath>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void run_type_benchmarks(const string &tname,size_t ny,size_t nx,
+                         size_t nruns)
+{
+    typedef std::complex<T> complex_type;
+    typedef dynamic_array<complex_type> interleaved_type;
+    typedef soa_complex_array<T> split_type;
+    typedef dynamic_array<T> real_type;
+
+    shape_t shape{ny,nx};
+    auto a = interleaved_type::create(shape);
+    auto b = interleaved_type::create(shape);
+    auto c = interleaved_type::create(shape);
+    for(size_t i=0;i<a.size();++i)
+    {
+        a[i] = complex_type(T(i%1000),T(i%777)-T(300));
+        b[i] = complex_type(std::cos(T(i%31)),std::sin(T(i%31)));
+    }
+
+    split_type sa(a),sb(b);
+    auto sc = split_type::create(shape);
+    auto m = real_type::create(shape);
+
+    //multiplication
+    run_benchmark(tname+" multiply interleaved",nruns,[&]()
+    {
+        c = a*b;
+    });
+
+    run_benchmark(tname+" multiply split",nruns,[&]()
+    {
+        sc = sa*sb;
+    });
+
+    run_benchmark(tname+" multiply-add interleaved",nruns,[&]()
+    {
+        c = a*b+c;
+    });
+
+    run_benchmark(tname+" multiply-add split",nruns,[&]()
+    {
+        sc = sa*sb+sc;
+    });
+
+    //magnitudes
+    run_benchmark(tname+" abs interleaved",nruns,[&]()
+    {
+        for(size_t i=0;i<a.size();++i) m[i] = std::abs(a[i]);
+    });
+
+    run_benchmark(tname+" abs split",nruns,[&]()
+    {
+        m = sa.abs();
+    });
+
+    //layout conversion
+    run_benchmark(tname+" deinterleave",nruns,[&]()
+    {
+        sc = a;
+    });
+
+    run_benchmark(tname+" interleave",nruns,[&]()
+    {
+        interleave(sc,c);
+    });
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("ny","y",
+                      "number of pixels along the first dimension",2048));
+    config.add_option(config_option<size_t>("nx","x",
+                      "number of pixels along the second dimension",2048));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",20));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t ny = config.value<size_t>("ny");
+    size_t nx = config.value<size_t>("nx");
+    size_t nruns = config.value<size_t>("nruns");
+
+    run_type_benchmarks<float32>("complex32",ny,nx,nruns);
+    run_type_benchmarks<float64>("complex64",ny,nx,nruns);
+
+    return 0;
+}
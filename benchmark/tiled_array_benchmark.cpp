@@ -0,0 +1,103 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+//
+// Neighborhood access and transposition of a large image stored in C order
+// and in tiles. The stencil benchmark computes the sum over the 3x3 
+// neighborhood of every pixel, the transpose benchmark writes the 
+// transposed image. Both access the elements by their multidimensional 
+// index. The conversion benchmarks measure to_tiled() and from_tiled().
+//
+#include <algorithm>
+#include <numeric>
+#include <pni/core/arrays.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+typedef dynamic_array<float32> carray_type;
+typedef tiled_array<float32,32> tarray_type;
+
+//
+// results are stored here to keep the compiler from removing the loops
+//
+static float64 sink = 0;
+
+//-----------------------------------------------------------------------------
+template<typename ATYPE> void stencil(const ATYPE &in,ATYPE &out,size_t n)
+{
+    for(size_t i=1;i<n-1;++i)
+        for(size_t j=1;j<n-1;++j)
+            out(i,j) = in(i-1,j-1)+in(i-1,j)+in(i-1,j+1)+
+                       in(i,j-1)  +in(i,j)  +in(i,j+1)+
+                       in(i+1,j-1)+in(i+1,j)+in(i+1,j+1);
+
+    sink += out(n/2,n/2);
+}
+
+//-----------------------------------------------------------------------------
+template<typename ATYPE> void transpose(const ATYPE &in,ATYPE &out,size_t n)
+{
+    for(size_t i=0;i<n;++i)
+        for(size_t j=0;j<n;++j)
+            out(j,i) = in(i,j);
+
+    sink += out(1,0);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("size","n",
+                      "number of pixels along each dimension",4096));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",5));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t n = config.value<size_t>("size");
+    size_t nruns = config.value<size_t>("nruns");
+    shape_t shape{n,n};
+
+    auto c_in  = carray_type::create(shape);
+    auto c_out = carray_type::create(shape);
+    auto t_in  = tarray_type::create(shape);
+    auto t_out = tarray_type::create(shape);
+    std::iota(c_in.begin(),c_in.end(),0.f);
+    to_tiled(c_in,t_in);
+
+    run_benchmark("stencil C order",nruns,
+                  [&](){ stencil(c_in,c_out,n); });
+    run_benchmark("stencil tiled",nruns,
+                  [&](){ stencil(t_in,t_out,n); });
+    run_benchmark("transpose C order",nruns,
+                  [&](){ transpose(c_in,c_out,n); });
+    run_benchmark("transpose tiled",nruns,
+                  [&](){ transpose(t_in,t_out,n); });
+    run_benchmark("C order to tiled",nruns,
+                  [&](){ to_tiled(c_in,t_out); sink += t_out[1]; });
+    run_benchmark("tiled to C order",nruns,
+                  [&](){ from_tiled(t_in,c_out); sink += c_out[1]; });
+
+    return sink != 0 ? 0 : 1;
+}
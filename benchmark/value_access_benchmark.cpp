@@ -0,0 +1,161 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+
+//
+// Element access through the type erasures. Every element read from an 
+// array type erasure creates an instance of value, every element written 
+// creates an instance of value_ref. The iterators and the block read and 
+// write functions avoid this by fetching entire blocks of elements with a 
+// single virtual call. visit() passes the data to a typed kernel without 
+// any per element overhead. The record benchmark builds tables of rows stored 
+// as std::vector<value> like a parser for ASCII data files does.
+//
+#include <vector>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures.hpp>
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+
+//
+// results are stored here to keep the compiler from removing the loops
+//
+static float64 sink = 0;
+
+//
+// typed kernel used with visit()
+//
+struct sum_visitor
+{
+    template<typename ATYPE> float64 operator()(const ATYPE &a) const
+    {
+        float64 s = 0;
+        for(auto x: a) s += float64(x);
+        return s;
+    }
+};
+
+//-----------------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+    configuration config;
+    config.add_option(config_option<size_t>("size","n",
+                      "number of array elements",1000000));
+    config.add_option(config_option<size_t>("rows","l",
+                      "number of rows per table",100000));
+    config.add_option(config_option<size_t>("nruns","r",
+                      "number of runs per benchmark",10));
+    if(!parse_benchmark_options(config,argc,argv)) return 1;
+
+    size_t n = config.value<size_t>("size");
+    size_t nrows = config.value<size_t>("rows");
+    size_t nruns = config.value<size_t>("nruns");
+
+    auto data = dynamic_array<float64>::create(shape_t{n});
+    for(size_t i=0;i<n;++i) data[i] = float64(i);
+    array a(data);
+    const array &ca = a;
+
+    run_benchmark("array read",nruns,
+                  [&ca,n](){
+                    for(size_t i=0;i<n;++i) sink += ca[i].as<float64>();
+                  });
+    run_benchmark("array write",nruns,
+                  [&a,n](){
+                    for(size_t i=0;i<n;++i) a[i] = float64(i);
+                    sink += a[1].as<float64>();
+                  });
+    run_benchmark("array copy value to value_ref",nruns,
+                  [&a,&ca,n](){
+                    for(size_t i=1;i<n;++i) a[i-1] = ca[i];
+                    sink += a[1].as<float64>();
+                  });
+    run_benchmark("array const iterator",nruns,
+                  [&ca](){
+                    for(auto iter=ca.begin();iter!=ca.end();++iter) 
+                        sink += (*iter).as<float64>();
+                  });
+    run_benchmark("array iterator",nruns,
+                  [&a](){
+                    float64 x = 1.;
+                    for(auto iter=a.begin();iter!=a.end();++iter,x+=1.) 
+                        *iter = x;
+                    sink += a[1].as<float64>();
+                  });
+
+    std::vector<float64> f64(n);
+    std::vector<float32> f32(n);
+    run_benchmark("array block read",nruns,
+                  [&ca,&f64,n](){
+                    ca.read(0,n,f64.data());
+                    sink += f64[1];
+                  });
+    run_benchmark("array block read with conversion",nruns,
+                  [&ca,&f32,n](){
+                    ca.read(0,n,f32.data());
+                    sink += f32[1];
+                  });
+    run_benchmark("array block write with conversion",nruns,
+                  [&a,&f32,n](){
+                    a.write(0,n,f32.data());
+                    sink += a[1].as<float64>();
+                  });
+    run_benchmark("array visit",nruns,
+                  [&ca](){
+                    sink += visit<float_types>(ca,sum_visitor());
+                  });
+    run_benchmark("numeric records",nruns,
+                  [nrows](){
+                    std::vector<std::vector<value>> table;
+                    table.reserve(nrows);
+                    for(size_t i=0;i<nrows;++i)
+                    {
+                        std::vector<value> row;
+                        row.push_back(value(uint32(i)));
+                        row.push_back(value(float64(i)));
+                        row.push_back(value(float32(i)));
+                        row.push_back(value(complex64(i,i)));
+                        table.push_back(std::move(row));
+                    }
+                    sink += table.back()[1].as<float64>();
+                  });
+    run_benchmark("mixed records",nruns,
+                  [nrows](){
+                    std::vector<std::vector<value>> table;
+                    table.reserve(nrows);
+                    for(size_t i=0;i<nrows;++i)
+                    {
+                        std::vector<value> row;
+                        row.push_back(value(uint32(i)));
+                        row.push_back(value(string("sample")));
+                        row.push_back(value(float64(i)));
+                        row.push_back(value(bool_t(true)));
+                        table.push_back(std::move(row));
+                    }
+                    sink += table.back()[2].as<float64>();
+                  });
+
+    return sink > 0 ? 0 : 1;
+}
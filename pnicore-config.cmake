@@ -9,4 +9,8 @@ if((NOT TARGET Boost::system) AND (NOT TARGET Boost::program_options))
 	endif()
 endif()
 link_directories(${Boost_LIBRARY_DIRS})
+
+if(NOT TARGET Threads::Threads)
+	find_package(Threads REQUIRED)
+endif()
 include(${CMAKE_CURRENT_LIST_DIR}/pnicore_targets.cmake)
@@ -24,8 +24,17 @@
 #pragma once
 
 #include <pni/core/algorithms/math/add_op.hpp>
+#include <pni/core/algorithms/math/assign.hpp>
+#include <pni/core/algorithms/math/broadcast.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
 #include <pni/core/algorithms/math/div_op.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
 #include <pni/core/algorithms/math/inplace_arithmetics.hpp>
 #include <pni/core/algorithms/math/mult_op.hpp>
 #include <pni/core/algorithms/math/op_traits.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/simd_mask.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
 #include <pni/core/algorithms/math/sub_op.hpp>
@@ -0,0 +1,126 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief sequential execution policy
+    //!
+    //! Tag type requesting that an algorithm is executed by the calling 
+    //! thread.
+    //!
+    struct sequential_execution {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief parallel execution policy
+    //!
+    //! Tag type requesting that an algorithm is executed by the threads of 
+    //! the default_thread_pool() if the data is large enough (see 
+    //! parallel_threshold()).
+    //!
+    struct parallel_execution {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief assign an expression 
+    //!
+    //! Evaluates an expression (or copies an array) to the destination 
+    //! array or view. This is equivalent to the assignment operator of 
+    //! mdarray but also works with views as a destination.
+    //!
+    //! \throws size_mismatch_error if the sizes of dest and expr differ
+    //! \tparam DTYPE destination type
+    //! \tparam ETYPE expression type
+    //! \param dest reference to the destination 
+    //! \param expr reference to the expression
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    void assign(DTYPE &dest,const ETYPE &expr,sequential_execution)
+    {
+        check_equal_size(dest,expr,EXCEPTION_RECORD);
+
+        evaluate_expression(dest,expr);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief assign an expression in parallel
+    //!
+    //! The destination is split into chunks with chunk_boundaries() and 
+    //! every thread evaluates the entire expression tree for the elements of
+    //! its own chunk. Within a chunk the expression is evaluated in SIMD 
+    //! packets if possible (see evaluate_expression()). Expressions with 
+    //! non-contiguous views as leaves or a non-contiguous view as 
+    //! destination are evaluated element by element.
+    /*!
+    \code
+    auto data = dynamic_array<float32>::create(shape_t{1000,2048,2048});
+    auto dark = dynamic_array<float32>::create(shape_t{1000,2048,2048});
+    auto gain = dynamic_array<float32>::create(shape_t{1000,2048,2048});
+    auto result = dynamic_array<float32>::create(shape_t{1000,2048,2048});
+
+    assign(result,(data-dark)*gain,parallel_execution());
+    \endcode
+    !*/
+    //!
+    //! The destination must not partially overlap with any of the arrays
+    //! in the expression. 
+    //!
+    //! \throws size_mismatch_error if the sizes of dest and expr differ
+    //! \tparam DTYPE destination type
+    //! \tparam ETYPE expression type
+    //! \param dest reference to the destination 
+    //! \param expr reference to the expression
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    void assign(DTYPE &dest,const ETYPE &expr,parallel_execution)
+    {
+        check_equal_size(dest,expr,EXCEPTION_RECORD);
+
+        parallel_for_chunks(dest,[&dest,&expr](size_t begin,size_t end)
+        {
+            evaluate_expression(dest,expr,begin,end);
+        });
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,420 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <limits>
+#include <sstream>
+#include <algorithm>
+#include <pni/core/types.hpp>
+#include <pni/core/error/exceptions.hpp>
+
+namespace pni{
+namespace core{
+
+    template<typename T> class scalar;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compute the shape of a broadcast
+    //!
+    //! Computes the shape of the result of an elementwise operation between
+    //! two arrays following the NumPy broadcasting rules. The shapes are 
+    //! aligned at their last dimension and the shorter one is padded with 
+    //! ones at the front. Two dimensions are compatible if they are equal 
+    //! or one of them is 1.
+    /*!
+    \code
+    auto s = broadcast_shape(shape_t{100,512,512},shape_t{512,512});
+    //s = {100,512,512}
+    s = broadcast_shape(shape_t{100,1,1},shape_t{512,512});
+    //s = {100,512,512}
+    \endcode
+    !*/
+    //!
+    //! \throws shape_mismatch_error if the shapes are not compatible
+    //! \param a shape of the first operand
+    //! \param b shape of the second operand
+    //! \return shape of the result
+    //!
+    inline shape_t broadcast_shape(const shape_t &a,const shape_t &b)
+    {
+        size_t rank = std::max(a.size(),b.size());
+        shape_t shape(rank);
+
+        for(size_t d=0;d<rank;++d)
+        {
+            size_t na = d<a.size() ? a[a.size()-d-1] : 1;
+            size_t nb = d<b.size() ? b[b.size()-d-1] : 1;
+
+            if(na!=nb && na!=1 && nb!=1)
+            {
+                std::stringstream ss;
+                ss<<"Cannot broadcast dimension "<<rank-d-1<<" ("<<na
+                  <<" and "<<nb<<" elements)!";
+                throw shape_mismatch_error(EXCEPTION_RECORD,ss.str());
+            }
+
+            shape[rank-d-1] = na==1 ? nb : na;
+        }
+
+        return shape;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief index map for broadcast operands
+    //!
+    //! Maps the linear index of the result of an operation to the linear 
+    //! index of an operand which is broadcast to the shape of the result.
+    //! Along the dimensions the operand is broadcast its stride is 0.
+    //!
+    //! The index space of the result is partitioned into runs of run() 
+    //! elements. Within a run the operand index advances by step() which 
+    //! is either 1 (the run covers contiguous elements of the operand) or 
+    //! 0 (the run covers a single element of the operand). Thus only the 
+    //! first index of every run has to be mapped with offset(). For an
+    //! operand of shape (H,W) broadcast to (N,H,W) a run covers a full 
+    //! frame, for an operand of shape (N,1,1) it covers a single element 
+    //! repeated H*W times.
+    //!
+    //! A default constructed map is the identity. 
+    //!
+    class broadcast_map
+    {
+        private:
+            //! shape of the result - the last dimension varies fastest
+            shape_t _shape;
+            //! strides of the operand along the dimensions of the result
+            shape_t _strides;
+            //! number of elements of a run
+            size_t _run;
+            //! stride of the operand index within a run
+            size_t _step;
+        public:
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief default constructor
+            //!
+            //! Creates the identity map.
+            //!
+            broadcast_map():
+                _shape(),
+                _strides(),
+                _run(std::numeric_limits<size_t>::max()),
+                _step(1)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! Both shapes must have the same rank and their last dimension 
+            //! must vary fastest. 
+            //!
+            //! \throws shape_mismatch_error if the operand cannot be 
+            //! broadcast to the shape of the result
+            //! \param op_shape shape of the operand
+            //! \param shape shape of the result
+            //!
+            broadcast_map(const shape_t &op_shape,const shape_t &shape):
+                _shape(shape),
+                _strides(shape.size()),
+                _run(1),
+                _step(1)
+            {
+                if(op_shape.size()!=shape.size())
+                    throw shape_mismatch_error(EXCEPTION_RECORD,
+                            "Operand and result must have the same rank!");
+
+                size_t stride = 1;
+                for(size_t d=shape.size();d>0;--d)
+                {
+                    if(op_shape[d-1]==1)
+                        _strides[d-1] = 0;
+                    else if(op_shape[d-1]==shape[d-1])
+                        _strides[d-1] = stride;
+                    else
+                    {
+                        std::stringstream ss;
+                        ss<<"Cannot broadcast dimension "<<d-1<<" of the "
+                          <<"operand ("<<op_shape[d-1]<<" elements) to "
+                          <<shape[d-1]<<" elements!";
+                        throw shape_mismatch_error(EXCEPTION_RECORD,ss.str());
+                    }
+                    stride *= op_shape[d-1];
+                }
+
+                //merge the trailing dimensions whose strides chain
+                for(size_t d=shape.size();d>0;--d)
+                {
+                    if(shape[d-1]==1) continue;
+
+                    if(_run==1)
+                        _step = _strides[d-1] ? 1 : 0;
+                    else if(_strides[d-1]!=_step*_run)
+                        break;
+
+                    _run *= shape[d-1];
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check for identity
+            //!
+            //! \return true if the operand has the shape of the result
+            //!
+            bool is_identity() const { return _shape.empty(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of elements of a run
+            //!
+            //! Runs start at multiples of run().
+            //!
+            size_t run() const { return _run; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief stride within a run
+            //!
+            //! \return 1 for contiguous runs, 0 for runs over a single element
+            //!
+            size_t step() const { return _step; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute operand index
+            //!
+            //! Computes the index of the operand for a non-identity map. 
+            //! This requires a division per dimension.
+            //!
+            //! \param i linear index of the result
+            //! \return linear index of the operand
+            //!
+            size_t offset(size_t i) const
+            {
+                size_t o = 0;
+                for(size_t d=_shape.size();d>0;--d)
+                {
+                    o += (i%_shape[d-1])*_strides[d-1];
+                    i /= _shape[d-1];
+                }
+                return o;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute operand index
+            //!
+            //! \param i linear index of the result
+            //! \return linear index of the operand
+            //!
+            size_t operator()(size_t i) const
+            {
+                return is_identity() ? i : offset(i);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief iterate over runs
+            //!
+            //! Calls f(i,o,n) for every run (or part of a run) in [begin,end)
+            //! where i is the index of the result, o the index of the 
+            //! operand, and n the number of elements. 
+            //!
+            //! \tparam FUNC function type
+            //! \param begin first index of the result
+            //! \param end one after the last index of the result
+            //! \param f function to call
+            //!
+            template<typename FUNC>
+            void for_each_run(size_t begin,size_t end,FUNC f) const
+            {
+                for(size_t i=begin;i<end;)
+                {
+                    size_t n = std::min(end-i,_run-i%_run);
+                    f(i,(*this)(i),n);
+                    i += n;
+                }
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief create a broadcast map
+    //!
+    //! Creates the map to access an operand with the linear index of a 
+    //! result of the given shape. The shape of the operand is padded with
+    //! ones at the front. The map is the identity if the padded shape 
+    //! equals the shape of the result. Broadcasting requires a strided index
+    //! map. For Fortran ordered operands the dimensions are reversed.
+    //!
+    //! \throws shape_mismatch_error if the operand cannot be broadcast
+    //! \tparam OPT operand type
+    //! \param op reference to the operand
+    //! \param shape shape of the result
+    //! \return broadcast map for the operand
+    //!
+    template<typename OPT>
+    broadcast_map make_broadcast_map(const OPT &op,const shape_t &shape)
+    {
+        typedef typename OPT::map_type::implementation_type imp_type;
+
+        shape_t op_shape = op.template shape<shape_t>();
+        if(op_shape.size()>shape.size())
+            throw shape_mismatch_error(EXCEPTION_RECORD,
+                    "The rank of the operand exceeds the rank of the result!");
+
+        op_shape.insert(op_shape.begin(),shape.size()-op_shape.size(),1);
+        if(op_shape==shape) return broadcast_map();
+
+        if(!imp_type::strided)
+            throw shape_mismatch_error(EXCEPTION_RECORD,
+                    "Broadcasting requires a strided index map!");
+
+        shape_t result_shape(shape);
+        if(!imp_type::c_order)
+        {
+            std::reverse(op_shape.begin(),op_shape.end());
+            std::reverse(result_shape.begin(),result_shape.end());
+        }
+
+        return broadcast_map(op_shape,result_shape);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief set up the broadcast of two operands
+    //!
+    //! Both operands are broadcast to broadcast_shape(). The map of an 
+    //! operand remains the identity if its shape, padded with ones at the 
+    //! front, equals this shape. Operands with the same number of elements
+    //! but different shapes, like (N,1) and (1,N), are broadcast too.
+    //!
+    //! \throws shape_mismatch_error if the operands cannot be broadcast
+    //! \tparam OP1T type of the first operand
+    //! \tparam OP2T type of the second operand
+    //! \param a first operand
+    //! \param b second operand
+    //! \param amap broadcast map for the first operand
+    //! \param bmap broadcast map for the second operand
+    //! \return number of elements of the result
+    //!
+    template<
+             typename OP1T,
+             typename OP2T
+            >
+    size_t make_broadcast(const OP1T &a,const OP2T &b,broadcast_map &amap,
+                          broadcast_map &bmap)
+    {
+        shape_t shape = broadcast_shape(a.template shape<shape_t>(),
+                                        b.template shape<shape_t>());
+        amap = make_broadcast_map(a,shape);
+        bmap = make_broadcast_map(b,shape);
+
+        size_t size = 1;
+        for(auto n: shape) size *= n;
+        return size;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief set up the broadcast of a scalar and an array
+    //!
+    //! Scalars are not indexed - both maps remain the identity.
+    //!
+    template<
+             typename T,
+             typename OP2T
+            >
+    size_t make_broadcast(const scalar<T> &,const OP2T &b,broadcast_map &,
+                          broadcast_map &)
+    {
+        return b.size();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief set up the broadcast of an array and a scalar
+    //!
+    //! Scalars are not indexed - both maps remain the identity.
+    //!
+    template<
+             typename OP1T,
+             typename T
+            >
+    size_t make_broadcast(const OP1T &a,const scalar<T> &,broadcast_map &,
+                          broadcast_map &)
+    {
+        return a.size();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief apply a function to a broadcast operand
+    //!
+    //! Calls f(a[i],b[o]) for all indices i in [begin,end) of the l.h.s. 
+    //! where o is the index of the broadcast r.h.s. The r.h.s. index is only
+    //! computed once per run of the map.
+    //!
+    //! \tparam LTYPE l.h.s. array type
+    //! \tparam RTYPE r.h.s. array type
+    //! \tparam FUNC function type
+    //! \param a reference to the l.h.s.
+    //! \param b reference to the r.h.s.
+    //! \param map broadcast map of the r.h.s.
+    //! \param begin first index of the l.h.s.
+    //! \param end one after the last index of the l.h.s.
+    //! \param f function to apply
+    //!
+    template<
+             typename LTYPE,
+             typename RTYPE,
+             typename FUNC
+            >
+    void broadcast_apply(LTYPE &a,const RTYPE &b,const broadcast_map &map,
+                         size_t begin,size_t end,FUNC f)
+    {
+        map.for_each_run(begin,end,[&](size_t i,size_t o,size_t n)
+        {
+            if(map.step())
+                for(size_t j=0;j<n;++j) f(a[i+j],b[o+j]);
+            else
+            {
+                const auto v = b[o];
+                for(size_t j=0;j<n;++j) f(a[i+j],v);
+            }
+        });
+    }
+
+//end of namespace
+}
+}
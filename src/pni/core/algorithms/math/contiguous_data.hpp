@@ -0,0 +1,96 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <type_traits>
+#include <pni/core/types/container_trait.hpp>
+
+namespace pni{
+namespace core{
+
+    template<typename ATYPE> class array_view;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief contiguous data trait
+    //!
+    //! Algorithms working directly on the memory of an array (SIMD kernels,
+    //! block copies, ...) must know whether an instance provides its data as
+    //! a single contiguous block which can be accessed via data().
+    //!
+    //! \c value is true if instances of CTYPE can provide contiguous memory
+    //! at all. If \c value is false data() must not be called. For types
+    //! where \c value is true the is_contiguous() function performs the
+    //! runtime check for a particular instance.
+    //!
+    //! This default implementation uses container_trait.
+    //!
+    //! \tparam CTYPE container type
+    //!
+    template<typename CTYPE> struct contiguous_data
+    {
+        //! true if the type can provide contiguous memory
+        static const bool value =
+            container_trait<typename std::remove_const<CTYPE>::type>::is_contiguous;
+
+        //!
+        //! \brief check instance
+        //!
+        //! \return true if the data of the instance is contiguous
+        //!
+        static bool is_contiguous(const CTYPE &) { return value; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief contiguous data trait for views
+    //!
+    //! A view can only be contiguous if the array it refers to is. Whether or
+    //! not a particular view is contiguous depends on its selection and can
+    //! only be decided at runtime.
+    //!
+    //! \tparam ATYPE array type of the view
+    //!
+    template<typename ATYPE> struct contiguous_data<array_view<ATYPE>>
+    {
+        //! true if the original array is contiguous
+        static const bool value =
+            container_trait<typename std::remove_const<ATYPE>::type>::is_contiguous;
+
+        //!
+        //! \brief check instance
+        //!
+        //! \param v reference to the view
+        //! \return true if the selection of the view is contiguous
+        //!
+        static bool is_contiguous(const array_view<ATYPE> &v)
+        {
+            return v.is_contiguous();
+        }
+    };
+
+//end of namespace
+}
+}
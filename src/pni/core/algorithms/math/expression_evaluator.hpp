@@ -0,0 +1,861 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
+#include <pni/core/algorithms/math/simd_convert.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/broadcast.hpp>
+
+namespace pni{
+namespace core{
+
+    template<typename OP1T,typename OP2T> class add_op;
+    template<typename OP1T,typename OP2T> class sub_op;
+    template<typename OP1T,typename OP2T> class mult_op;
+    template<typename OP1T,typename OP2T> class div_op;
+    template<typename T> class scalar;
+    template<typename STORAGE,typename IMAP,typename IPA> class mdarray;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief L1 data cache size
+    //!
+    //! Size of the L1 data cache in bytes assumed by the expression 
+    //! evaluator.
+    //!
+    static const size_t l1_cache_size = 32768;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief division kernel for expressions
+    //!
+    //! The SIMD complex division does not scale its operands as std::complex
+    //! does. To preserve the results of element wise evaluation complex 
+    //! divisions are not evaluated with packets.
+    //!
+    struct packet_div_kernel : public simd_div_kernel
+    {
+        //! true if the kernel is available for T
+        template<typename T> struct enabled
+        {
+            //! result
+            static const bool value = simd_div_kernel::enabled<T>::value &&
+                                      !is_complex_type<T>::value;
+        };
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for expression leaves
+    //!
+    //! A packet_expression is a light weight copy of an expression tree 
+    //! which is evaluated in SIMD packets of type simd_packet<T>. This 
+    //! default implementation represents a leaf of the tree (an array or a
+    //! view). It keeps a pointer to the data of the leaf. 
+    //!
+    //! \c value is true if an expression of type ETYPE can be evaluated 
+    //! with packets at all. Whether a particular instance can be evaluated 
+    //! this way is decided at runtime with is_valid().
+    //!
+    //! \tparam ETYPE expression (leaf) type
+    //! \tparam T element type of the result
+    //!
+    template<
+             typename ETYPE,
+             typename T
+            >
+    class packet_expression
+    {
+        private:
+            //! pointer to the leaf data
+            const T *_data;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+
+            //! true if the leaf can be evaluated with packets
+            static const bool value = contiguous_data<ETYPE>::value &&
+                    std::is_same<typename ETYPE::value_type,T>::value;
+
+            //! number of leaves with data in memory
+            static const size_t leaves = 1;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check instance
+            //!
+            //! A leaf can be evaluated if its data is contiguous, if it has 
+            //! the same size as the destination, and if its data either does
+            //! not overlap with the destination at all or is identical to it.
+            //!
+            //! \param e reference to the leaf
+            //! \param dest pointer to the destination data
+            //! \param n number of elements in the destination
+            //! \return true if packet evaluation is possible
+            //!
+            static bool is_valid(const ETYPE &e,const T *dest,size_t n)
+            {
+                if(!contiguous_data<ETYPE>::is_contiguous(e) || e.size()!=n)
+                    return false;
+
+                const T *p = e.data();
+                return p==dest || p+n<=dest || dest+n<=p;
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit packet_expression(const ETYPE &e):_data(e.data()) {}
+
+            //-----------------------------------------------------------------
+            //! leaves can be loaded at every index
+            size_t seek(size_t) const 
+            { 
+                return std::numeric_limits<size_t>::max(); 
+            }
+
+            //-----------------------------------------------------------------
+            //! load the packet starting at element i
+            typename packet_type::type load(size_t i) const
+            {
+                return packet_type::load(_data+i);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for scalars
+    //!
+    //! Scalars are broadcast to all elements of a packet. To preserve the 
+    //! result of element wise evaluation a scalar must be of the same type 
+    //! as the result or an integer scalar in a floating point expression.
+    //!
+    //! \tparam S scalar type
+    //! \tparam T element type of the result
+    //!
+    template<
+             typename S,
+             typename T
+            >
+    class packet_expression<scalar<S>,T>
+    {
+        private:
+            //! the scalar value
+            T _value;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+
+            //! true if the scalar can be evaluated with packets
+            static const bool value = std::is_same<S,T>::value ||
+                    (std::is_integral<S>::value && 
+                     std::is_floating_point<T>::value);
+
+            //! scalars have no data in memory
+            static const size_t leaves = 0;
+
+            //-----------------------------------------------------------------
+            //! scalars are always valid
+            static bool is_valid(const scalar<S> &,const T *,size_t) 
+            { 
+                return true; 
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit packet_expression(const scalar<S> &s):_value(S(s)) {}
+
+            //-----------------------------------------------------------------
+            //! scalars can be loaded at every index
+            size_t seek(size_t) const 
+            { 
+                return std::numeric_limits<size_t>::max(); 
+            }
+
+            //-----------------------------------------------------------------
+            //! broadcast the scalar to a packet
+            typename packet_type::type load(size_t) const
+            {
+                return packet_type::set1(_value);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for operands
+    //!
+    //! Evaluates an operand of a binary operation taking its broadcast_map 
+    //! into account. Operands which are not broadcast are evaluated at the 
+    //! index of the result. A broadcast operand must be a leaf with its 
+    //! data in memory. It is evaluated run by run: seek() positions the 
+    //! operand at the first index of a run and returns the number of 
+    //! elements until the end of the run. Within a run packets are either 
+    //! loaded from contiguous memory or a single element is broadcast to 
+    //! all elements of a packet. 
+    //!
+    //! \tparam ETYPE operand type
+    //! \tparam T element type of the result
+    //!
+    template<
+             typename ETYPE,
+             typename T
+            >
+    class packet_operand
+    {
+        private:
+            //! evaluator of the operand
+            typedef packet_expression<ETYPE,T> expression_type;
+            //! packet type
+            typedef simd_packet<T> packet_type;
+            //! evaluator 
+            expression_type _expr;
+            //! reference to the operand
+            const ETYPE &_op;
+            //! broadcast map of the operand
+            const broadcast_map &_map;
+            //! distance between the operand and the result index 
+            ssize_t _shift;
+            //! true if a single element is broadcast in the current run
+            bool _constant;
+            //! the broadcast element
+            typename packet_type::type _value;
+
+            //-----------------------------------------------------------------
+            //! expressions cannot be broadcast 
+            static bool is_valid_broadcast(const ETYPE &,const T *,size_t,
+                                           std::false_type)
+            {
+                return false;
+            }
+
+            //-----------------------------------------------------------------
+            //! broadcast leaves must not overlap with the destination
+            static bool is_valid_broadcast(const ETYPE &e,const T *dest,
+                                           size_t n,std::true_type)
+            {
+                if(!contiguous_data<ETYPE>::is_contiguous(e)) return false;
+
+                const T *p = e.data();
+                return p+e.size()<=dest || dest+n<=p;
+            }
+        public:
+            //! true if the operand can be evaluated with packets
+            static const bool value = expression_type::value;
+
+            //! number of leaves with data in memory
+            static const size_t leaves = expression_type::leaves;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check instance
+            //!
+            //! \param e reference to the operand
+            //! \param map broadcast map of the operand
+            //! \param dest pointer to the destination data
+            //! \param n number of elements in the destination
+            //! \return true if packet evaluation is possible
+            //!
+            static bool is_valid(const ETYPE &e,const broadcast_map &map,
+                                 const T *dest,size_t n)
+            {
+                if(map.is_identity()) 
+                    return expression_type::is_valid(e,dest,n);
+
+                return is_valid_broadcast(e,dest,n,
+                        std::integral_constant<bool,
+                                contiguous_data<ETYPE>::value>());
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            packet_operand(const ETYPE &e,const broadcast_map &map):
+                _expr(e),
+                _op(e),
+                _map(map),
+                _shift(0),
+                _constant(false),
+                _value()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief position the operand
+            //!
+            //! \param i index of the result
+            //! \return number of elements which can be loaded from i on
+            //!
+            size_t seek(size_t i)
+            {
+                if(_map.is_identity()) return _expr.seek(i);
+
+                size_t o = _map.offset(i);
+                _constant = !_map.step();
+                if(_constant)
+                    _value = packet_type::set1(_op[o]);
+                else
+                    _shift = ssize_t(o)-ssize_t(i);
+
+                return _map.run()-i%_map.run();
+            }
+
+            //-----------------------------------------------------------------
+            //! load the packet starting at element i of the result
+            typename packet_type::type load(size_t i) const
+            {
+                return _constant ? _value : _expr.load(i+_shift);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for binary operations
+    //!
+    //! Evaluates both operands and combines them with a SIMD kernel. The 
+    //! value type of the operation must be the result type T as otherwise 
+    //! packet evaluation would not produce the same result as element wise
+    //! evaluation.
+    //!
+    //! \tparam OPTYPE expression template type (add_op, sub_op, ...)
+    //! \tparam KERNEL SIMD kernel of the operation
+    //! \tparam T element type of the result
+    //!
+    template<
+             typename OPTYPE,
+             typename KERNEL,
+             typename T
+            >
+    class packet_binary_expression
+    {
+        private:
+            //! left operand type
+            typedef typename std::remove_const<typename std::remove_reference<
+                decltype(std::declval<OPTYPE>().op1())>::type>::type op1_type;
+            //! right operand type
+            typedef typename std::remove_const<typename std::remove_reference<
+                decltype(std::declval<OPTYPE>().op2())>::type>::type op2_type;
+            //! evaluator of the left operand
+            packet_operand<op1_type,T> _op1;
+            //! evaluator of the right operand
+            packet_operand<op2_type,T> _op2;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+
+            //! true if the operation can be evaluated with packets
+            static const bool value = 
+                std::is_same<typename OPTYPE::value_type,T>::value &&
+                KERNEL::template enabled<T>::value &&
+                packet_operand<op1_type,T>::value &&
+                packet_operand<op2_type,T>::value;
+
+            //! number of leaves with data in memory
+            static const size_t leaves = packet_operand<op1_type,T>::leaves+
+                                         packet_operand<op2_type,T>::leaves;
+
+            //-----------------------------------------------------------------
+            //! check both operands
+            static bool is_valid(const OPTYPE &e,const T *dest,size_t n)
+            {
+                return packet_operand<op1_type,T>::is_valid(
+                           e.op1(),e.op1_broadcast(),dest,n) &&
+                       packet_operand<op2_type,T>::is_valid(
+                           e.op2(),e.op2_broadcast(),dest,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit packet_binary_expression(const OPTYPE &e):
+                _op1(e.op1(),e.op1_broadcast()),
+                _op2(e.op2(),e.op2_broadcast())
+            {}
+
+            //-----------------------------------------------------------------
+            //! position both operands
+            size_t seek(size_t i)
+            {
+                return std::min(_op1.seek(i),_op2.seek(i));
+            }
+
+            //-----------------------------------------------------------------
+            //! evaluate the packet starting at element i
+            typename packet_type::type load(size_t i) const
+            {
+                return KERNEL::template packet<packet_type>(_op1.load(i),
+                                                            _op2.load(i));
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for additions
+    template<typename OP1T,typename OP2T,typename T>
+    class packet_expression<add_op<OP1T,OP2T>,T>:
+        public packet_binary_expression<add_op<OP1T,OP2T>,simd_add_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit packet_expression(const add_op<OP1T,OP2T> &e):
+                packet_binary_expression<add_op<OP1T,OP2T>,simd_add_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for subtractions
+    template<typename OP1T,typename OP2T,typename T>
+    class packet_expression<sub_op<OP1T,OP2T>,T>:
+        public packet_binary_expression<sub_op<OP1T,OP2T>,simd_sub_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit packet_expression(const sub_op<OP1T,OP2T> &e):
+                packet_binary_expression<sub_op<OP1T,OP2T>,simd_sub_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for multiplications
+    template<typename OP1T,typename OP2T,typename T>
+    class packet_expression<mult_op<OP1T,OP2T>,T>:
+        public packet_binary_expression<mult_op<OP1T,OP2T>,simd_mult_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit packet_expression(const mult_op<OP1T,OP2T> &e):
+                packet_binary_expression<mult_op<OP1T,OP2T>,simd_mult_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for divisions
+    template<typename OP1T,typename OP2T,typename T>
+    class packet_expression<div_op<OP1T,OP2T>,T>:
+        public packet_binary_expression<div_op<OP1T,OP2T>,packet_div_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit packet_expression(const div_op<OP1T,OP2T> &e):
+                packet_binary_expression<div_op<OP1T,OP2T>,packet_div_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for arrays
+    //!
+    //! An mdarray is evaluated via its storage. For the arrays created by 
+    //! the operators in array_arithmetic.hpp this is the expression template,
+    //! for all other arrays it is the container holding the data.
+    //!
+    template<
+             typename STORAGE,
+             typename IMAP,
+             typename IPA,
+             typename T
+            >
+    class packet_expression<mdarray<STORAGE,IMAP,IPA>,T>:
+        public packet_expression<STORAGE,T>
+    {
+        private:
+            //! base class
+            typedef packet_expression<STORAGE,T> base_type;
+            //! array type
+            typedef mdarray<STORAGE,IMAP,IPA> array_type;
+        public:
+            //-----------------------------------------------------------------
+            //! check the storage
+            static bool is_valid(const array_type &e,const T *dest,size_t n)
+            {
+                return base_type::is_valid(e.storage(),dest,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit packet_expression(const array_type &e):
+                base_type(e.storage())
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate a range of an expression with packets
+    //!
+    //! Writes the elements [begin,end) of the expression to ptr[0], ..., 
+    //! ptr[end-begin-1]. The elements are processed in blocks whose 
+    //! working set fits into the L1 cache. Within a block the expression 
+    //! is evaluated run by run (see packet_operand::seek()).
+    //!
+    //! The caller has to ensure that the expression can be evaluated with 
+    //! packets (see packet_expression::is_valid()). 
+    //!
+    //! \tparam T element type of the destination
+    //! \tparam ETYPE expression type
+    //! \param ptr pointer to the destination of element begin
+    //! \param expr reference to the expression
+    //! \param begin first element to evaluate
+    //! \param end one after the last element to evaluate
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    void packet_evaluate_range(T *ptr,const ETYPE &expr,size_t begin,
+                               size_t end)
+    {
+        typedef packet_expression<ETYPE,T> expression_type;
+        typedef typename expression_type::packet_type packet_type;
+
+        const size_t psize = packet_type::size;
+        const size_t bsize = 
+            ((l1_cache_size/(expression_type::leaves+1)/sizeof(T))/
+             psize+1)*psize;
+
+        expression_type e(expr);
+        for(size_t b=begin;b<end;b+=bsize)
+        {
+            size_t block_end = b+bsize<end ? b+bsize : end;
+            size_t i = b;
+            while(i<block_end)
+            {
+                //runs of broadcast operands 
+                size_t run = e.seek(i);
+                size_t run_end = run<block_end-i ? i+run : block_end;
+
+                for(;i+psize<=run_end;i+=psize) 
+                    packet_type::store(ptr+(i-begin),e.load(i));
+
+                for(;i<run_end;++i) ptr[i-begin] = expr[i];
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluation not possible
+    //!
+    //! Overload of packet_evaluate for types which cannot be evaluated with 
+    //! packets at all.
+    //!
+    //! \return always false
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    bool packet_evaluate(DTYPE &,const ETYPE &,size_t,size_t,
+                         std::false_type)
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluation 
+    //!
+    //! Overload of packet_evaluate for types which could be evaluated with 
+    //! packets. The runtime checks are done here.
+    //!
+    //! \return true if the expression was evaluated
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    bool packet_evaluate(DTYPE &dest,const ETYPE &expr,size_t begin,
+                         size_t end,std::true_type)
+    {
+        typedef typename DTYPE::value_type value_type;
+        typedef packet_expression<ETYPE,value_type> expression_type;
+
+        size_t n = dest.size();
+        if(!contiguous_data<DTYPE>::is_contiguous(dest) || expr.size()!=n) 
+            return false;
+
+        value_type *ptr = dest.data();
+        if(!expression_type::is_valid(expr,ptr,n)) return false;
+
+        packet_evaluate_range(ptr+begin,expr,begin,end);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression with SIMD packets
+    //!
+    //! Evaluates the elements [begin,end) of an expression and writes the 
+    //! result directly to the memory of the destination. The elements are 
+    //! processed in blocks whose working set (all leaves plus the 
+    //! destination) fits into the L1 cache.
+    //!
+    //! The function returns false and does nothing if the expression cannot 
+    //! be evaluated with packets. This is the case if 
+    //! \li no SIMD instructions are available for the element type
+    //! \li the destination or a leaf is not contiguous 
+    //! \li a leaf has a different element type than the destination (for 
+    //!     scalars see packet_expression<scalar<S>,T>)
+    //! \li the value type of an intermediate operation differs from the 
+    //!     element type of the destination
+    //! \li a leaf partially overlaps with the destination
+    //! \li an operation is not available in SIMD (integer and complex 
+    //!     division)
+    //! \li a broadcast operand is an expression or overlaps with the 
+    //!     destination
+    //!
+    //! Broadcast operands (see broadcast_map) are evaluated run by run. 
+    //! Within a run the packets are loaded from contiguous memory or a 
+    //! single element is broadcast to all elements of a packet. 
+    //!
+    //! \tparam DTYPE destination array type
+    //! \tparam ETYPE expression type
+    //! \param dest reference to the destination
+    //! \param expr reference to the expression
+    //! \param begin first element to evaluate
+    //! \param end one after the last element to evaluate
+    //! \return true if the expression was evaluated
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    bool packet_evaluate(DTYPE &dest,const ETYPE &expr,size_t begin,
+                         size_t end)
+    {
+        typedef typename DTYPE::value_type value_type;
+        typedef packet_expression<ETYPE,value_type> expression_type;
+        typedef typename expression_type::packet_type packet_type;
+
+        return packet_evaluate(dest,expr,begin,end,
+                std::integral_constant<bool,
+                        packet_type::is_vectorized &&
+                        contiguous_data<DTYPE>::value &&
+                        expression_type::value>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief conversion not possible
+    //!
+    //! Overload of convert_evaluate for types without a conversion kernel.
+    //!
+    //! \return always false
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    bool convert_evaluate(DTYPE &,const ETYPE &,size_t,size_t,
+                          std::false_type)
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief vectorized conversion
+    //!
+    //! Overload of convert_evaluate for arrays with a conversion kernel. 
+    //! The runtime checks are done here.
+    //!
+    //! \return true if the elements were converted
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    bool convert_evaluate(DTYPE &dest,const ETYPE &expr,size_t begin,
+                          size_t end,std::true_type)
+    {
+        if(!contiguous_data<DTYPE>::is_contiguous(dest) ||
+           !contiguous_data<ETYPE>::is_contiguous(expr) ||
+           expr.size()!=dest.size()) 
+            return false;
+
+        simd_convert(expr.data()+begin,end-begin,dest.data()+begin);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy an array with a different element type
+    //!
+    //! If the source is an array (or view) whose element type can be 
+    //! converted to the element type of the destination with a 
+    //! simd_convert_kernel and both provide their data contiguously in 
+    //! memory the elements [begin,end) are converted with simd_convert().
+    //! This is used for the conversion between float32 and the 16Bit 
+    //! floating point types.
+    //!
+    //! \tparam DTYPE destination array type
+    //! \tparam ETYPE source array type
+    //! \param dest reference to the destination
+    //! \param expr reference to the source
+    //! \param begin first element to convert
+    //! \param end one after the last element to convert
+    //! \return true if the elements were converted, false otherwise
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    bool convert_evaluate(DTYPE &dest,const ETYPE &expr,size_t begin,
+                          size_t end)
+    {
+        typedef simd_convert_kernel<typename DTYPE::value_type,
+                                    typename ETYPE::value_type> kernel_type;
+
+        return convert_evaluate(dest,expr,begin,end,
+                std::integral_constant<bool,
+                        kernel_type::is_vectorized &&
+                        contiguous_data<DTYPE>::value &&
+                        contiguous_data<ETYPE>::value>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression with the same storage order
+    //!
+    //! The linear indices of the destination and the expression refer to 
+    //! the same elements. If possible the expression is evaluated with 
+    //! packet_evaluate(). Arrays of a different element type are converted
+    //! with convert_evaluate().
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    void evaluate_expression(DTYPE &dest,const ETYPE &expr,size_t begin,
+                             size_t end,std::true_type)
+    {
+        if(packet_evaluate(dest,expr,begin,end) ||
+           convert_evaluate(dest,expr,begin,end)) return;
+
+        for(size_t i=begin;i<end;++i) dest[i] = expr[i];
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression with a different storage order
+    //!
+    //! If the destination and the expression use different storage orders 
+    //! (for instance a C-ordered destination and a Fortran-ordered 
+    //! expression) the linear indices do not refer to the same elements. 
+    //! The multidimensional index of every destination element is computed
+    //! and used to access the expression. 
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    void evaluate_expression(DTYPE &dest,const ETYPE &expr,size_t begin,
+                             size_t end,std::false_type)
+    {
+        typedef std::vector<size_t> index_type;
+
+        const auto &map = dest.map();
+        for(size_t i=begin;i<end;++i) 
+            dest[i] = expr(map.template index<index_type>(i));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression
+    //!
+    //! Assigns the elements [begin,end) of an expression (or any other 
+    //! array) to the destination. If possible the expression is evaluated 
+    //! with packet_evaluate(). Otherwise the expression is evaluated element
+    //! by element.
+    /*!
+    \code
+    auto r = dynamic_array<float64>::create(shape);
+    //evaluates the entire expression in a single pass over the data
+    evaluate_expression(r,a*b+c/d-3.,0,r.size());
+    \endcode
+    !*/
+    //!
+    //! \tparam DTYPE destination array type
+    //! \tparam ETYPE expression type
+    //! \param dest reference to the destination
+    //! \param expr reference to the expression
+    //! \param begin first element to evaluate
+    //! \param end one after the last element to evaluate
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    void evaluate_expression(DTYPE &dest,const ETYPE &expr,size_t begin,
+                             size_t end)
+    {
+        evaluate_expression(dest,expr,begin,end,
+                            is_same_order<DTYPE,ETYPE>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression
+    //!
+    //! Assigns all elements of an expression to the destination. 
+    //!
+    //! \tparam DTYPE destination array type
+    //! \tparam ETYPE expression type
+    //! \param dest reference to the destination
+    //! \param expr reference to the expression
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    void evaluate_expression(DTYPE &dest,const ETYPE &expr)
+    {
+        evaluate_expression(dest,expr,0,expr.size());
+    }
+
+//end of namespace
+}
+}
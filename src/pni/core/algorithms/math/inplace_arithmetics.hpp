@@ -30,6 +30,7 @@
 #include <pni/core/error/exception_utils.hpp>
 #include <pni/core/types.hpp>
 #include <pni/core/utilities/sfinae_macros.hpp>
+#include <pni/core/algorithms/math/broadcast.hpp>
 
 namespace pni{
 namespace core{
@@ -106,7 +107,10 @@ namespace core{
         inplace_arithmetics::add(a,b);
         \endcode
         !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
         //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
         //! \tparam LTYPE l.h.s. type 
         //! \tparam RTYPE r.h.s. type
         //! \param a reference to an array of type LTYPE 
@@ -123,7 +127,14 @@ namespace core{
         {
             CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
             size_t n = a.size();
-            for(size_t i=0;i<n;++i) a[i] += b[i];
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(map.is_identity())
+                for(size_t i=0;i<n;++i) a[i] += b[i];
+            else
+                broadcast_apply(a,b,map,0,n,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x += y; });
         }
 
         //==================inplace subtraction===============================
@@ -172,6 +183,10 @@ namespace core{
         inplace_arithmetics::sub(a,b);
         \endcode
         !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
         //! \tparam LTYPE l.h.s. array type
         //! \tparam RTYPE r.h.s. array type
         //! \param a reference to the l.h.s.
@@ -188,7 +203,14 @@ namespace core{
         {
             CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
             size_t n = a.size();
-            for(size_t i=0;i<n;++i) a[i] -= b[i];
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(map.is_identity())
+                for(size_t i=0;i<n;++i) a[i] -= b[i];
+            else
+                broadcast_apply(a,b,map,0,n,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x -= y; });
         }
 
 
@@ -238,6 +260,10 @@ namespace core{
         inplace_arithemtics::mult(a,b);
         \endcode
         !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
         //! \tparam LTYPE l.h.s. array type
         //! \tparam RTYPE r.h.s. array type
         //! \param a reference to the l.h.s.
@@ -253,8 +279,15 @@ namespace core{
         static void mult(LTYPE &a,const RTYPE &b)
         {
             CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
-            size_t n=a.size();
-            for(size_t i=0;i<n;++i) a[i] *= b[i];
+            size_t n = a.size();
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(map.is_identity())
+                for(size_t i=0;i<n;++i) a[i] *= b[i];
+            else
+                broadcast_apply(a,b,map,0,n,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x *= y; });
         }
         
         //=====================inplace division============================
@@ -303,6 +336,10 @@ namespace core{
         inplace_arithemtics::div(a,b);
         \endcode
         !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
         //! \tparam LTYPE l.h.s. array type
         //! \tparam RTYPE r.h.s. array type
         //! \param a reference to the l.h.s.
@@ -319,7 +356,14 @@ namespace core{
         {
             CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
             size_t n = a.size();
-            for(size_t i=0;i<n;++i) a[i] /= b[i];
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(map.is_identity())
+                for(size_t i=0;i<n;++i) a[i] /= b[i];
+            else
+                broadcast_apply(a,b,map,0,n,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x /= y; });
         }
     };
 
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <pni/core/algorithms/math/op_traits.hpp>
+#include <pni/core/algorithms/math/broadcast.hpp>
 #include <pni/core/utilities/container_iterator.hpp>
 
 namespace pni{
@@ -50,6 +51,12 @@ namespace core{
             typename op_trait<OP1T>::ref_type _op1;
             //! right operand
             typename op_trait<OP2T>::ref_type _op2;
+            //! broadcast map of the left operand
+            broadcast_map _map1;
+            //! broadcast map of the right operand
+            broadcast_map _map2;
+            //! number of elements of the result
+            size_t _size;
         public:
             //--------------------public types---------------------------------
             //! value type of the multiplication
@@ -80,15 +87,50 @@ namespace core{
             //! \brief constructor
             //!
             //! Set up the operator class.
+            //! Operands with different shapes are broadcast
+            //! (see broadcast_shape()).
+            //!
+            //! \throws shape_mismatch_error if the operands cannot be broadcast
             //! \param o1 left operand
             //! \param o2 right operand
             //!
             mult_op(const OP1T &o1,const OP2T &o2):
                 _op1(o1),
-                _op2(o2)
+                _op2(o2),
+                _map1(),
+                _map2(),
+                _size(make_broadcast(o1,o2,_map1,_map2))
             {}
 
             //====================public methods===============================
+            //!
+            //! \brief get left operand
+            //!
+            //! \return reference to the left operand
+            //!
+            const OP1T &op1() const { return _op1; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get right operand
+            //!
+            //! \return reference to the right operand
+            //!
+            const OP2T &op2() const { return _op2; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get broadcast map of the left operand
+            //!
+            const broadcast_map &op1_broadcast() const { return _map1; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get broadcast map of the right operand
+            //!
+            const broadcast_map &op2_broadcast() const { return _map2; }
+
+            //-----------------------------------------------------------------
             //! 
             //! \brief get value at index i
             //!
@@ -98,7 +140,7 @@ namespace core{
             //!
             value_type operator[](size_t i) const
             {
-                return this->_op1[i]*this->_op2[i];
+                return this->_op1[_map1(i)]*this->_op2[_map2(i)];
             }
 
             //-----------------------------------------------------------------
@@ -123,12 +165,12 @@ namespace core{
             //! 
             //! \brief return size of the operator
             //!
-            //! This is the maximum size of the two operands.
+            //! This is the number of elements of the result.
             //! \return size of the operation
             //!
             size_t size() const
             {
-                return _op1.size() > _op2.size() ? _op1.size() : _op2.size();
+                return _size;
             }
 
 
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <pni/core/arrays/scalar.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
 
 namespace pni{
 namespace core{
@@ -71,7 +72,8 @@ namespace core{
     //! This trait determines the common index map and inplace arithmetic 
     //! implementation types to use for an expression template. 
     //! This is the default template where we assume that both operands are 
-    //! array types.
+    //! array types. As the operands are evaluated with their linear index 
+    //! both must use the same storage order. 
     //! 
     //! \tparam OP1 LHS operand type
     //! \tparam OP2 RHS operand type
@@ -82,6 +84,10 @@ namespace core{
             > 
     struct array_trait
     {
+        static_assert(is_same_order<OP1,OPT2>::value,
+                      "Operands of an expression must have the same storage "
+                      "order!");
+
         //! index map type
         typedef typename OP1::map_type map_type;
         //! inplace arithmetic type
@@ -0,0 +1,294 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <pni/core/types.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief cache line size
+    //!
+    //! Size of a cache line in bytes assumed by the parallel algorithms.
+    //!
+    static const size_t cache_line_size = 64;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compute chunk boundaries for parallel writes
+    //!
+    //! Splits the linear index range of an array or view into nchunks 
+    //! partitions of roughly equal size which can be written concurrently.
+    //! For contiguous data the boundaries are placed on cache line 
+    //! boundaries. For non-contiguous views the boundaries are placed 
+    //! between rows (the contiguous segments along the last dimension of 
+    //! the view) such that the last element of a chunk and the first 
+    //! element of the next chunk reside in different cache lines. Thus two 
+    //! threads never write to the same cache line.
+    //!
+    //! Chunks may be empty. If no such boundary can be found in the vicinity
+    //! of the nominal position (very short rows) the next row boundary is 
+    //! used.
+    //!
+    //! \tparam ATYPE array or view type
+    //! \param a reference to the array
+    //! \param nchunks number of chunks
+    //! \return vector with nchunks+1 boundaries, the first is 0 the last 
+    //!         is a.size()
+    //!
+    template<typename ATYPE>
+    std::vector<size_t> chunk_boundaries(ATYPE &a,size_t nchunks)
+    {
+        typedef contiguous_data<ATYPE> contiguous_type;
+        size_t n = a.size();
+        std::vector<size_t> bounds(nchunks+1,n);
+        bounds[0] = 0;
+
+        //the granularity of a chunk
+        size_t unit = 1;
+        if(!contiguous_type::is_contiguous(a) && a.rank())
+        {
+            auto s = a.template shape<shape_t>();
+            unit = s.back() ? s.back() : 1;
+        }
+
+        auto line = [&a](size_t i)
+        {
+            return reinterpret_cast<std::uintptr_t>(std::addressof(a[i]))/
+                   cache_line_size;
+        };
+
+        for(size_t c=1;c<nchunks;++c)
+        {
+            size_t b = (n*c/nchunks/unit)*unit;
+            if(b<bounds[c-1]) b = bounds[c-1];
+
+            for(size_t step=0;
+                step<cache_line_size && b>0 && b<n && line(b-1)==line(b);
+                ++step) 
+                b += unit;
+
+            bounds[c] = b<n ? b : n;
+        }
+
+        return bounds;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief execute a function in parallel on chunks of an array
+    //!
+    //! Calls func(begin,end) for linear index ranges [begin,end) covering 
+    //! the entire array. If the array has at least parallel_threshold() 
+    //! elements the chunks are computed with chunk_boundaries() and 
+    //! processed by the threads of the default_thread_pool(). Otherwise 
+    //! func is called once for the entire array by the calling thread.
+    /*!
+    \code
+    auto view = data(slice(0,1000),10,slice(0,2048));
+    parallel_for_chunks(view,[&view](size_t begin,size_t end)
+    {
+        for(size_t i=begin;i<end;++i) view[i] = 0;
+    });
+    \endcode
+    !*/
+    //!
+    //! \tparam ATYPE array or view type
+    //! \tparam FUNC function type
+    //! \param a reference to the array on which to work
+    //! \param func function to call for each chunk
+    //!
+    template<
+             typename ATYPE,
+             typename FUNC
+            >
+    void parallel_for_chunks(ATYPE &a,FUNC func)
+    {
+        size_t n = a.size();
+        thread_pool &pool = default_thread_pool();
+
+        if(n<parallel_threshold() || pool.size()<2 || n<2)
+        {
+            func(size_t(0),n);
+            return;
+        }
+
+        auto bounds = chunk_boundaries(a,pool.size());
+        pool.run(pool.size(),[&bounds,&func](size_t c)
+        {
+            if(bounds[c]<bounds[c+1]) func(bounds[c],bounds[c+1]);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief parallel chunks of an array
+    //!
+    //! Returns the chunk boundaries used to process an array with the 
+    //! default_thread_pool(). Arrays with less than parallel_threshold() 
+    //! elements form a single chunk.
+    //!
+    //! \tparam ATYPE array or view type
+    //! \param a reference to the array
+    //! \return chunk boundaries (see chunk_boundaries())
+    //!
+    template<typename ATYPE> std::vector<size_t> parallel_chunks(ATYPE &a)
+    {
+        size_t n = a.size();
+        thread_pool &pool = default_thread_pool();
+
+        if(n<parallel_threshold() || pool.size()<2 || n<2)
+            return std::vector<size_t>{0,n};
+
+        return chunk_boundaries(a,pool.size());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief parallel chunks of a read only array
+    //!
+    //! Elements are only read from a const array. The chunks thus do not 
+    //! have to be aligned to cache lines and are of equal size.
+    //!
+    //! \tparam ATYPE array or view type
+    //! \param a reference to the array
+    //! \return chunk boundaries 
+    //!
+    template<typename ATYPE> 
+    std::vector<size_t> parallel_chunks(const ATYPE &a)
+    {
+        size_t n = a.size();
+        thread_pool &pool = default_thread_pool();
+
+        if(n<parallel_threshold() || pool.size()<2 || n<2)
+            return std::vector<size_t>{0,n};
+
+        size_t nchunks = pool.size();
+        std::vector<size_t> bounds(nchunks+1);
+        for(size_t c=0;c<=nchunks;++c) bounds[c] = n*c/nchunks;
+        return bounds;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief execute a function for each chunk
+    //!
+    //! Calls func(c,begin,end) for each chunk c with its linear index range
+    //! [begin,end) as obtained from parallel_chunks(). Unlike 
+    //! parallel_for_chunks() the function receives the index of the chunk
+    //! which allows algorithms to run in several passes with per chunk 
+    //! results (for instance the number of elements a chunk produces).
+    //! Empty chunks are skipped.
+    //!
+    //! \tparam FUNC function type
+    //! \param bounds chunk boundaries
+    //! \param func function to call for each chunk
+    //!
+    template<typename FUNC>
+    void parallel_for_each_chunk(const std::vector<size_t> &bounds,FUNC func)
+    {
+        size_t nchunks = bounds.size()-1;
+
+        if(nchunks==1)
+        {
+            if(bounds[0]<bounds[1]) func(size_t(0),bounds[0],bounds[1]);
+            return;
+        }
+
+        default_thread_pool().run(nchunks,[&bounds,&func](size_t c)
+        {
+            if(bounds[c]<bounds[c+1]) func(c,bounds[c],bounds[c+1]);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief parallel reduction over an array
+    //!
+    //! Computes func(begin,end) for each chunk of the array (see 
+    //! parallel_chunks()) and combines the partial results with op. 
+    /*!
+    \code
+    auto sum = parallel_reduce(a,0.0,
+                    [&a](size_t b,size_t e) 
+                    { 
+                        float64 s = 0; 
+                        for(size_t i=b;i<e;++i) s += a[i]; 
+                        return s; 
+                    },
+                    std::plus<float64>());
+    \endcode
+    !*/
+    //! 
+    //! The partial results are combined in the order of the chunks. op must
+    //! be associative and init its neutral element.
+    //!
+    //! \tparam ATYPE array or view type
+    //! \tparam RTYPE result type
+    //! \tparam FUNC chunk function type
+    //! \tparam OP reduction operation type
+    //! \param a reference to the array
+    //! \param init neutral element of the reduction
+    //! \param func function computing the result for a chunk
+    //! \param op binary operation combining two results
+    //! \return reduced result
+    //!
+    template<
+             typename ATYPE,
+             typename RTYPE,
+             typename FUNC,
+             typename OP
+            >
+    RTYPE parallel_reduce(ATYPE &a,RTYPE init,FUNC func,OP op)
+    {
+        auto bounds = parallel_chunks(a);
+        std::vector<RTYPE> partial(bounds.size()-1,init);
+
+        parallel_for_each_chunk(bounds,
+                [&partial,&func](size_t c,size_t begin,size_t end)
+                {
+                    partial[c] = func(begin,end);
+                });
+
+        RTYPE result = init;
+        for(const auto &p: partial) result = op(result,p);
+        return result;
+    }
+
+//end of namespace
+}
+}
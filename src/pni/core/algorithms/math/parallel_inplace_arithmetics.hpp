@@ -0,0 +1,413 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <pni/core/types.hpp>
+#include <pni/core/utilities/sfinae_macros.hpp>
+#include <pni/core/algorithms/math/inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+
+namespace pni{
+namespace core{
+
+    //! 
+    //! \ingroup mdim_array_internal_classes
+    //! \brief multi threaded inplace arithmetics
+    //!
+    //! Provides the same interface as inplace_arithmetics but distributes 
+    //! the work over the threads of the default_thread_pool() once the 
+    //! l.h.s. has at least parallel_threshold() elements. The l.h.s. is 
+    //! partitioned with chunk_boundaries() - views on the l.h.s. are split 
+    //! between contiguous rows and no two threads write to the same cache 
+    //! line. 
+    /*!
+    \code
+    typedef mdarray<std::vector<float64>,dynamic_cindex_map,
+                    parallel_inplace_arithmetics> array_type;
+
+    default_thread_pool().resize(16);
+    set_parallel_threshold(1000000);
+
+    auto a = array_type::create(shape_t{1000,1000,100});
+    a += 10.;  //computed with 16 threads
+    \endcode
+    !*/
+    //! 
+    //! The r.h.s. must not be modified by any other thread during the 
+    //! operation and must not overlap with the l.h.s.
+    //!
+    struct parallel_inplace_arithmetics
+    {
+                 
+        //==================inplace addition===================================
+        //!
+        //! \brief add scalar to array
+        //!
+        //! Element wise inplace addition of a scalar to an array
+        /*!
+        \code
+        array_type array(...);
+        typename array_type::value_type scalar(5);
+         
+        //performe something like array += scalar
+        parallel_inplace_arithmetics::add(array,scalar);
+        \endcode
+        !*/
+        //! 
+        //! \tparam LTYPE array type
+        //! \param a reference to an instance of LTYPE
+        //! \param b scalar value of type LTYPE::value_type
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t<
+                           is_pod<T>,is_cmplx<T>
+                           >>
+                > 
+        static void add(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+
+            parallel_for_chunks(a,[&a,b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] += b;
+            });
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief add array to array
+        //!
+        //!  Element wise inplace addition of two arrays
+        /*!
+        \code
+        array_type1 a = ...;
+        array_type2 b = ...;
+        
+        //computes a+=b;
+        parallel_inplace_arithmetics::add(a,b);
+        \endcode
+        !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
+        //! \tparam LTYPE l.h.s. type 
+        //! \tparam RTYPE r.h.s. type
+        //! \param a reference to an array of type LTYPE 
+        //! \param b reference to an array of type RTYPE
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void add(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(!map.is_identity())
+            {
+                parallel_for_chunks(a,[&a,&b,&map](size_t begin,size_t end)
+                {
+                    broadcast_apply(a,b,map,begin,end,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x += y; });
+                });
+                return;
+            }
+
+            parallel_for_chunks(a,[&a,&b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] += b[i];
+            });
+        }
+
+        //==================inplace subtraction===============================
+        //!
+        //! \brief subtract scalar from array
+        //!
+        //! Element wise subtraction of a scalar from an array
+        /*!
+        \code
+        array_type a = ...;
+        typename array_type::value_type s(1.);
+        
+        //compuate a+=scalar;
+        parallel_inplace_arithmetics::sub(a,s);
+        \endcode
+        !*/
+        //! \tparam LTYPE l.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b scalar value on the r.h.s.
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t< 
+                            is_pod<T>,is_cmplx<T> 
+                            >>
+                >
+        static void sub(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+            parallel_for_chunks(a,[&a,b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] -= b;
+            });
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief subtract array from array
+        //!
+        //! Element wise inplace subtraction of a scalar from an array.
+        /*!
+        \code
+        array_type1 a = ...;
+        array_type2 b = ...;
+        
+        //compute a-=b;
+        parallel_inplace_arithmetics::sub(a,b);
+        \endcode
+        !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam RTYPE r.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b reference to the r.h.s.
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void sub(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(!map.is_identity())
+            {
+                parallel_for_chunks(a,[&a,&b,&map](size_t begin,size_t end)
+                {
+                    broadcast_apply(a,b,map,begin,end,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x -= y; });
+                });
+                return;
+            }
+
+            parallel_for_chunks(a,[&a,&b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] -= b[i];
+            });
+        }
+
+
+        //=====================inplace multiplication======================
+        //!
+        //! \brief multiply array with scalar
+        //!
+        //! Element wise inplace multiplication of an array with a scalar
+        /*!
+        \code
+        array_type1 a = ...;
+        typename array_type1::value_type s(5);
+        
+        //compute a *= s;
+        parallel_inplace_arithmetics::mult(array,scalar);
+        \endcode
+        !*/
+        //! \tparam LTYPE l.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b scalar r.h.s. value
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t< 
+                            is_pod<T>,is_cmplx<T> 
+                            >>
+                >
+        static void mult(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+            parallel_for_chunks(a,[&a,b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] *= b;
+            });
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief multiply array by array
+        //!
+        //! Element wise inplace multiplication of two arrays
+        /*!
+        \code
+        array_type1 a = ...;
+        array_type2 b = ...;
+        
+        //compuate a *= b;
+        parallel_inplace_arithmetics::mult(a,b);
+        \endcode
+        !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam RTYPE r.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b reference to the r.h.s.
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void mult(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(!map.is_identity())
+            {
+                parallel_for_chunks(a,[&a,&b,&map](size_t begin,size_t end)
+                {
+                    broadcast_apply(a,b,map,begin,end,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x *= y; });
+                });
+                return;
+            }
+
+            parallel_for_chunks(a,[&a,&b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] *= b[i];
+            });
+        }
+        
+        //=====================inplace division============================
+        //!
+        //! \brief divide array with scalar
+        //!
+        //! Element wise inplace division of an array with a scalar
+        /*!
+        \code
+        array_type a = ...;
+        typename array_type::value_type s(4.);
+        
+        //compute a /= s;
+        parallel_inplace_arithmetics::div(a,s);
+        \endcode
+        !*/
+        //! \tparam LTYPE l.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b scalar r.h.s. value
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t< 
+                            is_pod<T>,is_cmplx<T> 
+                            >>
+                >
+        static void div(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+            parallel_for_chunks(a,[&a,b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] /= b;
+            });
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief divide array by array
+        //!
+        //! Element wise inplace division of two arrays. 
+        /*!
+        \code
+        array_type1 a = ...;
+        array_type2 b = ...;
+        
+        //compuate a /= b;
+        parallel_inplace_arithmetics::div(a,b);
+        \endcode
+        !*/
+        //! If the shape of b differs from the shape of a, b is broadcast to 
+        //! the shape of a (see broadcast_map).
+        //!
+        //! \throws shape_mismatch_error if b cannot be broadcast
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam RTYPE r.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b reference to the r.h.s.
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void div(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+            broadcast_map map = make_broadcast_map(b,
+                    a.template shape<shape_t>());
+            if(!map.is_identity())
+            {
+                parallel_for_chunks(a,[&a,&b,&map](size_t begin,size_t end)
+                {
+                    broadcast_apply(a,b,map,begin,end,
+                        [](typename LTYPE::value_type &x,
+                           const typename RTYPE::value_type &y) { x /= y; });
+                });
+                return;
+            }
+
+            parallel_for_chunks(a,[&a,&b](size_t begin,size_t end)
+            {
+                for(size_t i=begin;i<end;++i) a[i] /= b[i];
+            });
+        }
+    };
+
+//end namespace
+}
+}
@@ -0,0 +1,1030 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
+#include <pni/core/algorithms/math/simd_mask.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief number of bits per mask word
+    //!
+    static const size_t bitmask_word_bits = 64;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief number of set bits
+    //!
+    //! \param w mask word
+    //! \return number of bits set in w
+    //!
+    inline size_t bit_count(uint64 w)
+    {
+#if defined(PNI_SIMD_AVX512)
+        return _mm_popcnt_u64(w);
+#elif defined(__GNUC__)
+        return __builtin_popcountll(w);
+#else
+        w = w - ((w>>1) & 0x5555555555555555ULL);
+        w = (w & 0x3333333333333333ULL) + ((w>>2) & 0x3333333333333333ULL);
+        w = (w + (w>>4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return (w*0x0101010101010101ULL)>>56;
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief index of the lowest set bit
+    //!
+    //! \param w mask word (must not be zero)
+    //! \return index of the lowest bit set in w
+    //!
+    inline size_t lowest_bit(uint64 w)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctzll(w);
+#else
+        size_t b = 0;
+        for(;!(w&1);w>>=1) ++b;
+        return b;
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief number of set bits in a word array
+    //!
+    //! \param words pointer to the first word
+    //! \param n number of words
+    //! \return number of bits set
+    //!
+    inline size_t simd_bit_count(const uint64 *words,size_t n)
+    {
+        size_t k0 = 0,k1 = 0;
+        size_t i = 0;
+        //two independent sums to hide the latency of popcnt
+        for(;i+2<=n;i+=2)
+        {
+            k0 += bit_count(words[i]);
+            k1 += bit_count(words[i+1]);
+        }
+        if(i<n) k0 += bit_count(words[i]);
+        return k0+k1;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief comparison predicate for SIMD kernels
+    //!
+    //! Maps a comparison functor to the predicates of the SIMD compare 
+    //! instructions (AVX-512, AVX2 or SSE2). This default template is used 
+    //! for all functors without such a mapping. Only the standard comparison functors with argument 
+    //! type T are mapped in order to retain the semantics of the 
+    //! comparison.
+    //!
+    //! \tparam T element type
+    //! \tparam COMP comparison functor
+    //!
+    template<
+             typename T,
+             typename COMP
+            >
+    struct simd_compare_predicate
+    {
+        //! no SIMD predicate available
+        static const bool value = false;
+    };
+
+#ifdef PNI_SIMD_AVX512
+    //! \cond no_doc
+    template<typename T> struct simd_compare_predicate<T,std::less<T>>
+    {
+        static const bool value = true;
+        static const int float_predicate = _CMP_LT_OQ;
+        static const int int_predicate = _MM_CMPINT_LT;
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::less_equal<T>>
+    {
+        static const bool value = true;
+        static const int float_predicate = _CMP_LE_OQ;
+        static const int int_predicate = _MM_CMPINT_LE;
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::greater<T>>
+    {
+        static const bool value = true;
+        static const int float_predicate = _CMP_GT_OQ;
+        static const int int_predicate = _MM_CMPINT_NLE;
+    };
+
+    template<typename T> 
+    struct simd_compare_predicate<T,std::greater_equal<T>>
+    {
+        static const bool value = true;
+        static const int float_predicate = _CMP_GE_OQ;
+        static const int int_predicate = _MM_CMPINT_NLT;
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::equal_to<T>>
+    {
+        static const bool value = true;
+        static const int float_predicate = _CMP_EQ_OQ;
+        static const int int_predicate = _MM_CMPINT_EQ;
+    };
+
+    //NaN compares unequal to everything - thus the unordered predicate
+    template<typename T> 
+    struct simd_compare_predicate<T,std::not_equal_to<T>>
+    {
+        static const bool value = true;
+        static const int float_predicate = _CMP_NEQ_UQ;
+        static const int int_predicate = _MM_CMPINT_NE;
+    };
+
+    //
+    // compare 64 elements with a threshold - the result is one mask word
+    //
+    template<int P> inline uint64 simd_compare_word(const int8 *p,int8 t)
+    {
+        return _mm512_cmp_epi8_mask(_mm512_loadu_si512(p),
+                                    _mm512_set1_epi8(t),P);
+    }
+
+    template<int P> inline uint64 simd_compare_word(const uint8 *p,uint8 t)
+    {
+        return _mm512_cmp_epu8_mask(_mm512_loadu_si512(p),
+                                    _mm512_set1_epi8(t),P);
+    }
+
+    template<int P> inline uint64 simd_compare_word(const int16 *p,int16 t)
+    {
+        __m512i v = _mm512_set1_epi16(t);
+        uint64 w = 0;
+        for(size_t k=0;k<2;++k)
+            w |= uint64(_mm512_cmp_epi16_mask(_mm512_loadu_si512(p+32*k),
+                                              v,P))<<(32*k);
+        return w;
+    }
+
+    template<int P> inline uint64 simd_compare_word(const uint16 *p,uint16 t)
+    {
+        __m512i v = _mm512_set1_epi16(t);
+        uint64 w = 0;
+        for(size_t k=0;k<2;++k)
+            w |= uint64(_mm512_cmp_epu16_mask(_mm512_loadu_si512(p+32*k),
+                                              v,P))<<(32*k);
+        return w;
+    }
+
+    template<int P> inline uint64 simd_compare_word(const int32 *p,int32 t)
+    {
+        __m512i v = _mm512_set1_epi32(t);
+        uint64 w = 0;
+        for(size_t k=0;k<4;++k)
+            w |= uint64(_mm512_cmp_epi32_mask(_mm512_loadu_si512(p+16*k),
+                                              v,P))<<(16*k);
+        return w;
+    }
+
+    template<int P> inline uint64 simd_compare_word(const uint32 *p,uint32 t)
+    {
+        __m512i v = _mm512_set1_epi32(t);
+        uint64 w = 0;
+        for(size_t k=0;k<4;++k)
+            w |= uint64(_mm512_cmp_epu32_mask(_mm512_loadu_si512(p+16*k),
+                                              v,P))<<(16*k);
+        return w;
+    }
+
+    template<int P> inline uint64 simd_compare_word(const int64 *p,int64 t)
+    {
+        __m512i v = _mm512_set1_epi64(t);
+        uint64 w = 0;
+        for(size_t k=0;k<8;++k)
+            w |= uint64(_mm512_cmp_epi64_mask(_mm512_loadu_si512(p+8*k),
+                                              v,P))<<(8*k);
+        return w;
+    }
+
+    template<int P> inline uint64 simd_compare_word(const uint64 *p,uint64 t)
+    {
+        __m512i v = _mm512_set1_epi64(t);
+        uint64 w = 0;
+        for(size_t k=0;k<8;++k)
+            w |= uint64(_mm512_cmp_epu64_mask(_mm512_loadu_si512(p+8*k),
+                                              v,P))<<(8*k);
+        return w;
+    }
+
+    template<int P> 
+    inline uint64 simd_compare_word(const float32 *p,float32 t)
+    {
+        __m512 v = _mm512_set1_ps(t);
+        uint64 w = 0;
+        for(size_t k=0;k<4;++k)
+            w |= uint64(_mm512_cmp_ps_mask(_mm512_loadu_ps(p+16*k),
+                                           v,P))<<(16*k);
+        return w;
+    }
+
+    template<int P> 
+    inline uint64 simd_compare_word(const float64 *p,float64 t)
+    {
+        __m512d v = _mm512_set1_pd(t);
+        uint64 w = 0;
+        for(size_t k=0;k<8;++k)
+            w |= uint64(_mm512_cmp_pd_mask(_mm512_loadu_pd(p+8*k),
+                                           v,P))<<(8*k);
+        return w;
+    }
+    //! \endcond
+#elif defined(PNI_SIMD_ENABLED)
+    //! \cond no_doc
+    //
+    // SSE2 and AVX2 provide only equality and signed greater-than for 
+    // integers. All other predicates are derived from these two and unsigned 
+    // values are compared with their sign bit flipped. The comparison results
+    // are packed to bits with the movemask instructions.
+    //
+    enum class simd_compare_op { lt, le, gt, ge, eq, ne };
+
+#ifdef PNI_SIMD_AVX2
+    typedef __m256i simd_int_register;
+    static const size_t simd_register_size = 32;
+
+    inline __m256i simd_loadu(const void *p)
+    {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+
+    inline void simd_storeu(void *p,__m256i v)
+    {
+        _mm256_storeu_si256(static_cast<__m256i*>(p),v);
+    }
+
+    inline __m256i simd_xor(__m256i a,__m256i b) 
+    { 
+        return _mm256_xor_si256(a,b); 
+    }
+
+    inline __m256i simd_select(__m256i m,__m256i a,__m256i b)
+    {
+        return _mm256_or_si256(_mm256_and_si256(m,a),
+                               _mm256_andnot_si256(m,b));
+    }
+#else
+    typedef __m128i simd_int_register;
+    static const size_t simd_register_size = 16;
+
+    inline __m128i simd_loadu(const void *p)
+    {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    inline void simd_storeu(void *p,__m128i v)
+    {
+        _mm_storeu_si128(static_cast<__m128i*>(p),v);
+    }
+
+    inline __m128i simd_xor(__m128i a,__m128i b) { return _mm_xor_si128(a,b); }
+
+    inline __m128i simd_select(__m128i m,__m128i a,__m128i b)
+    {
+        return _mm_or_si128(_mm_and_si128(m,a),_mm_andnot_si128(m,b));
+    }
+#endif
+
+    //
+    // spreads 16 bits to 16 bytes - byte k is all ones if bit k is set
+    //
+    inline __m128i simd_byte_lanes(uint64 bits)
+    {
+        __m128i x = _mm_cvtsi32_si128(int(bits&0xffff));
+        x = _mm_unpacklo_epi8(x,x);
+        x = _mm_unpacklo_epi16(x,x);
+        x = _mm_unpacklo_epi32(x,x);
+        __m128i s = _mm_set1_epi64x(int64(0x8040201008040201ULL));
+        return _mm_cmpeq_epi8(_mm_and_si128(x,s),s);
+    }
+
+    //
+    // integer lane operations by lane size - movemask returns one bit per 
+    // lane and lanes() builds all-ones lanes from the bits of a mask word
+    //
+    template<size_t BYTES> struct simd_int_lanes;
+
+#ifdef PNI_SIMD_AVX2
+    template<> struct simd_int_lanes<1>
+    {
+        static const bool has_compare = true;
+        static __m256i set1(uint64 v) { return _mm256_set1_epi8(char(v)); }
+        static __m256i gt(__m256i a,__m256i b){return _mm256_cmpgt_epi8(a,b);}
+        static __m256i eq(__m256i a,__m256i b){return _mm256_cmpeq_epi8(a,b);}
+        static uint64 movemask(__m256i v) 
+        { 
+            return uint32(_mm256_movemask_epi8(v)); 
+        }
+        static __m256i lanes(uint64 bits)
+        {
+            return _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(simd_byte_lanes(bits)),
+                        simd_byte_lanes(bits>>16),1);
+        }
+    };
+
+    template<> struct simd_int_lanes<2>
+    {
+        static const bool has_compare = true;
+        static __m256i set1(uint64 v) { return _mm256_set1_epi16(short(v)); }
+        static __m256i gt(__m256i a,__m256i b){return _mm256_cmpgt_epi16(a,b);}
+        static __m256i eq(__m256i a,__m256i b){return _mm256_cmpeq_epi16(a,b);}
+        static uint64 movemask(__m256i v)
+        {
+            //packing works within the two 128-bit halves 
+            uint64 m = uint32(_mm256_movemask_epi8(
+                            _mm256_packs_epi16(v,_mm256_setzero_si256())));
+            return (m&0xff)|((m>>8)&0xff00);
+        }
+        static __m256i lanes(uint64 bits)
+        {
+            __m256i s = _mm256_setr_epi16(0x1,0x2,0x4,0x8,0x10,0x20,0x40,0x80,
+                                          0x100,0x200,0x400,0x800,0x1000,
+                                          0x2000,0x4000,short(0x8000));
+            return _mm256_cmpeq_epi16(_mm256_and_si256(set1(bits),s),s);
+        }
+    };
+
+    template<> struct simd_int_lanes<4>
+    {
+        static const bool has_compare = true;
+        static __m256i set1(uint64 v) { return _mm256_set1_epi32(int(v)); }
+        static __m256i gt(__m256i a,__m256i b){return _mm256_cmpgt_epi32(a,b);}
+        static __m256i eq(__m256i a,__m256i b){return _mm256_cmpeq_epi32(a,b);}
+        static uint64 movemask(__m256i v)
+        {
+            return uint32(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+        }
+        static __m256i lanes(uint64 bits)
+        {
+            __m256i s = _mm256_setr_epi32(0x1,0x2,0x4,0x8,0x10,0x20,0x40,0x80);
+            return _mm256_cmpeq_epi32(_mm256_and_si256(set1(bits),s),s);
+        }
+    };
+
+    template<> struct simd_int_lanes<8>
+    {
+        static const bool has_compare = true;
+        static __m256i set1(uint64 v) 
+        { 
+            return _mm256_set1_epi64x(int64(v)); 
+        }
+        static __m256i gt(__m256i a,__m256i b){return _mm256_cmpgt_epi64(a,b);}
+        static __m256i eq(__m256i a,__m256i b){return _mm256_cmpeq_epi64(a,b);}
+        static uint64 movemask(__m256i v)
+        {
+            return uint32(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+        }
+        static __m256i lanes(uint64 bits)
+        {
+            //both 32-bit halves of a lane test the same bit
+            __m256i s = _mm256_setr_epi32(0x1,0x1,0x2,0x2,0x4,0x4,0x8,0x8);
+            __m256i b = _mm256_set1_epi32(int(bits));
+            return _mm256_cmpeq_epi32(_mm256_and_si256(b,s),s);
+        }
+    };
+#else
+    template<> struct simd_int_lanes<1>
+    {
+        static const bool has_compare = true;
+        static __m128i set1(uint64 v) { return _mm_set1_epi8(char(v)); }
+        static __m128i gt(__m128i a,__m128i b) { return _mm_cmpgt_epi8(a,b); }
+        static __m128i eq(__m128i a,__m128i b) { return _mm_cmpeq_epi8(a,b); }
+        static uint64 movemask(__m128i v) 
+        { 
+            return uint32(_mm_movemask_epi8(v)); 
+        }
+        static __m128i lanes(uint64 bits) { return simd_byte_lanes(bits); }
+    };
+
+    template<> struct simd_int_lanes<2>
+    {
+        static const bool has_compare = true;
+        static __m128i set1(uint64 v) { return _mm_set1_epi16(short(v)); }
+        static __m128i gt(__m128i a,__m128i b) { return _mm_cmpgt_epi16(a,b); }
+        static __m128i eq(__m128i a,__m128i b) { return _mm_cmpeq_epi16(a,b); }
+        static uint64 movemask(__m128i v)
+        {
+            return uint32(_mm_movemask_epi8(
+                            _mm_packs_epi16(v,_mm_setzero_si128())));
+        }
+        static __m128i lanes(uint64 bits)
+        {
+            __m128i s = _mm_setr_epi16(0x1,0x2,0x4,0x8,0x10,0x20,0x40,0x80);
+            return _mm_cmpeq_epi16(_mm_and_si128(set1(bits),s),s);
+        }
+    };
+
+    template<> struct simd_int_lanes<4>
+    {
+        static const bool has_compare = true;
+        static __m128i set1(uint64 v) { return _mm_set1_epi32(int(v)); }
+        static __m128i gt(__m128i a,__m128i b) { return _mm_cmpgt_epi32(a,b); }
+        static __m128i eq(__m128i a,__m128i b) { return _mm_cmpeq_epi32(a,b); }
+        static uint64 movemask(__m128i v)
+        {
+            return uint32(_mm_movemask_ps(_mm_castsi128_ps(v)));
+        }
+        static __m128i lanes(uint64 bits)
+        {
+            __m128i s = _mm_setr_epi32(0x1,0x2,0x4,0x8);
+            return _mm_cmpeq_epi32(_mm_and_si128(set1(bits),s),s);
+        }
+    };
+
+    //SSE2 has no 64-bit integer comparison - only unpacking is vectorized
+    template<> struct simd_int_lanes<8>
+    {
+        static const bool has_compare = false;
+        static __m128i set1(uint64 v) { return _mm_set1_epi64x(int64(v)); }
+        static __m128i lanes(uint64 bits)
+        {
+            __m128i s = _mm_setr_epi32(0x1,0x1,0x2,0x2);
+            __m128i b = _mm_set1_epi32(int(bits));
+            return _mm_cmpeq_epi32(_mm_and_si128(b,s),s);
+        }
+    };
+#endif
+
+    //
+    // per type compare operations - width is the number of elements in a 
+    // register and compare() returns one bit per element
+    //
+    template<
+             typename T,
+             bool INT = std::is_integral<T>::value && 
+                        (sizeof(T)==1 || sizeof(T)==2 || sizeof(T)==4 ||
+                         sizeof(T)==8)
+            >
+    struct simd_compare_ops
+    {
+        static const bool is_vectorized = false;
+    };
+
+    template<typename T> struct simd_compare_ops<T,true>
+    {
+        typedef simd_int_lanes<sizeof(T)> lanes_type;
+        typedef simd_int_register register_type;
+        static const bool is_vectorized = lanes_type::has_compare;
+        static const size_t width = simd_register_size/sizeof(T);
+        static const uint64 bias = std::is_signed<T>::value ? 0 : 
+                                   uint64(1)<<(8*sizeof(T)-1);
+
+        static register_type load(const T *p)
+        {
+            return bias ? simd_xor(simd_loadu(p),lanes_type::set1(bias)) : 
+                          simd_loadu(p);
+        }
+
+        static register_type set1(T t) 
+        { 
+            return lanes_type::set1(uint64(t)^bias); 
+        }
+
+        template<simd_compare_op OP>
+        static uint64 compare(register_type a,register_type t)
+        {
+            const uint64 all = (uint64(1)<<width)-1;
+            switch(OP)
+            {
+                case simd_compare_op::lt: 
+                    return lanes_type::movemask(lanes_type::gt(t,a));
+                case simd_compare_op::le: 
+                    return ~lanes_type::movemask(lanes_type::gt(a,t))&all;
+                case simd_compare_op::gt: 
+                    return lanes_type::movemask(lanes_type::gt(a,t));
+                case simd_compare_op::ge: 
+                    return ~lanes_type::movemask(lanes_type::gt(t,a))&all;
+                case simd_compare_op::eq: 
+                    return lanes_type::movemask(lanes_type::eq(a,t));
+                default: 
+                    return ~lanes_type::movemask(lanes_type::eq(a,t))&all;
+            }
+        }
+    };
+
+    //NaN compares unequal to everything - thus the unordered predicate for ne
+    template<> struct simd_compare_ops<float32,false>
+    {
+        static const bool is_vectorized = true;
+        static const size_t width = simd_register_size/sizeof(float32);
+#ifdef PNI_SIMD_AVX2
+        typedef __m256 register_type;
+        static __m256 load(const float32 *p) { return _mm256_loadu_ps(p); }
+        static __m256 set1(float32 t) { return _mm256_set1_ps(t); }
+
+        template<simd_compare_op OP>
+        static uint64 compare(__m256 a,__m256 t)
+        {
+            __m256 c;
+            switch(OP)
+            {
+                case simd_compare_op::lt:
+                    c = _mm256_cmp_ps(a,t,_CMP_LT_OQ); break;
+                case simd_compare_op::le:
+                    c = _mm256_cmp_ps(a,t,_CMP_LE_OQ); break;
+                case simd_compare_op::gt:
+                    c = _mm256_cmp_ps(a,t,_CMP_GT_OQ); break;
+                case simd_compare_op::ge:
+                    c = _mm256_cmp_ps(a,t,_CMP_GE_OQ); break;
+                case simd_compare_op::eq:
+                    c = _mm256_cmp_ps(a,t,_CMP_EQ_OQ); break;
+                default:
+                    c = _mm256_cmp_ps(a,t,_CMP_NEQ_UQ);
+            }
+            return uint32(_mm256_movemask_ps(c));
+        }
+#else
+        typedef __m128 register_type;
+        static __m128 load(const float32 *p) { return _mm_loadu_ps(p); }
+        static __m128 set1(float32 t) { return _mm_set1_ps(t); }
+
+        template<simd_compare_op OP>
+        static uint64 compare(__m128 a,__m128 t)
+        {
+            __m128 c;
+            switch(OP)
+            {
+                case simd_compare_op::lt: c = _mm_cmplt_ps(a,t); break;
+                case simd_compare_op::le: c = _mm_cmple_ps(a,t); break;
+                case simd_compare_op::gt: c = _mm_cmpgt_ps(a,t); break;
+                case simd_compare_op::ge: c = _mm_cmpge_ps(a,t); break;
+                case simd_compare_op::eq: c = _mm_cmpeq_ps(a,t); break;
+                default: c = _mm_cmpneq_ps(a,t);
+            }
+            return uint32(_mm_movemask_ps(c));
+        }
+#endif
+    };
+
+    template<> struct simd_compare_ops<float64,false>
+    {
+        static const bool is_vectorized = true;
+        static const size_t width = simd_register_size/sizeof(float64);
+#ifdef PNI_SIMD_AVX2
+        typedef __m256d register_type;
+        static __m256d load(const float64 *p) { return _mm256_loadu_pd(p); }
+        static __m256d set1(float64 t) { return _mm256_set1_pd(t); }
+
+        template<simd_compare_op OP>
+        static uint64 compare(__m256d a,__m256d t)
+        {
+            __m256d c;
+            switch(OP)
+            {
+                case simd_compare_op::lt:
+                    c = _mm256_cmp_pd(a,t,_CMP_LT_OQ); break;
+                case simd_compare_op::le:
+                    c = _mm256_cmp_pd(a,t,_CMP_LE_OQ); break;
+                case simd_compare_op::gt:
+                    c = _mm256_cmp_pd(a,t,_CMP_GT_OQ); break;
+                case simd_compare_op::ge:
+                    c = _mm256_cmp_pd(a,t,_CMP_GE_OQ); break;
+                case simd_compare_op::eq:
+                    c = _mm256_cmp_pd(a,t,_CMP_EQ_OQ); break;
+                default:
+                    c = _mm256_cmp_pd(a,t,_CMP_NEQ_UQ);
+            }
+            return uint32(_mm256_movemask_pd(c));
+        }
+#else
+        typedef __m128d register_type;
+        static __m128d load(const float64 *p) { return _mm_loadu_pd(p); }
+        static __m128d set1(float64 t) { return _mm_set1_pd(t); }
+
+        template<simd_compare_op OP>
+        static uint64 compare(__m128d a,__m128d t)
+        {
+            __m128d c;
+            switch(OP)
+            {
+                case simd_compare_op::lt: c = _mm_cmplt_pd(a,t); break;
+                case simd_compare_op::le: c = _mm_cmple_pd(a,t); break;
+                case simd_compare_op::gt: c = _mm_cmpgt_pd(a,t); break;
+                case simd_compare_op::ge: c = _mm_cmpge_pd(a,t); break;
+                case simd_compare_op::eq: c = _mm_cmpeq_pd(a,t); break;
+                default: c = _mm_cmpneq_pd(a,t);
+            }
+            return uint32(_mm_movemask_pd(c));
+        }
+#endif
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::less<T>>
+    {
+        static const bool value = simd_compare_ops<T>::is_vectorized;
+        static const simd_compare_op op = simd_compare_op::lt;
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::less_equal<T>>
+    {
+        static const bool value = simd_compare_ops<T>::is_vectorized;
+        static const simd_compare_op op = simd_compare_op::le;
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::greater<T>>
+    {
+        static const bool value = simd_compare_ops<T>::is_vectorized;
+        static const simd_compare_op op = simd_compare_op::gt;
+    };
+
+    template<typename T> 
+    struct simd_compare_predicate<T,std::greater_equal<T>>
+    {
+        static const bool value = simd_compare_ops<T>::is_vectorized;
+        static const simd_compare_op op = simd_compare_op::ge;
+    };
+
+    template<typename T> struct simd_compare_predicate<T,std::equal_to<T>>
+    {
+        static const bool value = simd_compare_ops<T>::is_vectorized;
+        static const simd_compare_op op = simd_compare_op::eq;
+    };
+
+    template<typename T> 
+    struct simd_compare_predicate<T,std::not_equal_to<T>>
+    {
+        static const bool value = simd_compare_ops<T>::is_vectorized;
+        static const simd_compare_op op = simd_compare_op::ne;
+    };
+
+    //
+    // compare 64 elements with a threshold - the result is one mask word
+    //
+    template<simd_compare_op OP,typename T> 
+    inline uint64 simd_compare_word(const T *p,T t)
+    {
+        typedef simd_compare_ops<T> ops_type;
+        typename ops_type::register_type v = ops_type::set1(t);
+        uint64 w = 0;
+        for(size_t k=0;k<bitmask_word_bits;k+=ops_type::width)
+            w |= ops_type::template compare<OP>(ops_type::load(p+k),v)<<k;
+        return w;
+    }
+    //! \endcond
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief threshold kernel
+    //!
+    //! Compares 64 elements with a threshold and packs the results to a 
+    //! single mask word. Bit b of the word is the result for element b. 
+    //! This default template calls the comparison functor for each 
+    //! element.
+    //!
+    //! \tparam T element type
+    //! \tparam COMP comparison functor
+    //! \tparam SIMD true if the SIMD compare instructions can be used
+    //!
+    template<
+             typename T,
+             typename COMP,
+             bool SIMD = simd_compare_predicate<T,COMP>::value &&
+                         std::is_arithmetic<T>::value &&
+                         !std::is_same<T,bool>::value &&
+                         !std::is_same<T,char>::value
+            >
+    struct simd_compare_kernel
+    {
+        //! kernel is not vectorized
+        static const bool is_vectorized = false;
+
+        //! compare one word of elements
+        static uint64 compare(const T *p,const T &t,COMP comp)
+        {
+            uint64 w = 0;
+            for(size_t b=0;b<bitmask_word_bits;++b)
+                w |= uint64(bool(comp(p[b],t)))<<b;
+            return w;
+        }
+    };
+
+#ifdef PNI_SIMD_AVX512
+    //! \cond no_doc
+    template<
+             typename T,
+             typename COMP
+            >
+    struct simd_compare_kernel<T,COMP,true>
+    {
+        typedef simd_compare_predicate<T,COMP> predicate_type;
+        static const bool is_vectorized = true;
+        static const int predicate = std::is_floating_point<T>::value ?
+                                     predicate_type::float_predicate :
+                                     predicate_type::int_predicate;
+
+        static uint64 compare(const T *p,const T &t,COMP)
+        {
+            return simd_compare_word<predicate>(p,t);
+        }
+    };
+    //! \endcond
+#elif defined(PNI_SIMD_ENABLED)
+    //! \cond no_doc
+    template<
+             typename T,
+             typename COMP
+            >
+    struct simd_compare_kernel<T,COMP,true>
+    {
+        static const bool is_vectorized = true;
+        static const simd_compare_op op = simd_compare_predicate<T,COMP>::op;
+
+        static uint64 compare(const T *p,const T &t,COMP)
+        {
+            return simd_compare_word<op>(p,t);
+        }
+    };
+    //! \endcond
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pack threshold comparisons to mask words
+    //!
+    //! Compares n elements with a threshold and stores the results as bits
+    //! in (n+63)/64 mask words. Bits beyond n in the last word are cleared.
+    /*!
+    \code
+    std::vector<uint64> words((frame.size()+63)/64);
+    simd_threshold(frame.data(),frame.size(),uint16(60000),
+                   std::greater<uint16>(),words.data());
+    \endcode
+    !*/
+    //!
+    //! \tparam T element type
+    //! \tparam COMP comparison functor
+    //! \param src pointer to the first element
+    //! \param n number of elements
+    //! \param t threshold
+    //! \param comp comparison functor called as comp(src[i],t)
+    //! \param words pointer to the first mask word
+    //!
+    template<
+             typename T,
+             typename COMP
+            >
+    void simd_threshold(const T *src,size_t n,const T &t,COMP comp,
+                        uint64 *words)
+    {
+        typedef simd_compare_kernel<T,COMP> kernel_type;
+        size_t i = 0;
+
+        for(;i+bitmask_word_bits<=n;i+=bitmask_word_bits)
+            *words++ = kernel_type::compare(src+i,t,comp);
+
+        if(i<n)
+        {
+            uint64 w = 0;
+            for(size_t b=0;i<n;++i,++b)
+                w |= uint64(bool(comp(src[i],t)))<<b;
+            *words = w;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pack a byte mask to mask words
+    //!
+    //! Sets bit i if mask[i] is non-zero. Bits beyond n in the last word are
+    //! cleared.
+    //!
+    //! \tparam MT mask element type (see is_byte_mask)
+    //! \param mask pointer to the first mask element
+    //! \param n number of mask elements
+    //! \param words pointer to the first mask word
+    //!
+    template<typename MT> 
+    void simd_pack_mask(const MT *mask,size_t n,uint64 *words)
+    {
+        static_assert(is_byte_mask<MT>::value,"mask must be a byte mask");
+        const uint8 *bytes = reinterpret_cast<const uint8*>(mask);
+        size_t i = 0;
+
+        for(;i+bitmask_word_bits<=n;i+=bitmask_word_bits)
+        {
+#ifdef PNI_SIMD_AVX512
+            __m512i m = _mm512_loadu_si512(bytes+i);
+            *words++ = _mm512_test_epi8_mask(m,m);
+#elif defined(PNI_SIMD_ENABLED)
+            typedef simd_int_lanes<1> lanes_type;
+            const uint64 all = (uint64(1)<<simd_register_size)-1;
+            const simd_int_register zero = lanes_type::set1(0);
+            uint64 w = 0;
+            for(size_t k=0;k<bitmask_word_bits;k+=simd_register_size)
+                w |= (~lanes_type::movemask(
+                        lanes_type::eq(simd_loadu(bytes+i+k),zero))&all)<<k;
+            *words++ = w;
+#else
+            uint64 w = 0;
+            for(size_t b=0;b<bitmask_word_bits;++b)
+                w |= uint64(bytes[i+b]!=0)<<b;
+            *words++ = w;
+#endif
+        }
+
+        if(i<n)
+        {
+            uint64 w = 0;
+            for(size_t b=0;i<n;++i,++b) w |= uint64(bytes[i]!=0)<<b;
+            *words = w;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unpack full mask words 
+    //!
+    //! Default version used if no SIMD kernel is available. It does 
+    //! nothing.
+    //!
+    //! \return number of unpacked elements
+    //!
+    template<typename T>
+    size_t simd_unpack_words(const uint64 *,size_t,T *,const T &,const T &,
+                             std::false_type)
+    {
+        return 0;
+    }
+
+#ifdef PNI_SIMD_AVX512
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unpack full mask words 
+    //!
+    //! Unpacks all full words with the AVX-512 blend instructions. The 
+    //! two values are broadcast by their bit pattern. 
+    //!
+    //! \return number of unpacked elements
+    //!
+    template<typename T>
+    size_t simd_unpack_words(const uint64 *words,size_t n,T *dest,
+                             const T &one,const T &zero,std::true_type)
+    {
+        uint64 o = 0,z = 0;
+        std::memcpy(&o,&one,sizeof(T));
+        std::memcpy(&z,&zero,sizeof(T));
+
+        size_t i = 0;
+        for(;i+bitmask_word_bits<=n;i+=bitmask_word_bits)
+        {
+            uint64 w = *words++;
+            char *p = reinterpret_cast<char*>(dest+i);
+            switch(sizeof(T))
+            {
+                case 1:
+                    _mm512_storeu_si512(p,_mm512_mask_blend_epi8(w,
+                                _mm512_set1_epi8(char(z)),
+                                _mm512_set1_epi8(char(o))));
+                    break;
+                case 2:
+                    for(size_t k=0;k<2;++k,w>>=32)
+                        _mm512_storeu_si512(p+64*k,
+                                _mm512_mask_blend_epi16(__mmask32(w),
+                                    _mm512_set1_epi16(short(z)),
+                                    _mm512_set1_epi16(short(o))));
+                    break;
+                case 4:
+                    for(size_t k=0;k<4;++k,w>>=16)
+                        _mm512_storeu_si512(p+64*k,
+                                _mm512_mask_blend_epi32(__mmask16(w),
+                                    _mm512_set1_epi32(int(z)),
+                                    _mm512_set1_epi32(int(o))));
+                    break;
+                default:
+                    for(size_t k=0;k<8;++k,w>>=8)
+                        _mm512_storeu_si512(p+64*k,
+                                _mm512_mask_blend_epi64(__mmask8(w),
+                                    _mm512_set1_epi64(z),
+                                    _mm512_set1_epi64(o)));
+            }
+        }
+        return i;
+    }
+#elif defined(PNI_SIMD_ENABLED)
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unpack full mask words 
+    //!
+    //! Unpacks all full words with SSE2 or AVX2. The bits of a word are 
+    //! spread to all-ones lanes which select between the bit patterns of 
+    //! the two values.
+    //!
+    //! \return number of unpacked elements
+    //!
+    template<typename T>
+    size_t simd_unpack_words(const uint64 *words,size_t n,T *dest,
+                             const T &one,const T &zero,std::true_type)
+    {
+        typedef simd_int_lanes<sizeof(T)> lanes_type;
+        const size_t width = simd_register_size/sizeof(T);
+        uint64 o = 0,z = 0;
+        std::memcpy(&o,&one,sizeof(T));
+        std::memcpy(&z,&zero,sizeof(T));
+        const simd_int_register ov = lanes_type::set1(o);
+        const simd_int_register zv = lanes_type::set1(z);
+
+        size_t i = 0;
+        for(;i+bitmask_word_bits<=n;i+=bitmask_word_bits)
+        {
+            uint64 w = *words++;
+            for(size_t k=0;k<bitmask_word_bits;k+=width,w>>=width)
+                simd_storeu(dest+i+k,simd_select(lanes_type::lanes(w),ov,zv));
+        }
+        return i;
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unpack mask words 
+    //!
+    //! Sets dest[i] to one if bit i is set and to zero otherwise. This is 
+    //! the inverse of simd_threshold() and simd_pack_mask(). For 
+    //! arithmetic types and byte masks the words are unpacked with SIMD 
+    //! instructions if available.
+    //!
+    //! \tparam T element type
+    //! \param words pointer to the first mask word
+    //! \param n number of elements
+    //! \param dest pointer to the first element 
+    //! \param one value for set bits
+    //! \param zero value for cleared bits
+    //!
+    template<typename T>
+    void simd_unpack_mask(const uint64 *words,size_t n,T *dest,const T &one,
+                          const T &zero)
+    {
+#ifdef PNI_SIMD_ENABLED
+        typedef std::integral_constant<bool,
+                    (std::is_arithmetic<T>::value || is_byte_mask<T>::value) &&
+                    (sizeof(T)==1 || sizeof(T)==2 || sizeof(T)==4 || 
+                     sizeof(T)==8)> use_simd;
+#else
+        typedef std::false_type use_simd;
+#endif
+        size_t i = simd_unpack_words(words,n,dest,one,zero,use_simd());
+        words += i/bitmask_word_bits;
+
+        for(;i<n;i+=bitmask_word_bits)
+        {
+            uint64 w = *words++;
+            size_t m = n-i<bitmask_word_bits ? n-i : bitmask_word_bits;
+            for(size_t b=0;b<m;++b) dest[i+b] = (w>>b)&1 ? one : zero;
+        }
+    }
+
+//end of namespace
+}
+}
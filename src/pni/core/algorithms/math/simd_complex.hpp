@@ -0,0 +1,197 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <complex>
+#include <pni/core/types/types.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief complex layout kernel
+    //!
+    //! Converts \c size complex numbers at a time between the interleaved 
+    //! layout of std::complex (re,im,re,im,...) and two separate planes 
+    //! holding the real and the imaginary parts. This default template 
+    //! converts a single number.
+    //!
+    //! \tparam T element type of the real and imaginary parts
+    //!
+    template<typename T> struct simd_complex_kernel
+    {
+        //! kernel is not vectorized
+        static const bool is_vectorized = false;
+        //! number of complex numbers processed at once
+        static const size_t size = 1;
+
+        //! split a complex number 
+        static void deinterleave(const std::complex<T> *src,T *re,T *im)
+        {
+            *re = src->real();
+            *im = src->imag();
+        }
+
+        //! join a complex number
+        static void interleave(const T *re,const T *im,std::complex<T> *dest)
+        {
+            *dest = std::complex<T>(*re,*im);
+        }
+    };
+
+#ifdef PNI_SIMD_AVX512
+    //
+    // Two registers of interleaved data are split with a two source 
+    // permutation selecting the even (real) and odd (imaginary) elements. 
+    // Joining uses the inverse permutations. 
+    //
+    //! \cond no_doc
+    template<> struct simd_complex_kernel<float32>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 16;
+
+        static void deinterleave(const complex32 *src,float32 *re,
+                                 float32 *im)
+        {
+            const __m512i even = _mm512_setr_epi32(0,2,4,6,8,10,12,14,
+                                                   16,18,20,22,24,26,28,30);
+            const __m512i odd  = _mm512_setr_epi32(1,3,5,7,9,11,13,15,
+                                                   17,19,21,23,25,27,29,31);
+            const float32 *p = reinterpret_cast<const float32*>(src);
+            __m512 a = _mm512_loadu_ps(p);
+            __m512 b = _mm512_loadu_ps(p+16);
+            _mm512_storeu_ps(re,_mm512_permutex2var_ps(a,even,b));
+            _mm512_storeu_ps(im,_mm512_permutex2var_ps(a,odd,b));
+        }
+
+        static void interleave(const float32 *re,const float32 *im,
+                               complex32 *dest)
+        {
+            const __m512i lo = _mm512_setr_epi32(0,16,1,17,2,18,3,19,
+                                                 4,20,5,21,6,22,7,23);
+            const __m512i hi = _mm512_setr_epi32(8,24,9,25,10,26,11,27,
+                                                 12,28,13,29,14,30,15,31);
+            float32 *p = reinterpret_cast<float32*>(dest);
+            __m512 r = _mm512_loadu_ps(re);
+            __m512 i = _mm512_loadu_ps(im);
+            _mm512_storeu_ps(p,_mm512_permutex2var_ps(r,lo,i));
+            _mm512_storeu_ps(p+16,_mm512_permutex2var_ps(r,hi,i));
+        }
+    };
+
+    template<> struct simd_complex_kernel<float64>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 8;
+
+        static void deinterleave(const complex64 *src,float64 *re,
+                                 float64 *im)
+        {
+            const __m512i even = _mm512_setr_epi64(0,2,4,6,8,10,12,14);
+            const __m512i odd  = _mm512_setr_epi64(1,3,5,7,9,11,13,15);
+            const float64 *p = reinterpret_cast<const float64*>(src);
+            __m512d a = _mm512_loadu_pd(p);
+            __m512d b = _mm512_loadu_pd(p+8);
+            _mm512_storeu_pd(re,_mm512_permutex2var_pd(a,even,b));
+            _mm512_storeu_pd(im,_mm512_permutex2var_pd(a,odd,b));
+        }
+
+        static void interleave(const float64 *re,const float64 *im,
+                               complex64 *dest)
+        {
+            const __m512i lo = _mm512_setr_epi64(0,8,1,9,2,10,3,11);
+            const __m512i hi = _mm512_setr_epi64(4,12,5,13,6,14,7,15);
+            float64 *p = reinterpret_cast<float64*>(dest);
+            __m512d r = _mm512_loadu_pd(re);
+            __m512d i = _mm512_loadu_pd(im);
+            _mm512_storeu_pd(p,_mm512_permutex2var_pd(r,lo,i));
+            _mm512_storeu_pd(p+8,_mm512_permutex2var_pd(r,hi,i));
+        }
+    };
+    //! \endcond
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex numbers into planes
+    //!
+    //! Copies the real parts of n complex numbers to re and the imaginary 
+    //! parts to im.
+    //!
+    //! \tparam T element type of the real and imaginary parts
+    //! \param src pointer to the first complex number
+    //! \param n number of complex numbers
+    //! \param re pointer to the real plane
+    //! \param im pointer to the imaginary plane
+    //!
+    template<typename T>
+    void simd_deinterleave(const std::complex<T> *src,size_t n,T *re,T *im)
+    {
+        typedef simd_complex_kernel<T> kernel_type;
+        size_t i = 0;
+
+        for(;i+kernel_type::size<=n;i+=kernel_type::size)
+            kernel_type::deinterleave(src+i,re+i,im+i);
+
+        for(;i<n;++i)
+        {
+            re[i] = src[i].real();
+            im[i] = src[i].imag();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief join planes to complex numbers
+    //!
+    //! Inverse of simd_deinterleave().
+    //!
+    //! \tparam T element type of the real and imaginary parts
+    //! \param re pointer to the real plane
+    //! \param im pointer to the imaginary plane
+    //! \param n number of complex numbers
+    //! \param dest pointer to the first complex number
+    //!
+    template<typename T>
+    void simd_interleave(const T *re,const T *im,size_t n,
+                         std::complex<T> *dest)
+    {
+        typedef simd_complex_kernel<T> kernel_type;
+        size_t i = 0;
+
+        for(;i+kernel_type::size<=n;i+=kernel_type::size)
+            kernel_type::interleave(re+i,im+i,dest+i);
+
+        for(;i<n;++i) dest[i] = std::complex<T>(re[i],im[i]);
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,273 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief type conversion kernel
+    //!
+    //! Converts \c size elements of type ST at a time to type TT. This
+    //! default template is used for all type pairs without a SIMD
+    //! implementation. Kernels exist for the conversion between float32
+    //! and the 16Bit floating point types. float16 uses the F16C
+    //! instructions (part of AVX-512F, or AVX2 code compiled with F16C
+    //! support), bfloat16 uses integer instructions.
+    //!
+    //! \tparam TT target type
+    //! \tparam ST source type
+    //!
+    template<
+             typename TT,
+             typename ST
+            >
+    struct simd_convert_kernel
+    {
+        //! kernel is not vectorized
+        static const bool is_vectorized = false;
+        //! number of elements converted at once
+        static const size_t size = 1;
+    };
+
+#if defined(PNI_SIMD_AVX512)
+    //! \cond no_doc
+    //
+    // The zero-masked forms of the intrinsics are used with all lanes 
+    // enabled. The unmasked forms pass an undefined source operand which 
+    // makes GCC emit spurious uninitialized warnings.
+    //
+    template<> struct simd_convert_kernel<float32,float16>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 16;
+
+        static void convert(const float16 *src,float32 *dest)
+        {
+            __m256i h = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(src));
+            _mm512_storeu_ps(dest,_mm512_maskz_cvtph_ps(0xffff,h));
+        }
+    };
+
+    template<> struct simd_convert_kernel<float16,float32>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 16;
+
+        static void convert(const float32 *src,float16 *dest)
+        {
+            __m256i h = _mm512_maskz_cvtps_ph(0xffff,_mm512_loadu_ps(src),
+                            _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest),h);
+        }
+    };
+
+    template<> struct simd_convert_kernel<float32,bfloat16>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 16;
+
+        static void convert(const bfloat16 *src,float32 *dest)
+        {
+            __m256i h = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(src));
+            __m512i x = _mm512_maskz_cvtepu16_epi32(0xffff,h);
+            _mm512_storeu_si512(dest,_mm512_maskz_slli_epi32(0xffff,x,16));
+        }
+    };
+
+    //
+    // Rounding to nearest even adds 0x7fff plus the lowest bit kept to the
+    // single precision bits. NaN is kept quiet instead of being rounded.
+    //
+    template<> struct simd_convert_kernel<bfloat16,float32>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 16;
+
+        static void convert(const float32 *src,bfloat16 *dest)
+        {
+            __m512i x = _mm512_loadu_si512(src);
+            __m512i high = _mm512_maskz_srli_epi32(0xffff,x,16);
+            __m512i odd = _mm512_and_si512(high,_mm512_set1_epi32(1));
+            __m512i r = _mm512_maskz_srli_epi32(0xffff,_mm512_add_epi32(x,
+                            _mm512_add_epi32(odd,_mm512_set1_epi32(0x7fff))),
+                            16);
+            __mmask16 nan = _mm512_cmpgt_epi32_mask(
+                    _mm512_and_si512(x,_mm512_set1_epi32(0x7fffffff)),
+                    _mm512_set1_epi32(0x7f800000));
+            r = _mm512_mask_or_epi32(r,nan,high,_mm512_set1_epi32(0x40));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest),
+                                _mm512_maskz_cvtepi32_epi16(0xffff,r));
+        }
+    };
+    //! \endcond
+#elif defined(PNI_SIMD_AVX2)
+    //! \cond no_doc
+#if defined(__F16C__)
+    template<> struct simd_convert_kernel<float32,float16>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 8;
+
+        static void convert(const float16 *src,float32 *dest)
+        {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            _mm256_storeu_ps(dest,_mm256_cvtph_ps(h));
+        }
+    };
+
+    template<> struct simd_convert_kernel<float16,float32>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 8;
+
+        static void convert(const float32 *src,float16 *dest)
+        {
+            __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src),
+                            _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),h);
+        }
+    };
+#endif
+
+    template<> struct simd_convert_kernel<float32,bfloat16>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 8;
+
+        static void convert(const bfloat16 *src,float32 *dest)
+        {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest),
+                    _mm256_slli_epi32(_mm256_cvtepu16_epi32(h),16));
+        }
+    };
+
+    template<> struct simd_convert_kernel<bfloat16,float32>
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 8;
+
+        static void convert(const float32 *src,bfloat16 *dest)
+        {
+            __m256i x = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(src));
+            __m256i odd = _mm256_and_si256(_mm256_srli_epi32(x,16),
+                                           _mm256_set1_epi32(1));
+            __m256i r = _mm256_srli_epi32(_mm256_add_epi32(x,
+                            _mm256_add_epi32(odd,_mm256_set1_epi32(0x7fff))),
+                            16);
+            __m256i nan = _mm256_cmpgt_epi32(
+                    _mm256_and_si256(x,_mm256_set1_epi32(0x7fffffff)),
+                    _mm256_set1_epi32(0x7f800000));
+            r = _mm256_blendv_epi8(r,_mm256_or_si256(_mm256_srli_epi32(x,16),
+                                   _mm256_set1_epi32(0x40)),nan);
+            //all values fit into 16Bit - the pack works per 128Bit lane
+            r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r,r),0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),
+                             _mm256_castsi256_si128(r));
+        }
+    };
+    //! \endcond
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy without a conversion kernel
+    //!
+    template<
+             typename ST,
+             typename TT
+            >
+    void simd_convert(const ST *src,size_t n,TT *dest,std::false_type)
+    {
+        std::copy(src,src+n,dest);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy with a conversion kernel
+    //!
+    template<
+             typename ST,
+             typename TT
+            >
+    void simd_convert(const ST *src,size_t n,TT *dest,std::true_type)
+    {
+        typedef simd_convert_kernel<TT,ST> kernel_type;
+        size_t i = 0;
+
+        for(;i+kernel_type::size<=n;i+=kernel_type::size)
+            kernel_type::convert(src+i,dest+i);
+
+        for(;i<n;++i) dest[i] = src[i];
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy and convert a block of elements
+    //!
+    //! Copies n elements from src to dest converting each element to the
+    //! destination type. If a simd_convert_kernel exists for the two types
+    //! the conversion is vectorized. Otherwise the elements are copied
+    //! with std::copy.
+    /*!
+    \code
+    std::vector<float32> data(n);
+    std::vector<float16> packed(n);
+    simd_convert(data.data(),n,packed.data());
+    \endcode
+    !*/
+    //!
+    //! \tparam ST source type
+    //! \tparam TT target type
+    //! \param src pointer to the first source element
+    //! \param n number of elements
+    //! \param dest pointer to the first destination element
+    //!
+    template<
+             typename ST,
+             typename TT
+            >
+    void simd_convert(const ST *src,size_t n,TT *dest)
+    {
+        simd_convert(src,n,dest,std::integral_constant<bool,
+                     simd_convert_kernel<TT,ST>::is_vectorized>());
+    }
+
+//end of namespace
+}
+}
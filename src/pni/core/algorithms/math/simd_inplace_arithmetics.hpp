@@ -0,0 +1,579 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/utilities/sfinae_macros.hpp>
+#include <pni/core/algorithms/math/inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD addition kernel
+    //!
+    struct simd_add_kernel
+    {
+        //! true if the kernel is available for T
+        template<typename T> struct enabled
+        {
+            //! result
+            static const bool value = simd_packet<T>::is_vectorized;
+        };
+
+        //! apply the kernel to a packet
+        template<typename PT>
+        static typename PT::type packet(typename PT::type a,
+                                        typename PT::type b)
+        {
+            return PT::add(a,b);
+        }
+
+        //! apply the kernel to a single element
+        template<typename T> static void element(T &a,const T &b) { a += b; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD subtraction kernel
+    //!
+    struct simd_sub_kernel
+    {
+        //! true if the kernel is available for T
+        template<typename T> struct enabled
+        {
+            //! result
+            static const bool value = simd_packet<T>::is_vectorized;
+        };
+
+        //! apply the kernel to a packet
+        template<typename PT>
+        static typename PT::type packet(typename PT::type a,
+                                        typename PT::type b)
+        {
+            return PT::sub(a,b);
+        }
+
+        //! apply the kernel to a single element
+        template<typename T> static void element(T &a,const T &b) { a -= b; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD multiplication kernel
+    //!
+    struct simd_mult_kernel
+    {
+        //! true if the kernel is available for T
+        template<typename T> struct enabled
+        {
+            //! result
+            static const bool value = simd_packet<T>::is_vectorized &&
+                                      simd_packet<T>::has_mult;
+        };
+
+        //! apply the kernel to a packet
+        template<typename PT>
+        static typename PT::type packet(typename PT::type a,
+                                        typename PT::type b)
+        {
+            return PT::mult(a,b);
+        }
+
+        //! apply the kernel to a single element
+        template<typename T> static void element(T &a,const T &b) { a *= b; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD division kernel
+    //!
+    struct simd_div_kernel
+    {
+        //! true if the kernel is available for T
+        template<typename T> struct enabled
+        {
+            //! result
+            static const bool value = simd_packet<T>::is_vectorized &&
+                                      simd_packet<T>::has_div;
+        };
+
+        //! apply the kernel to a packet
+        template<typename PT>
+        static typename PT::type packet(typename PT::type a,
+                                        typename PT::type b)
+        {
+            return PT::div(a,b);
+        }
+
+        //! apply the kernel to a single element
+        template<typename T> static void element(T &a,const T &b) { a /= b; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief apply SIMD kernel to a memory block
+    //!
+    //! Apply a kernel to n elements stored in two memory blocks. The result
+    //! is stored in the first block. Elements which do not fill a complete
+    //! packet at the end of the block are processed one by one.
+    //!
+    //! \tparam KERNEL kernel type
+    //! \tparam T element type
+    //! \param a pointer to the l.h.s. block
+    //! \param b pointer to the r.h.s. block
+    //! \param n number of elements
+    //!
+    template<
+             typename KERNEL,
+             typename T
+            >
+    void simd_apply(T *a,const T *b,size_t n)
+    {
+        typedef simd_packet<T> packet_type;
+        size_t i = 0;
+
+        for(;i+packet_type::size<=n;i+=packet_type::size)
+            packet_type::store(a+i,
+                    KERNEL::template packet<packet_type>(
+                        packet_type::load(a+i),packet_type::load(b+i)));
+
+        for(;i<n;++i) KERNEL::element(a[i],b[i]);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief apply SIMD kernel to a memory block
+    //!
+    //! Apply a kernel to n elements of a memory block and a scalar value.
+    //!
+    //! \tparam KERNEL kernel type
+    //! \tparam T element type
+    //! \param a pointer to the l.h.s. block
+    //! \param b scalar r.h.s. value
+    //! \param n number of elements
+    //!
+    template<
+             typename KERNEL,
+             typename T
+            >
+    void simd_apply(T *a,T b,size_t n)
+    {
+        typedef simd_packet<T> packet_type;
+        typename packet_type::type pb = packet_type::set1(b);
+        size_t i = 0;
+
+        for(;i+packet_type::size<=n;i+=packet_type::size)
+            packet_type::store(a+i,
+                    KERNEL::template packet<packet_type>(
+                        packet_type::load(a+i),pb));
+
+        for(;i<n;++i) KERNEL::element(a[i],b);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD kernel dispatcher
+    //!
+    //! Decides whether or not a kernel can be applied to a set of operands.
+    //! This is the case if the kernel is available for the element type,
+    //! both operands have the same element type and their data is stored
+    //! in contiguous memory. Operands which partially overlap are never
+    //! processed by a SIMD kernel as the result would differ from the
+    //! element wise evaluation.
+    //!
+    //! If the kernel cannot be applied the apply() functions return false
+    //! and the caller has to use the generic implementation.
+    //!
+    //! An r.h.s. array whose shape differs from the shape of the l.h.s. is
+    //! broadcast (see broadcast_map). The kernel is applied run by run.
+    //!
+    //! \tparam KERNEL kernel type
+    //!
+    template<typename KERNEL> class simd_dispatcher
+    {
+        private:
+            //! type of compile time decisions
+            template<bool V> using bool_type = std::integral_constant<bool,V>;
+
+            //-----------------------------------------------------------------
+            template<typename LTYPE,typename T>
+            static bool apply_scalar(LTYPE &,T,std::false_type)
+            {
+                return false;
+            }
+
+            //-----------------------------------------------------------------
+            template<typename LTYPE,typename T>
+            static bool apply_scalar(LTYPE &a,T b,std::true_type)
+            {
+                if(!contiguous_data<LTYPE>::is_contiguous(a)) return false;
+
+                simd_apply<KERNEL>(a.data(),b,a.size());
+                return true;
+            }
+
+            //-----------------------------------------------------------------
+            template<typename LTYPE,typename RTYPE>
+            static bool apply_array(LTYPE &,const RTYPE &,std::false_type)
+            {
+                return false;
+            }
+
+            //-----------------------------------------------------------------
+            template<typename LTYPE,typename RTYPE>
+            static bool apply_array(LTYPE &a,const RTYPE &b,std::true_type)
+            {
+                if(!(contiguous_data<LTYPE>::is_contiguous(a) &&
+                     contiguous_data<RTYPE>::is_contiguous(b)))
+                    return false;
+
+                size_t n = a.size();
+                auto pa = a.data();
+                auto pb = b.data();
+
+                broadcast_map map = make_broadcast_map(b,
+                        a.template shape<shape_t>());
+                if(!map.is_identity()) return apply_broadcast(a,b,map);
+
+                //partially overlapping memory regions
+                if((pa!=pb) && (pa<pb+n) && (pb<pa+n)) return false;
+
+                simd_apply<KERNEL>(pa,pb,n);
+                return true;
+            }
+
+            //-----------------------------------------------------------------
+            template<typename LTYPE,typename RTYPE>
+            static bool apply_broadcast(LTYPE &a,const RTYPE &b,
+                                        const broadcast_map &map)
+            {
+                auto pa = a.data();
+                auto pb = b.data();
+
+                //overlapping memory regions
+                if((pa<pb+b.size()) && (pb<pa+a.size())) return false;
+
+                map.for_each_run(0,a.size(),[&](size_t i,size_t o,size_t n)
+                {
+                    if(map.step())
+                        simd_apply<KERNEL>(pa+i,pb+o,n);
+                    else
+                        simd_apply<KERNEL>(pa+i,pb[o],n);
+                });
+                return true;
+            }
+
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief apply kernel with scalar r.h.s.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam T scalar type
+            //! \param a reference to the l.h.s. array
+            //! \param b scalar r.h.s. value
+            //! \return true if the kernel was applied, false otherwise
+            //!
+            template<typename LTYPE,typename T>
+            static bool apply(LTYPE &a,T b)
+            {
+                typedef typename LTYPE::value_type value_type;
+
+                return apply_scalar(a,b,bool_type<
+                        std::is_same<value_type,T>::value &&
+                        KERNEL::template enabled<value_type>::value &&
+                        contiguous_data<LTYPE>::value>());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief apply kernel with array r.h.s.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s. array
+            //! \param b reference to the r.h.s. array
+            //! \return true if the kernel was applied, false otherwise
+            //!
+            template<typename LTYPE,typename RTYPE>
+            static bool apply_array(LTYPE &a,const RTYPE &b)
+            {
+                typedef typename LTYPE::value_type lvalue_type;
+                typedef typename RTYPE::value_type rvalue_type;
+
+                return apply_array(a,b,bool_type<
+                        std::is_same<lvalue_type,rvalue_type>::value &&
+                        KERNEL::template enabled<lvalue_type>::value &&
+                        contiguous_data<LTYPE>::value &&
+                        contiguous_data<RTYPE>::value>());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD inplace arithmetics
+    //!
+    //! This class provides the same interface as inplace_arithmetics but
+    //! uses explicit SSE2, AVX2 or AVX-512 kernels if all operands store
+    //! their data in contiguous memory and have the same element type.
+    //! The instruction set is selected at compile time (use for instance
+    //! -mavx2 or -march=native with GCC and Clang). In all other cases the
+    //! implementation of inplace_arithmetics is used.
+    //!
+    //! SIMD kernels are available for all integer, single and double
+    //! precision floating point types as well as for complex32 and
+    //! complex64. Integer multiplication is only vectorized where the
+    //! instruction set supports it, integer division never.
+    //!
+    //! To use this implementation pass it as the IPA template parameter
+    //! to mdarray
+    /*!
+    \code
+    typedef mdarray<std::vector<float32>,dynamic_cindex_map,
+                    simd_inplace_arithmetics> image_type;
+
+    image_type image = image_type::create(shape_t{2048,2048});
+    image += dark;  //uses the SIMD kernel
+    \endcode
+    !*/
+    //!
+    struct simd_inplace_arithmetics
+    {
+        //==================inplace addition===================================
+        //!
+        //! \brief add scalar to array
+        //!
+        //! \tparam LTYPE array type
+        //! \tparam T scalar type
+        //! \param a reference to an instance of LTYPE
+        //! \param b scalar value
+        //! \sa inplace_arithmetics::add
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t<
+                           is_pod<T>,is_cmplx<T>
+                           >>
+                >
+        static void add(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+
+            if(!simd_dispatcher<simd_add_kernel>::apply(a,b))
+                inplace_arithmetics::add(a,b);
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief add array to array
+        //!
+        //! \tparam LTYPE l.h.s. type
+        //! \tparam RTYPE r.h.s. type
+        //! \param a reference to an array of type LTYPE
+        //! \param b reference to an array of type RTYPE
+        //! \sa inplace_arithmetics::add
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void add(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+
+            if(!simd_dispatcher<simd_add_kernel>::apply_array(a,b))
+                inplace_arithmetics::add(a,b);
+        }
+
+        //==================inplace subtraction===============================
+        //!
+        //! \brief subtract scalar from array
+        //!
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam T scalar type
+        //! \param a reference to the l.h.s.
+        //! \param b scalar value on the r.h.s.
+        //! \sa inplace_arithmetics::sub
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t<
+                            is_pod<T>,is_cmplx<T>
+                            >>
+                >
+        static void sub(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+
+            if(!simd_dispatcher<simd_sub_kernel>::apply(a,b))
+                inplace_arithmetics::sub(a,b);
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief subtract array from array
+        //!
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam RTYPE r.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b reference to the r.h.s.
+        //! \sa inplace_arithmetics::sub
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void sub(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+
+            if(!simd_dispatcher<simd_sub_kernel>::apply_array(a,b))
+                inplace_arithmetics::sub(a,b);
+        }
+
+        //=====================inplace multiplication======================
+        //!
+        //! \brief multiply array with scalar
+        //!
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam T scalar type
+        //! \param a reference to the l.h.s.
+        //! \param b scalar r.h.s. value
+        //! \sa inplace_arithmetics::mult
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t<
+                            is_pod<T>,is_cmplx<T>
+                            >>
+                >
+        static void mult(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+
+            if(!simd_dispatcher<simd_mult_kernel>::apply(a,b))
+                inplace_arithmetics::mult(a,b);
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief multiply array by array
+        //!
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam RTYPE r.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b reference to the r.h.s.
+        //! \sa inplace_arithmetics::mult
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void mult(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+
+            if(!simd_dispatcher<simd_mult_kernel>::apply_array(a,b))
+                inplace_arithmetics::mult(a,b);
+        }
+
+        //=====================inplace division============================
+        //!
+        //! \brief divide array with scalar
+        //!
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam T scalar type
+        //! \param a reference to the l.h.s.
+        //! \param b scalar r.h.s. value
+        //! \sa inplace_arithmetics::div
+        //!
+        template<
+                 typename LTYPE,
+                 typename T,
+                 typename = enable_if<or_t<
+                            is_pod<T>,is_cmplx<T>
+                            >>
+                >
+        static void div(LTYPE &a,T b)
+        {
+            CHECK_ARITHMETIC_SINGLE(LTYPE);
+
+            if(!simd_dispatcher<simd_div_kernel>::apply(a,b))
+                inplace_arithmetics::div(a,b);
+        }
+
+        //-----------------------------------------------------------------
+        //!
+        //! \brief divide array by array
+        //!
+        //! \tparam LTYPE l.h.s. array type
+        //! \tparam RTYPE r.h.s. array type
+        //! \param a reference to the l.h.s.
+        //! \param b reference to the r.h.s.
+        //! \sa inplace_arithmetics::div
+        //!
+        template<
+                 typename LTYPE,
+                 typename RTYPE,
+                 typename = enable_if<not_t<
+                            or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                            >>
+                >
+        static void div(LTYPE &a,const RTYPE &b)
+        {
+            CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+
+            if(!simd_dispatcher<simd_div_kernel>::apply_array(a,b))
+                inplace_arithmetics::div(a,b);
+        }
+    };
+
+//end namespace
+}
+}
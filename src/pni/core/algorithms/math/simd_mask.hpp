@@ -0,0 +1,267 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/algorithms/math/simd_packet.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief byte mask type
+    //!
+    //! True for mask element types which occupy a single byte and are 
+    //! non-zero for selected elements. Masks of such types can be processed
+    //! by the SIMD mask kernels.
+    //!
+    //! \tparam T mask element type
+    //!
+    template<typename T> struct is_byte_mask
+    {
+        //! result
+        static const bool value = sizeof(T)==1 &&
+                                  (std::is_same<T,bool_t>::value ||
+                                   std::is_same<T,uint8>::value  ||
+                                   std::is_same<T,int8>::value);
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief mask kernel
+    //!
+    //! A mask kernel compresses (copies the selected elements of a packet
+    //! to consecutive memory locations) or expands (distributes consecutive
+    //! elements to the selected positions of a packet) one packet of 
+    //! \c size elements at a time. This default template processes a single
+    //! element. 
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> struct simd_mask_kernel
+    {
+        //! kernel is not vectorized
+        static const bool is_vectorized = false;
+        //! number of elements processed at once
+        static const size_t size = 1;
+
+        //! compress a single element
+        template<typename MT>
+        static size_t compress(const T *src,const MT *mask,T *dest)
+        {
+            if(!*mask) return 0;
+            *dest = *src;
+            return 1;
+        }
+
+        //! expand a single element
+        template<typename MT>
+        static size_t expand(const T *src,const MT *mask,T *dest)
+        {
+            if(!*mask) return 0;
+            *dest = *src;
+            return 1;
+        }
+    };
+
+#ifdef PNI_SIMD_AVX512
+    //
+    // The AVX-512 compress and expand instructions are available for 32 and 
+    // 64 Bit elements. The bit mask is obtained by comparing the mask bytes
+    // with zero.
+    //
+    //! \cond no_doc
+    inline __mmask16 simd_mask_bits16(const void *mask)
+    {
+        __m128i m = _mm_loadu_si128(static_cast<const __m128i*>(mask));
+        return ~_mm_movemask_epi8(_mm_cmpeq_epi8(m,_mm_setzero_si128()));
+    }
+
+    inline __mmask8 simd_mask_bits8(const void *mask)
+    {
+        __m128i m = _mm_loadl_epi64(static_cast<const __m128i*>(mask));
+        return ~_mm_movemask_epi8(_mm_cmpeq_epi8(m,_mm_setzero_si128()));
+    }
+
+    template<typename T> struct simd_mask_kernel32
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 16;
+
+        template<typename MT>
+        static size_t compress(const T *src,const MT *mask,T *dest)
+        {
+            __mmask16 m = simd_mask_bits16(mask);
+            _mm512_mask_compressstoreu_epi32(dest,m,_mm512_loadu_si512(src));
+            return _mm_popcnt_u32(m);
+        }
+
+        template<typename MT>
+        static size_t expand(const T *src,const MT *mask,T *dest)
+        {
+            __mmask16 m = simd_mask_bits16(mask);
+            _mm512_storeu_si512(dest,
+                    _mm512_mask_expandloadu_epi32(_mm512_loadu_si512(dest),
+                                                  m,src));
+            return _mm_popcnt_u32(m);
+        }
+    };
+
+    template<typename T> struct simd_mask_kernel64
+    {
+        static const bool is_vectorized = true;
+        static const size_t size = 8;
+
+        template<typename MT>
+        static size_t compress(const T *src,const MT *mask,T *dest)
+        {
+            __mmask8 m = simd_mask_bits8(mask);
+            _mm512_mask_compressstoreu_epi64(dest,m,_mm512_loadu_si512(src));
+            return _mm_popcnt_u32(m);
+        }
+
+        template<typename MT>
+        static size_t expand(const T *src,const MT *mask,T *dest)
+        {
+            __mmask8 m = simd_mask_bits8(mask);
+            _mm512_storeu_si512(dest,
+                    _mm512_mask_expandloadu_epi64(_mm512_loadu_si512(dest),
+                                                  m,src));
+            return _mm_popcnt_u32(m);
+        }
+    };
+
+    template<> struct simd_mask_kernel<int32>   : simd_mask_kernel32<int32> {};
+    template<> struct simd_mask_kernel<uint32>  : simd_mask_kernel32<uint32> {};
+    template<> struct simd_mask_kernel<float32> : simd_mask_kernel32<float32> {};
+    template<> struct simd_mask_kernel<int64>   : simd_mask_kernel64<int64> {};
+    template<> struct simd_mask_kernel<uint64>  : simd_mask_kernel64<uint64> {};
+    template<> struct simd_mask_kernel<float64> : simd_mask_kernel64<float64> {};
+    //! \endcond
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compress elements
+    //!
+    //! Copies all elements src[i] with mask[i] non-zero to consecutive 
+    //! locations starting at dest. 
+    //!
+    //! \tparam T element type
+    //! \tparam MT mask element type
+    //! \param src pointer to the source elements
+    //! \param mask pointer to the mask
+    //! \param n number of elements in src and mask
+    //! \param dest pointer to the destination 
+    //! \return number of elements written to dest
+    //!
+    template<
+             typename T,
+             typename MT
+            >
+    size_t simd_compress(const T *src,const MT *mask,size_t n,T *dest)
+    {
+        typedef simd_mask_kernel<T> kernel_type;
+        size_t i = 0,k = 0;
+
+        for(;i+kernel_type::size<=n;i+=kernel_type::size)
+            k += kernel_type::compress(src+i,mask+i,dest+k);
+
+        for(;i<n;++i)
+            if(mask[i]) dest[k++] = src[i];
+
+        return k;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief expand elements
+    //!
+    //! The inverse of simd_compress(). Consecutive elements from src are
+    //! written to all dest[i] with mask[i] non-zero. All other elements of
+    //! dest remain unchanged. 
+    //!
+    //! \tparam T element type
+    //! \tparam MT mask element type
+    //! \param src pointer to the source elements
+    //! \param mask pointer to the mask
+    //! \param n number of elements in mask and dest
+    //! \param dest pointer to the destination 
+    //! \return number of elements read from src
+    //!
+    template<
+             typename T,
+             typename MT
+            >
+    size_t simd_expand(const T *src,const MT *mask,size_t n,T *dest)
+    {
+        typedef simd_mask_kernel<T> kernel_type;
+        size_t i = 0,k = 0;
+
+        for(;i+kernel_type::size<=n;i+=kernel_type::size)
+            k += kernel_type::expand(src+k,mask+i,dest+i);
+
+        for(;i<n;++i)
+            if(mask[i]) dest[i] = src[k++];
+
+        return k;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief count selected elements
+    //!
+    //! \tparam MT mask element type
+    //! \param mask pointer to the mask
+    //! \param n number of mask elements
+    //! \return number of non-zero mask elements
+    //!
+    template<typename MT> size_t simd_mask_count(const MT *mask,size_t n)
+    {
+        static_assert(is_byte_mask<MT>::value,"mask must be a byte mask");
+        size_t i = 0,k = 0;
+
+#ifdef PNI_SIMD_AVX512
+        for(;i+64<=n;i+=64)
+        {
+            __m512i m = _mm512_loadu_si512(mask+i);
+            k += _mm_popcnt_u64(_mm512_test_epi8_mask(m,m));
+        }
+#endif
+        const uint8 *bytes = reinterpret_cast<const uint8*>(mask);
+        for(;i<n;++i) k += bytes[i]!=0;
+
+        return k;
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,563 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <pni/core/types/types.hpp>
+
+//
+// Select the widest instruction set available at compile time. The AVX-512
+// code path requires the F, BW and DQ subsets which are available on all
+// CPUs shipping AVX-512 so far.
+//
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__)
+#   define PNI_SIMD_AVX512
+#elif defined(__AVX2__)
+#   define PNI_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define PNI_SIMD_SSE2
+#endif
+
+#if defined(PNI_SIMD_AVX512) || defined(PNI_SIMD_AVX2) || \
+    defined(PNI_SIMD_SSE2)
+#   define PNI_SIMD_ENABLED
+#   include <immintrin.h>
+#endif
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD packet
+    //!
+    //! A packet is the content of a single SIMD register interpreted as a
+    //! small vector of elements of type T. This default template is used for
+    //! all types for which no SIMD implementation exists. In this case
+    //! \c is_vectorized is false and the packet cannot be used.
+    //!
+    //! Specializations provide the register type along with static functions
+    //! for loading, storing and the basic arithmetic operations. As not all
+    //! instruction sets provide all operations for all types each
+    //! specialization indicates by the \c has_mult and \c has_div flags
+    //! whether or not multiplication and division are available.
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> struct simd_packet
+    {
+        //! the register type is the element type itself
+        typedef T type;
+        //! no SIMD implementation for this type
+        static const bool is_vectorized = false;
+        //! no multiplication
+        static const bool has_mult = false;
+        //! no division
+        static const bool has_div = false;
+        //! a packet holds a single element
+        static const size_t size = 1;
+    };
+
+#ifdef PNI_SIMD_ENABLED
+
+    //=========================================================================
+    // instruction set specific register types and intrinsics
+    //=========================================================================
+#if defined(PNI_SIMD_AVX512)
+#   define PNI_SIMD(op) _mm512_##op
+    //! floating point register with single precision elements
+    typedef __m512  simd_float32_register;
+    //! floating point register with double precision elements
+    typedef __m512d simd_float64_register;
+    //! integer register
+    typedef __m512i simd_integer_register;
+
+    inline simd_integer_register simd_load_integer(const void *p)
+    {
+        return _mm512_loadu_si512(p);
+    }
+
+    inline void simd_store_integer(void *p,simd_integer_register v)
+    {
+        _mm512_storeu_si512(p,v);
+    }
+#elif defined(PNI_SIMD_AVX2)
+#   define PNI_SIMD(op) _mm256_##op
+    //! floating point register with single precision elements
+    typedef __m256  simd_float32_register;
+    //! floating point register with double precision elements
+    typedef __m256d simd_float64_register;
+    //! integer register
+    typedef __m256i simd_integer_register;
+
+    inline simd_integer_register simd_load_integer(const void *p)
+    {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+
+    inline void simd_store_integer(void *p,simd_integer_register v)
+    {
+        _mm256_storeu_si256(static_cast<__m256i*>(p),v);
+    }
+#else
+#   define PNI_SIMD(op) _mm_##op
+    //! floating point register with single precision elements
+    typedef __m128  simd_float32_register;
+    //! floating point register with double precision elements
+    typedef __m128d simd_float64_register;
+    //! integer register
+    typedef __m128i simd_integer_register;
+
+    inline simd_integer_register simd_load_integer(const void *p)
+    {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    inline void simd_store_integer(void *p,simd_integer_register v)
+    {
+        _mm_storeu_si128(static_cast<__m128i*>(p),v);
+    }
+#endif
+
+    //=========================================================================
+    // floating point packets
+    //=========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief single precision floating point packet
+    //!
+    template<> struct simd_packet<float32>
+    {
+        //! register type
+        typedef simd_float32_register type;
+        //! packet is vectorized
+        static const bool is_vectorized = true;
+        //! multiplication is available
+        static const bool has_mult = true;
+        //! division is available
+        static const bool has_div = true;
+        //! number of elements in a packet
+        static const size_t size = sizeof(type)/sizeof(float32);
+
+        static type load(const float32 *p) { return PNI_SIMD(loadu_ps)(p); }
+        static void store(float32 *p,type v) { PNI_SIMD(storeu_ps)(p,v); }
+        static type set1(float32 v) { return PNI_SIMD(set1_ps)(v); }
+        static type add(type a,type b) { return PNI_SIMD(add_ps)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_ps)(a,b); }
+        static type mult(type a,type b) { return PNI_SIMD(mul_ps)(a,b); }
+        static type div(type a,type b) { return PNI_SIMD(div_ps)(a,b); }
+
+        //! square root
+        static type sqrt(type a)
+        {
+#if defined(PNI_SIMD_AVX512)
+            //the masked form avoids the undefined source operand of 
+            //_mm512_sqrt_ps (spurious uninitialized warnings with GCC)
+            return _mm512_mask_sqrt_ps(a,__mmask16(~0),a);
+#else
+            return PNI_SIMD(sqrt_ps)(a);
+#endif
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief double precision floating point packet
+    //!
+    template<> struct simd_packet<float64>
+    {
+        //! register type
+        typedef simd_float64_register type;
+        //! packet is vectorized
+        static const bool is_vectorized = true;
+        //! multiplication is available
+        static const bool has_mult = true;
+        //! division is available
+        static const bool has_div = true;
+        //! number of elements in a packet
+        static const size_t size = sizeof(type)/sizeof(float64);
+
+        static type load(const float64 *p) { return PNI_SIMD(loadu_pd)(p); }
+        static void store(float64 *p,type v) { PNI_SIMD(storeu_pd)(p,v); }
+        static type set1(float64 v) { return PNI_SIMD(set1_pd)(v); }
+        static type add(type a,type b) { return PNI_SIMD(add_pd)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_pd)(a,b); }
+        static type mult(type a,type b) { return PNI_SIMD(mul_pd)(a,b); }
+        static type div(type a,type b) { return PNI_SIMD(div_pd)(a,b); }
+
+        //! square root
+        static type sqrt(type a)
+        {
+#if defined(PNI_SIMD_AVX512)
+            //the masked form avoids the undefined source operand of 
+            //_mm512_sqrt_pd (spurious uninitialized warnings with GCC)
+            return _mm512_mask_sqrt_pd(a,__mmask8(~0),a);
+#else
+            return PNI_SIMD(sqrt_pd)(a);
+#endif
+        }
+    };
+
+    //=========================================================================
+    // complex packets
+    //=========================================================================
+    //
+    // Complex numbers are stored interleaved (re,im,re,im,...). Addition and
+    // subtraction are thus identical to the real case. For multiplication
+    // the real and imaginary parts of the second operand are broadcast
+    // to both lanes of a number and
+    //
+    //     (a+ib)(c+id) = (ac - bd) + i(bc + ad)
+    //
+    // is computed as a*[c,c] + swap(a)*[d,d]*[-1,+1]. Division uses
+    //
+    //     (a+ib)/(c+id) = (a+ib)(c-id)/(c^2+d^2)
+    //
+    // which does not include the range scaling done by std::complex.
+    // Results may thus differ in the last bits and for operands close to
+    // the limits of the floating point range.
+    //
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief single precision complex packet
+    //!
+    template<> struct simd_packet<complex32>
+    {
+        //! register type
+        typedef simd_float32_register type;
+        //! packet is vectorized
+        static const bool is_vectorized = true;
+        //! multiplication is available
+        static const bool has_mult = true;
+        //! division is available
+        static const bool has_div = true;
+        //! number of complex elements in a packet
+        static const size_t size = sizeof(type)/sizeof(complex32);
+
+        static type load(const complex32 *p)
+        {
+            return PNI_SIMD(loadu_ps)(reinterpret_cast<const float32*>(p));
+        }
+
+        static void store(complex32 *p,type v)
+        {
+            PNI_SIMD(storeu_ps)(reinterpret_cast<float32*>(p),v);
+        }
+
+        static type set1(complex32 v)
+        {
+#if defined(PNI_SIMD_AVX512)
+            return _mm512_setr4_ps(v.real(),v.imag(),v.real(),v.imag());
+#elif defined(PNI_SIMD_AVX2)
+            return _mm256_setr_ps(v.real(),v.imag(),v.real(),v.imag(),
+                                  v.real(),v.imag(),v.real(),v.imag());
+#else
+            return _mm_setr_ps(v.real(),v.imag(),v.real(),v.imag());
+#endif
+        }
+
+        static type add(type a,type b) { return PNI_SIMD(add_ps)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_ps)(a,b); }
+
+        //! duplicate the real parts
+        static type real_dup(type a)
+        {
+#if defined(PNI_SIMD_AVX512) || defined(PNI_SIMD_AVX2)
+            return PNI_SIMD(moveldup_ps)(a);
+#else
+            return _mm_shuffle_ps(a,a,_MM_SHUFFLE(2,2,0,0));
+#endif
+        }
+
+        //! duplicate the imaginary parts
+        static type imag_dup(type a)
+        {
+#if defined(PNI_SIMD_AVX512) || defined(PNI_SIMD_AVX2)
+            return PNI_SIMD(movehdup_ps)(a);
+#else
+            return _mm_shuffle_ps(a,a,_MM_SHUFFLE(3,3,1,1));
+#endif
+        }
+
+        //! exchange real and imaginary parts
+        static type swap(type a)
+        {
+#if defined(PNI_SIMD_AVX512) || defined(PNI_SIMD_AVX2)
+            return PNI_SIMD(permute_ps)(a,0xB1);
+#else
+            return _mm_shuffle_ps(a,a,_MM_SHUFFLE(2,3,0,1));
+#endif
+        }
+
+        //! flip the sign of the real parts
+        static type negate_real(type a)
+        {
+            return PNI_SIMD(xor_ps)(a,set1(complex32(-0.0f,0.0f)));
+        }
+
+        //! flip the sign of the imaginary parts
+        static type negate_imag(type a)
+        {
+            return PNI_SIMD(xor_ps)(a,set1(complex32(0.0f,-0.0f)));
+        }
+
+        static type mult(type a,type b)
+        {
+            return PNI_SIMD(add_ps)(PNI_SIMD(mul_ps)(a,real_dup(b)),
+                        negate_real(PNI_SIMD(mul_ps)(swap(a),imag_dup(b))));
+        }
+
+        static type div(type a,type b)
+        {
+            type b2 = PNI_SIMD(mul_ps)(b,b);
+            type n  = PNI_SIMD(add_ps)(b2,swap(b2));
+            return PNI_SIMD(div_ps)(mult(a,negate_imag(b)),n);
+        }
+
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief double precision complex packet
+    //!
+    template<> struct simd_packet<complex64>
+    {
+        //! register type
+        typedef simd_float64_register type;
+        //! packet is vectorized
+        static const bool is_vectorized = true;
+        //! multiplication is available
+        static const bool has_mult = true;
+        //! division is available
+        static const bool has_div = true;
+        //! number of complex elements in a packet
+        static const size_t size = sizeof(type)/sizeof(complex64);
+
+        static type load(const complex64 *p)
+        {
+            return PNI_SIMD(loadu_pd)(reinterpret_cast<const float64*>(p));
+        }
+
+        static void store(complex64 *p,type v)
+        {
+            PNI_SIMD(storeu_pd)(reinterpret_cast<float64*>(p),v);
+        }
+
+        static type set1(complex64 v)
+        {
+#if defined(PNI_SIMD_AVX512)
+            return _mm512_setr4_pd(v.real(),v.imag(),v.real(),v.imag());
+#elif defined(PNI_SIMD_AVX2)
+            return _mm256_setr_pd(v.real(),v.imag(),v.real(),v.imag());
+#else
+            return _mm_setr_pd(v.real(),v.imag());
+#endif
+        }
+
+        static type add(type a,type b) { return PNI_SIMD(add_pd)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_pd)(a,b); }
+
+        //! duplicate the real parts
+        static type real_dup(type a)
+        {
+#if defined(PNI_SIMD_AVX512) || defined(PNI_SIMD_AVX2)
+            return PNI_SIMD(movedup_pd)(a);
+#else
+            return _mm_shuffle_pd(a,a,0x0);
+#endif
+        }
+
+        //! duplicate the imaginary parts
+        static type imag_dup(type a)
+        {
+#if defined(PNI_SIMD_AVX512)
+            return _mm512_permute_pd(a,0xFF);
+#elif defined(PNI_SIMD_AVX2)
+            return _mm256_permute_pd(a,0xF);
+#else
+            return _mm_shuffle_pd(a,a,0x3);
+#endif
+        }
+
+        //! exchange real and imaginary parts
+        static type swap(type a)
+        {
+#if defined(PNI_SIMD_AVX512)
+            return _mm512_permute_pd(a,0x55);
+#elif defined(PNI_SIMD_AVX2)
+            return _mm256_permute_pd(a,0x5);
+#else
+            return _mm_shuffle_pd(a,a,0x1);
+#endif
+        }
+
+        //! flip the sign of the real parts
+        static type negate_real(type a)
+        {
+            return PNI_SIMD(xor_pd)(a,set1(complex64(-0.0,0.0)));
+        }
+
+        //! flip the sign of the imaginary parts
+        static type negate_imag(type a)
+        {
+            return PNI_SIMD(xor_pd)(a,set1(complex64(0.0,-0.0)));
+        }
+
+        static type mult(type a,type b)
+        {
+            return PNI_SIMD(add_pd)(PNI_SIMD(mul_pd)(a,real_dup(b)),
+                        negate_real(PNI_SIMD(mul_pd)(swap(a),imag_dup(b))));
+        }
+
+        static type div(type a,type b)
+        {
+            type b2 = PNI_SIMD(mul_pd)(b,b);
+            type n  = PNI_SIMD(add_pd)(b2,swap(b2));
+            return PNI_SIMD(div_pd)(mult(a,negate_imag(b)),n);
+        }
+    };
+
+    //=========================================================================
+    // integer packets
+    //=========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief integer operations by element width
+    //!
+    //! Addition, subtraction and the lower half of a multiplication are
+    //! identical for signed and unsigned integers. The operations thus only
+    //! depend on the number of bytes of an element. There is no integer
+    //! division on any of the supported instruction sets.
+    //!
+    //! \tparam N number of bytes per element
+    //!
+    template<size_t N> struct simd_integer_ops;
+
+    //! \cond no_doc
+    template<> struct simd_integer_ops<1>
+    {
+        typedef simd_integer_register type;
+        static const bool has_mult = false;
+        static type set1(int8 v) { return PNI_SIMD(set1_epi8)(v); }
+        static type add(type a,type b) { return PNI_SIMD(add_epi8)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_epi8)(a,b); }
+        static type mult(type a,type) { return a; }
+    };
+
+    template<> struct simd_integer_ops<2>
+    {
+        typedef simd_integer_register type;
+        static const bool has_mult = true;
+        static type set1(int16 v) { return PNI_SIMD(set1_epi16)(v); }
+        static type add(type a,type b) { return PNI_SIMD(add_epi16)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_epi16)(a,b); }
+        static type mult(type a,type b) { return PNI_SIMD(mullo_epi16)(a,b); }
+    };
+
+    template<> struct simd_integer_ops<4>
+    {
+        typedef simd_integer_register type;
+#if defined(PNI_SIMD_SSE2) && !defined(__SSE4_1__)
+        static const bool has_mult = false;
+        static type mult(type a,type) { return a; }
+#else
+        static const bool has_mult = true;
+        static type mult(type a,type b) { return PNI_SIMD(mullo_epi32)(a,b); }
+#endif
+        static type set1(int32 v) { return PNI_SIMD(set1_epi32)(v); }
+        static type add(type a,type b) { return PNI_SIMD(add_epi32)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_epi32)(a,b); }
+    };
+
+    template<> struct simd_integer_ops<8>
+    {
+        typedef simd_integer_register type;
+#if defined(PNI_SIMD_AVX512)
+        static const bool has_mult = true;
+        static type mult(type a,type b) { return _mm512_mullo_epi64(a,b); }
+        static type set1(int64 v) { return _mm512_set1_epi64(v); }
+#else
+        static const bool has_mult = false;
+        static type mult(type a,type) { return a; }
+        static type set1(int64 v) { return PNI_SIMD(set1_epi64x)(v); }
+#endif
+        static type add(type a,type b) { return PNI_SIMD(add_epi64)(a,b); }
+        static type sub(type a,type b) { return PNI_SIMD(sub_epi64)(a,b); }
+    };
+    //! \endcond
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief integer packet
+    //!
+    //! Common implementation for all integer packets.
+    //!
+    //! \tparam T integer type
+    //!
+    template<typename T> struct simd_integer_packet
+    {
+        //! integer operations
+        typedef simd_integer_ops<sizeof(T)> ops_type;
+        //! register type
+        typedef simd_integer_register type;
+        //! packet is vectorized
+        static const bool is_vectorized = true;
+        //! multiplication depends on the element width
+        static const bool has_mult = ops_type::has_mult;
+        //! no integer division
+        static const bool has_div = false;
+        //! number of elements in a packet
+        static const size_t size = sizeof(type)/sizeof(T);
+
+        static type load(const T *p) { return simd_load_integer(p); }
+        static void store(T *p,type v) { simd_store_integer(p,v); }
+        static type set1(T v) { return ops_type::set1(v); }
+        static type add(type a,type b) { return ops_type::add(a,b); }
+        static type sub(type a,type b) { return ops_type::sub(a,b); }
+        static type mult(type a,type b) { return ops_type::mult(a,b); }
+        static type div(type a,type) { return a; }
+    };
+
+    //! \cond no_doc
+    template<> struct simd_packet<int8>   : simd_integer_packet<int8> {};
+    template<> struct simd_packet<uint8>  : simd_integer_packet<uint8> {};
+    template<> struct simd_packet<int16>  : simd_integer_packet<int16> {};
+    template<> struct simd_packet<uint16> : simd_integer_packet<uint16> {};
+    template<> struct simd_packet<int32>  : simd_integer_packet<int32> {};
+    template<> struct simd_packet<uint32> : simd_integer_packet<uint32> {};
+    template<> struct simd_packet<int64>  : simd_integer_packet<int64> {};
+    template<> struct simd_packet<uint64> : simd_integer_packet<uint64> {};
+    //! \endcond
+
+#undef PNI_SIMD
+#endif
+
+//end of namespace
+}
+}
@@ -26,11 +26,21 @@
 #include <vector>
 #include <array>
 #include <pni/core/arrays/mdarray.hpp>
+#include <pni/core/arrays/aligned_allocator.hpp>
+#include <pni/core/arrays/mapped_storage.hpp>
+#include <pni/core/arrays/external_storage.hpp>
+#include <pni/core/arrays/chunked_storage.hpp>
+#include <pni/core/arrays/chunked_operations.hpp>
+#include <pni/core/arrays/frame_ring_buffer.hpp>
+#include <pni/core/arrays/bitmask_array.hpp>
+#include <pni/core/arrays/soa_complex_array.hpp>
 #include <pni/core/arrays/array_view.hpp>
 #include <pni/core/arrays/array_factory.hpp>
 #include <pni/core/arrays/slice.hpp>
 #include <pni/core/arrays/array_arithmetic.hpp>
+#include <pni/core/arrays/array_indexing.hpp>
 #include <pni/core/arrays/index_iterator.hpp>
+#include <pni/core/arrays/tiled_conversion.hpp>
 #include <boost/mpl/size_t.hpp>
 
 
@@ -113,6 +123,190 @@ namespace core{
                                            >,
                                  static_cindex_map<NDIMS...>
                                 >;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array with aligned storage
+    //!
+    //! Like dynamic_array but the data is aligned to ALIGNMENT bytes. The 
+    //! default of 64 Bytes matches the cache line size and the widest 
+    //! vector registers (AVX-512) and thus allows SIMD code to use aligned
+    //! loads and stores. 
+    //!
+    //! \code
+    //! typedef aligned_dynamic_array<float32> array_type;
+    //!
+    //! auto a = array_type::create(shape_t{1024,1024});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //! \tparam ALIGNMENT alignment in bytes
+    //!
+    template<
+             typename T,
+             size_t ALIGNMENT = 64
+            >
+    using aligned_dynamic_array = mdarray<aligned_vector<T,ALIGNMENT>,
+                                          dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief fixed dimension array with aligned storage
+    //!
+    //! Like fixed_dim_array but the data is aligned to ALIGNMENT bytes.
+    //!
+    //! \tparam T element type
+    //! \tparam D number of dimensions
+    //! \tparam ALIGNMENT alignment in bytes
+    //!
+    template<
+             typename T,
+             size_t D,
+             size_t ALIGNMENT = 64
+            >
+    using aligned_fixed_dim_array = mdarray<aligned_vector<T,ALIGNMENT>,
+                                            fixed_dim_cindex_map<D>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array backed by huge pages
+    //!
+    //! A dynamic array whose data is allocated with aligned_allocator and 
+    //! huge page support enabled. Arrays of at least 2 MByte are aligned to 
+    //! the huge page size and the kernel is asked to back them with 
+    //! transparent huge pages. Use this for very large arrays (detector 
+    //! stacks, ...) where TLB misses become noticeable.
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using hugepage_dynamic_array = mdarray<aligned_vector<T,64,true>,
+                                           dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief aligned dynamic array with default initialized storage
+    //!
+    //! Like aligned_dynamic_array but the storage (default_init_vector) 
+    //! does not initialize its elements. array_factory::create() still 
+    //! fills the array. The uninitialized and first touch versions of 
+    //! create() leave the memory untouched so that the pages are placed 
+    //! by the threads writing them first.
+    //!
+    //! \code
+    //! typedef default_init_dynamic_array<float64> array_type;
+    //! typedef array_factory<array_type> factory;
+    //!
+    //! auto a = factory::create(shape_t{8192,8192},first_touch_creation());
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //! \tparam ALIGNMENT alignment in bytes
+    //!
+    template<
+             typename T,
+             size_t ALIGNMENT = 64
+            >
+    using default_init_dynamic_array = mdarray<default_init_vector<T,ALIGNMENT>,
+                                               dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief memory mapped array
+    //!
+    //! A dynamic array whose data resides in a memory mapped file. Use the 
+    //! map() and create_mapped() functions of array_factory to create 
+    //! instances. Copying such an array copies its data to anonymous 
+    //! memory, moving it transfers the mapping.
+    //!
+    //! \code
+    //! typedef mapped_array<uint16> array_type;
+    //! typedef array_factory<array_type> factory;
+    //!
+    //! auto frames = factory::map("frames.raw",shape_t{100,2048,2048});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using mapped_array = mdarray<mapped_storage<T>,dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief array over an external buffer
+    //!
+    //! A dynamic array which does not own its data but refers to a buffer 
+    //! owned by somebody else. Instances are created with the wrap() 
+    //! functions of array_factory. Views, expressions, and inplace 
+    //! arithmetics work as for any other array.
+    //!
+    //! \code
+    //! typedef external_array<uint16> array_type;
+    //! typedef array_factory<array_type> factory;
+    //!
+    //! auto frame = factory::wrap(driver_buffer,shape_t{2048,2048});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using external_array = mdarray<external_storage<T>,dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief array made of separately allocated chunks
+    //!
+    //! A dynamic array whose data is not allocated as a single block but in
+    //! chunks (see chunked_storage). Use the create_chunked() function of 
+    //! array_factory to choose the shape of a chunk. Expressions, 
+    //! assign(), min(), max(), and the clip functions process such an 
+    //! array chunk by chunk and in parallel (see for_each_chunk()).
+    //!
+    //! \code
+    //! typedef chunked_array<float32> array_type;
+    //! typedef array_factory<array_type> factory;
+    //!
+    //! auto volume = factory::create_chunked(shape_t{6400,2048,2048},
+    //!                                       shape_t{16,2048,2048});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using chunked_array = mdarray<chunked_storage<T>,dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array with tiled storage
+    //!
+    //! A dynamic array storing its data in tiles of TILE elements along 
+    //! each dimension (see tiled_index_map_imp). Neighbors along all 
+    //! dimensions are close in memory which makes this type well suited 
+    //! for stencils and transposes of large images and volumes. Use 
+    //! to_tiled() and from_tiled() to convert from and to C-ordered arrays.
+    //!
+    //! \code
+    //! typedef tiled_array<float32,32> image_type;
+    //!
+    //! auto image = image_type::create(shape_t{4096,4096});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //! \tparam TILE number of elements along each dimension of a tile
+    //!
+    template<
+             typename T,
+             size_t TILE = 32
+            >
+    using tiled_array = mdarray<std::vector<T>,dynamic_tiled_index_map<TILE>>;
    
 //end of namespace
 }
@@ -0,0 +1,312 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <type_traits>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief size of a transparent huge page 
+    //!
+    static const size_t huge_page_size = 2*1024*1024;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief aligned allocator
+    //!
+    //! An STL compliant allocator returning memory aligned to ALIGNMENT 
+    //! bytes. Used as the allocator of a std::vector the resulting container
+    //! can be used as storage for mdarray. As it is still a std::vector 
+    //! container_utils and array_factory work without any modification.
+    //! Like with std::allocator elements are value initialized on 
+    //! construction unless DEFAULT_INIT is true.
+    /*!
+    \code
+    typedef std::vector<float32,aligned_allocator<float32,64>> storage_type;
+    typedef mdarray<storage_type,dynamic_cindex_map> array_type;
+
+    auto a = array_type::create(shape_t{1024,1024});
+    //a.data() is 64 Byte aligned
+    \endcode
+    !*/
+    //!
+    //! If HUGE_PAGES is true, allocations of at least huge_page_size bytes 
+    //! are aligned to huge_page_size and marked with 
+    //! madvise(MADV_HUGEPAGE). The kernel can then back the memory with 
+    //! transparent huge pages which reduces the number of TLB misses when 
+    //! working with very large arrays. On systems without transparent 
+    //! huge page support the flag only affects the alignment.
+    //!
+    //! If DEFAULT_INIT is true elements are default initialized instead. 
+    //! For trivially constructible types this leaves the memory untouched 
+    //! which avoids writing every element twice when a container is 
+    //! created and filled afterwards, and allows the pages to be touched 
+    //! first by the threads processing them (see default_init_vector and 
+    //! array_factory).
+    //!
+    //! \tparam T element type
+    //! \tparam ALIGNMENT alignment in bytes (a power of two)
+    //! \tparam HUGE_PAGES use transparent huge pages for large allocations
+    //! \tparam DEFAULT_INIT default initialize elements 
+    //!
+    template<
+             typename T,
+             size_t ALIGNMENT = 64,
+             bool HUGE_PAGES = false,
+             bool DEFAULT_INIT = false
+            >
+    class aligned_allocator
+    {
+        static_assert(ALIGNMENT && !(ALIGNMENT & (ALIGNMENT-1)),
+                      "Alignment must be a power of two!");
+        static_assert(ALIGNMENT>=std::alignment_of<T>::value,
+                      "Alignment must not be smaller than that of the type!");
+        public:
+            //=================public types====================================
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T* pointer;
+            //! const pointer type
+            typedef const T* const_pointer;
+            //! reference type
+            typedef T& reference;
+            //! const reference type
+            typedef const T& const_reference;
+            //! size type
+            typedef size_t size_type;
+            //! pointer difference type
+            typedef std::ptrdiff_t difference_type;
+
+            //! allocator for a different element type
+            template<typename U> struct rebind
+            {
+                //! rebound allocator type
+                typedef aligned_allocator<U,ALIGNMENT,HUGE_PAGES,DEFAULT_INIT> 
+                        other;
+            };
+
+            //! alignment of the allocated memory
+            static const size_t alignment = ALIGNMENT;
+
+            //=================constructors====================================
+            //! default constructor
+            aligned_allocator() noexcept {}
+
+            //-----------------------------------------------------------------
+            //! conversion from an allocator for a different type
+            template<typename U>
+            aligned_allocator(const aligned_allocator<U,ALIGNMENT,HUGE_PAGES,
+                                                      DEFAULT_INIT> &) noexcept
+            {}
+
+            //=================public methods==================================
+            //!
+            //! \brief allocate memory
+            //!
+            //! \throws std::bad_alloc if the allocation fails
+            //! \param n number of elements
+            //! \return pointer to aligned memory for n elements
+            //!
+            pointer allocate(size_type n)
+            {
+                if(n==0) return nullptr;
+                if(n>size_type(-1)/sizeof(T)) throw std::bad_alloc();
+
+                size_t bytes = n*sizeof(T);
+                size_t align = ALIGNMENT;
+                if(HUGE_PAGES && bytes>=huge_page_size && align<huge_page_size)
+                    align = huge_page_size;
+
+                void *ptr = nullptr;
+#ifdef _MSC_VER
+                ptr = _aligned_malloc(bytes,align);
+#else
+                if(align<sizeof(void*)) align = sizeof(void*);
+                if(posix_memalign(&ptr,align,bytes)) ptr = nullptr;
+#endif
+                if(!ptr) throw std::bad_alloc();
+
+#if defined(MADV_HUGEPAGE)
+                if(HUGE_PAGES && bytes>=huge_page_size)
+                    madvise(ptr,bytes,MADV_HUGEPAGE);
+#endif
+
+                return static_cast<pointer>(ptr);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief initialize an element
+            //!
+            //! The element is value initialized or, if DEFAULT_INIT is 
+            //! true, default initialized.
+            //!
+            //! \tparam U element type
+            //! \param p address of the element
+            //!
+            template<typename U> void construct(U *p)
+            {
+                if(DEFAULT_INIT)
+                    ::new(static_cast<void*>(p)) U;
+                else
+                    ::new(static_cast<void*>(p)) U();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construct an element
+            //!
+            //! \tparam U element type
+            //! \tparam ARGS constructor argument types
+            //! \param p address of the element
+            //! \param args constructor arguments
+            //!
+            template<
+                     typename U,
+                     typename ...ARGS
+                    >
+            void construct(U *p,ARGS&& ...args)
+            {
+                ::new(static_cast<void*>(p)) U(std::forward<ARGS>(args)...);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief free memory
+            //!
+            //! \param p pointer returned by allocate()
+            //!
+            void deallocate(pointer p,size_type) noexcept
+            {
+#ifdef _MSC_VER
+                _aligned_free(p);
+#else
+                std::free(p);
+#endif
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief equality of aligned allocators
+    //!
+    //! All aligned allocators with equal parameters are equal as memory 
+    //! allocated by one can be released by the other.
+    //!
+    template<
+             typename T,
+             typename U,
+             size_t ALIGNMENT,
+             bool HUGE_PAGES,
+             bool DEFAULT_INIT
+            >
+    bool operator==(const aligned_allocator<T,ALIGNMENT,HUGE_PAGES,
+                                            DEFAULT_INIT> &,
+                    const aligned_allocator<U,ALIGNMENT,HUGE_PAGES,
+                                            DEFAULT_INIT> &)
+    {
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief inequality of aligned allocators
+    //!
+    template<
+             typename T,
+             typename U,
+             size_t ALIGNMENT,
+             bool HUGE_PAGES,
+             bool DEFAULT_INIT
+            >
+    bool operator!=(const aligned_allocator<T,ALIGNMENT,HUGE_PAGES,
+                                            DEFAULT_INIT> &a,
+                    const aligned_allocator<U,ALIGNMENT,HUGE_PAGES,
+                                            DEFAULT_INIT> &b)
+    {
+        return !(a==b);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief aligned vector
+    //!
+    //! A std::vector whose data is aligned to ALIGNMENT bytes.
+    //!
+    //! \tparam T element type
+    //! \tparam ALIGNMENT alignment in bytes
+    //! \tparam HUGE_PAGES use transparent huge pages for large allocations
+    //!
+    template<
+             typename T,
+             size_t ALIGNMENT = 64,
+             bool HUGE_PAGES = false
+            >
+    using aligned_vector = std::vector<T,
+                                       aligned_allocator<T,ALIGNMENT,HUGE_PAGES>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief aligned vector with default initialization
+    //!
+    //! An aligned_vector whose elements are default initialized. 
+    //! Constructing or resizing the vector does not touch the memory of 
+    //! trivially constructible elements. Their values are indeterminate 
+    //! until written.
+    //!
+    //! \tparam T element type
+    //! \tparam ALIGNMENT alignment in bytes
+    //! \tparam HUGE_PAGES use transparent huge pages for large allocations
+    //!
+    template<
+             typename T,
+             size_t ALIGNMENT = 64,
+             bool HUGE_PAGES = false
+            >
+    using default_init_vector = 
+          std::vector<T,aligned_allocator<T,ALIGNMENT,HUGE_PAGES,true>>;
+
+//end of namespace
+}
+}
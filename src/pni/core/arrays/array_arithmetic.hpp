@@ -53,6 +53,36 @@ namespace core{
     template<typename T>
     using ipa_type = typename T::inplace_arithmetic;
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief index map of a binary operation
+    //!
+    //! Returns the index map of the left operand if its shape is the 
+    //! broadcast shape of both operands (see broadcast_shape()). Otherwise
+    //! a map of the type of the left operand is created for this shape. 
+    //!
+    //! \throws shape_mismatch_error if the operands cannot be broadcast or
+    //! if the map of the left operand cannot represent the broadcast shape
+    //! \tparam LHS left hand side array type
+    //! \tparam RHS right hand side array type
+    //! \param a left operand instance
+    //! \param b right operand instance
+    //! \return index map of the result
+    //!
+    template<
+             typename LHS,
+             typename RHS
+            >
+    map_type<LHS> result_map(const LHS &a,const RHS &b)
+    {
+        shape_t a_shape = a.template shape<shape_t>();
+        shape_t shape = broadcast_shape(a_shape,b.template shape<shape_t>());
+        if(a_shape==shape) return a.map();
+
+        return map_utils<map_type<LHS>>::create(shape);
+    }
+
 
     //======================binary addition operator===========================
     //!
@@ -60,6 +90,8 @@ namespace core{
     //! \brief binary addition operator 
     //! 
     //! Addition between two instaces of array like objects.
+    //! Operands with different shapes are broadcast 
+    //! (see broadcast_shape()).
     //!  
     //! \code
     //! mdarray<...> a = ...;
@@ -86,7 +118,7 @@ namespace core{
         typedef add_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> return_type;
 
-        return return_type(a.map(),operator_type(a,b));
+        return return_type(result_map(a,b),operator_type(a,b));
     }
 
     //-------------------------------------------------------------------------
@@ -168,6 +200,8 @@ namespace core{
     //! \brief binary subtraction operator 
     //!  
     //! Subtraction between two array like objects.
+    //! Operands with different shapes are broadcast 
+    //! (see broadcast_shape()).
     //! 
     //! \code
     //! mdarray<...> a = ...;
@@ -194,7 +228,7 @@ namespace core{
         typedef sub_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> result_type;
 
-        return result_type(a.map(),operator_type(a,b));
+        return result_type(result_map(a,b),operator_type(a,b));
     }
 
     //-------------------------------------------------------------------------
@@ -275,6 +309,8 @@ namespace core{
     //! \brief binary division operator 
     //!
     //! Binary division between two array objects
+    //! Operands with different shapes are broadcast 
+    //! (see broadcast_shape()).
     //! 
     //! \code
     //! mdarray<...> a = ...;
@@ -300,7 +336,7 @@ namespace core{
         typedef div_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> result_type;
 
-        return result_type(a.map(),operator_type(a,b));
+        return result_type(result_map(a,b),operator_type(a,b));
     }
 
     //-------------------------------------------------------------------------
@@ -381,6 +417,8 @@ namespace core{
     //! \brief binary multiplication operator
     //!
     //! Multiplication between two array type instances
+    //! Operands with different shapes are broadcast 
+    //! (see broadcast_shape()).
     //! \code
     //! mdarray<...> a = ...;
     //! mdarray<...> b = ...;
@@ -405,7 +443,7 @@ namespace core{
         typedef mult_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> result_type;
 
-        return result_type(a.map(),operator_type(a,b));
+        return result_type(result_map(a,b),operator_type(a,b));
     }
 
     //-------------------------------------------------------------------------
@@ -24,11 +24,34 @@
 #pragma once
 
 #include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
 #include <pni/core/utilities/container_utils.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+#include <pni/core/arrays/mapped_file.hpp>
 
 namespace pni{
 namespace core{
 
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief uninitialized array creation
+    //!
+    //! Tag type selecting array creation without initialization of the 
+    //! elements.
+    //!
+    struct uninitialized_creation {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief parallel first touch array creation
+    //!
+    //! Tag type selecting array creation where the elements are initialized
+    //! in parallel by the threads of the default_thread_pool().
+    //!
+    struct first_touch_creation {};
 
     //-------------------------------------------------------------------------
     //!
@@ -91,6 +114,86 @@ namespace core{
             return array_type(std::move(map),std::move(storage));
         }
 
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create an uninitialized array
+        //!
+        //! Creates an array without writing its elements. Whether the 
+        //! memory is touched at all is decided by the storage: 
+        //! default_init_vector and mapped_storage leave it untouched, 
+        //! std::vector and aligned_vector value initialize their elements 
+        //! once. Use this if all elements are overwritten anyway.
+        /*!
+        \code
+        typedef default_init_dynamic_array<float32> array_type;
+        typedef array_factory<array_type> factory;
+
+        auto a = factory::create(shape_t{2048,2048},uninitialized_creation());
+        \endcode
+        !*/
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type create(const STYPE &s,uninitialized_creation)
+        {
+            static_assert(std::is_trivially_default_constructible<value_type>::value,
+                          "Only trivially constructible types can be left "
+                          "uninitialized!");
+
+            auto map = map_utils<map_type>::create(s);
+            storage_type storage(map.max_elements());
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create an array with parallel first touch
+        //!
+        //! Creates an array and initializes its elements with def_val 
+        //! using the same partitioning and threads as the parallel 
+        //! algorithms (see parallel_for_chunks). On NUMA systems the 
+        //! operating system places a page on the node of the thread 
+        //! writing it first. Thus the data ends up close to the threads 
+        //! processing it later on. 
+        /*!
+        \code
+        typedef default_init_dynamic_array<float64> array_type;
+        typedef array_factory<array_type> factory;
+
+        auto a = factory::create(shape_t{8192,8192},first_touch_creation());
+        auto b = factory::create(shape_t{8192,8192},first_touch_creation(),1.);
+        \endcode
+        !*/
+        //!
+        //! For a correct placement the storage must not touch the memory 
+        //! on construction (see the uninitialized version of create). 
+        //! Arrays smaller than parallel_threshold() are initialized by 
+        //! the calling thread.
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \param def_val initial value of all elements
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type create(const STYPE &s,first_touch_creation,
+                                 value_type def_val = value_type())
+        {
+            auto map = map_utils<map_type>::create(s);
+            storage_type storage(map.max_elements());
+            array_type a(std::move(map),std::move(storage));
+
+            parallel_for_chunks(a,[&a,&def_val](size_t begin,size_t end)
+            {
+                std::fill(a.begin()+begin,a.begin()+end,def_val);
+            });
+
+            return a;
+        }
+
         //---------------------------------------------------------------------
         //!
         //! \brief create array from shape and data
@@ -187,6 +290,172 @@ namespace core{
             std::copy(data.begin(),data.end(),storage.begin());
             return array_type(std::move(map),std::move(storage));
         }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief map an existing file
+        //!
+        //! Creates an array whose data is a memory mapped region of an 
+        //! existing file. The storage type of the array must be 
+        //! mapped_storage. The data starts offset bytes after the beginning 
+        //! of the file which allows skipping a file header. Changes to the
+        //! elements of a READ_ONLY array are not written to the file.
+        /*!
+        \code
+        typedef mapped_array<uint16> array_type;
+        typedef array_factory<array_type> factory;
+
+        auto a = factory::map("frames.raw",shape_t{100,2048,2048});
+        auto b = factory::map("frames.raw",shape_t{2048,2048},
+                              map_mode::READ_WRITE,512);
+        \endcode
+        !*/
+        //!
+        //! \throws file_error if the file cannot be opened or mapped
+        //! \throws size_mismatch_error if the file is too small
+        //! \tparam STYPE container type for the shape
+        //! \param path path to the file
+        //! \param s shape of the array
+        //! \param mode access mode
+        //! \param offset offset of the data in bytes
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type map(const string &path,const STYPE &s,
+                              map_mode mode = map_mode::READ_ONLY,
+                              size_t offset = 0)
+        {
+            auto map = map_utils<map_type>::create(s);
+            auto storage = storage_type::map(path,map.max_elements(),mode,
+                                             offset);
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create a memory mapped file
+        //!
+        //! Creates a new file large enough to hold an array of the requested 
+        //! shape and returns an array mapping it read-write. An existing file
+        //! will be truncated. The storage type of the array must be 
+        //! mapped_storage. All elements are initialized to zero.
+        //!
+        //! \throws file_error if the file cannot be created or mapped
+        //! \tparam STYPE container type for the shape
+        //! \param path path to the new file
+        //! \param s shape of the array
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type create_mapped(const string &path,const STYPE &s)
+        {
+            auto map = map_utils<map_type>::create(s);
+            auto storage = storage_type::create(path,map.max_elements());
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create a chunked array
+        //!
+        //! Creates an array whose data is split into separately allocated 
+        //! chunks of shape c. The storage type of the array must be 
+        //! chunked_storage. As the chunks are blocks of the linear storage
+        //! a chunk has to span all but the first dimension of the array.
+        //! The last chunk holds the remaining entries along the first 
+        //! dimension. All elements are value initialized.
+        /*!
+        \code
+        typedef chunked_array<uint16> array_type;
+        typedef array_factory<array_type> factory;
+
+        //chunks of 64 frames
+        auto stack = factory::create_chunked(shape_t{100000,2048,2048},
+                                             shape_t{64,2048,2048});
+        \endcode
+        !*/
+        //!
+        //! \throws shape_mismatch_error if the chunk shape does not match 
+        //! the shape of the array along all but the first dimension or if 
+        //! the chunk is empty
+        //! \tparam STYPE container type for the shape
+        //! \tparam CTYPE container type for the chunk shape
+        //! \param s shape of the array
+        //! \param c shape of a chunk
+        //! \return instance of array_type
+        //!
+        template<
+                 typename STYPE,
+                 typename CTYPE
+                >
+        static array_type create_chunked(const STYPE &s,const CTYPE &c)
+        {
+            static_assert(map_type::implementation_type::c_order,
+                          "Chunks require an array in C order!");
+
+            if(c.size()!=s.size() || !s.size() || !*c.begin() ||
+               !std::equal(std::next(s.begin()),s.end(),std::next(c.begin())))
+                throw shape_mismatch_error(EXCEPTION_RECORD,
+                        "Chunk shape does not match the shape of the array!");
+
+            size_t chunk_size = 1;
+            for(auto n: c) chunk_size *= n;
+
+            auto map = map_utils<map_type>::create(s);
+            storage_type storage(map.max_elements(),chunk_size ? chunk_size : 1);
+            return array_type(std::move(map),std::move(storage));
+        }
+        //---------------------------------------------------------------------
+        //!
+        //! \brief wrap an external buffer
+        //!
+        //! Creates an array referring to a buffer owned by somebody else. 
+        //! No data is copied. The storage type of the array must be 
+        //! constructible from a pointer and a number of elements (like 
+        //! external_storage). The buffer must hold at least as many 
+        //! elements as required by the shape and must outlive the array.
+        /*!
+        \code
+        typedef external_array<float32> array_type;
+        typedef array_factory<array_type> factory;
+
+        std::vector<float32> buffer(1024*1024);
+        auto a = factory::wrap(buffer.data(),shape_t{1024,1024});
+        \endcode
+        !*/
+        //!
+        //! \tparam STYPE container type for the shape
+        //! \param data pointer to the first element of the buffer
+        //! \param s shape of the array
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type wrap(value_type *data,const STYPE &s)
+        {
+            auto map = map_utils<map_type>::create(s);
+            storage_type storage(data,map.max_elements());
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief wrap an external buffer
+        //!
+        //! Like the above version but takes the shape from an initializer 
+        //! list.
+        //!
+        //! \tparam IT shape value type
+        //! \param data pointer to the first element of the buffer
+        //! \param shape initializer list with the shape
+        //! \return instance of array_type
+        //!
+        template<typename IT>
+        static array_type wrap(value_type *data,std::initializer_list<IT> shape)
+        {
+            auto map = map_utils<map_type>::create(shape);
+            storage_type storage(data,map.max_elements());
+            return array_type(std::move(map),std::move(storage));
+        }
         
     };
     
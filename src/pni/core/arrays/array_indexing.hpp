@@ -0,0 +1,322 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/arrays/mdarray.hpp>
+#include <pni/core/arrays/masked_array.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief shape of an index container
+    //!
+    //! Multidimensional index containers keep their shape.
+    //!
+    template<typename ITYPE> 
+    shape_t index_list_shape(const ITYPE &indices,std::true_type)
+    {
+        return indices.template shape<shape_t>();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief shape of an index container
+    //!
+    //! All other containers are treated as one dimensional.
+    //!
+    template<typename ITYPE> 
+    shape_t index_list_shape(const ITYPE &indices,std::false_type)
+    {
+        return shape_t{indices.size()};
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief throw an index error for an index list
+    //!
+    //! \param index the offending index
+    //! \param size number of elements of the array
+    //! \param record exception record 
+    //!
+    inline void throw_index_list_error(size_t index,size_t size,
+                                       const exception_record &record)
+    {
+        std::stringstream ss;
+        ss<<"Index "<<index<<" exceeds array size "<<size<<"!";
+        throw index_error(record,ss.str());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief gather elements 
+    //!
+    //! Sets result[i] to a[indices[i]] for all elements of indices. The 
+    //! indices refer to the linear index of a. Large results are filled in
+    //! parallel (see parallel_for_chunks()). Use this version to reuse the
+    //! result for several frames.
+    /*!
+    \code
+    //lookup table mapping each output pixel to a pixel of the detector
+    auto lut   = dynamic_array<uint32>::create(shape_t{512,512});
+    auto image = dynamic_array<float32>::create(shape_t{512,512});
+    ...
+    for(const auto &frame: frames) take(frame,lut,image);
+    \endcode
+    !*/
+    //!
+    //! \throws size_mismatch_error if indices and result have different size
+    //! \throws index_error if an index is out of range
+    //! \tparam ATYPE array type
+    //! \tparam ITYPE index container type
+    //! \tparam RTYPE result container type
+    //! \param a reference to the array
+    //! \param indices container with linear indices
+    //! \param result container for the result 
+    //!
+    template<
+             typename ATYPE,
+             typename ITYPE,
+             typename RTYPE
+            >
+    void take(const ATYPE &a,const ITYPE &indices,RTYPE &result)
+    {
+        check_equal_size(indices,result,EXCEPTION_RECORD);
+
+        size_t n = a.size();
+        parallel_for_chunks(result,[&a,&indices,&result,n](size_t b,size_t e)
+        {
+            for(size_t i=b;i<e;++i)
+            {
+                size_t index = indices[i];
+                if(index>=n) throw_index_list_error(index,n,EXCEPTION_RECORD);
+
+                result[i] = a[index];
+            }
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief gather elements 
+    //!
+    //! Returns a new array with the elements of a at the positions given by
+    //! indices. If indices is a multidimensional container the result has 
+    //! its shape. Otherwise the result is one dimensional. 
+    /*!
+    \code
+    auto data = dynamic_array<float64>::create(shape_t{100,100});
+    auto values = take(data,std::vector<size_t>{0,101,202});
+    //values.size() == 3
+    \endcode
+    !*/
+    //!
+    //! \throws index_error if an index is out of range
+    //! \tparam ATYPE array type
+    //! \tparam ITYPE index container type
+    //! \param a reference to the array
+    //! \param indices container with linear indices
+    //! \return new array with the selected elements
+    //!
+    template<
+             typename ATYPE,
+             typename ITYPE
+            >
+    mdarray<std::vector<typename ATYPE::value_type>,dynamic_cindex_map> 
+    take(const ATYPE &a,const ITYPE &indices)
+    {
+        typedef mdarray<std::vector<typename ATYPE::value_type>,
+                        dynamic_cindex_map> result_type;
+        typedef std::integral_constant<bool,
+                    container_trait<ITYPE>::is_multidim> is_multidim;
+
+        auto result = result_type::create(
+                          index_list_shape(indices,is_multidim()));
+        take(a,indices,result);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief scatter elements
+    //!
+    //! Sets a[indices[i]] to values[i] for all elements of indices. The 
+    //! values are assigned in order by the calling thread. Thus, if an 
+    //! index appears more than once the last value is stored. 
+    //!
+    //! \throws size_mismatch_error if indices and values have different 
+    //! size
+    //! \throws index_error if an index is out of range
+    //! \tparam ATYPE array type
+    //! \tparam ITYPE index container type
+    //! \tparam VTYPE value container type
+    //! \param a reference to the array
+    //! \param indices container with linear indices
+    //! \param values container with the values
+    //!
+    template<
+             typename ATYPE,
+             typename ITYPE,
+             typename VTYPE,
+             typename = typename std::enable_if<
+                 !std::is_convertible<VTYPE,
+                                      typename ATYPE::value_type>::value
+                 >::type
+            >
+    void put(ATYPE &a,const ITYPE &indices,const VTYPE &values)
+    {
+        check_equal_size(indices,values,EXCEPTION_RECORD);
+
+        size_t n = a.size();
+        for(size_t i=0;i<indices.size();++i)
+        {
+            size_t index = indices[i];
+            if(index>=n) throw_index_list_error(index,n,EXCEPTION_RECORD);
+
+            a[index] = values[i];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief scatter a value
+    //!
+    //! Sets a[indices[i]] to value for all elements of indices.
+    //!
+    //! \throws index_error if an index is out of range
+    //! \tparam ATYPE array type
+    //! \tparam ITYPE index container type
+    //! \param a reference to the array
+    //! \param indices container with linear indices
+    //! \param value the value to assign
+    //!
+    template<
+             typename ATYPE,
+             typename ITYPE
+            >
+    void put(ATYPE &a,const ITYPE &indices,
+             const typename ATYPE::value_type &value)
+    {
+        size_t n = a.size();
+        for(auto index: indices)
+        {
+            if(size_t(index)>=n) 
+                throw_index_list_error(index,n,EXCEPTION_RECORD);
+
+            a[index] = value;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compress implementation
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE,
+             typename KERNEL
+            >
+    mdarray<std::vector<typename ATYPE::value_type>,dynamic_cindex_map> 
+    compress(const ATYPE &a,const MTYPE &m,KERNEL)
+    {
+        typedef mdarray<std::vector<typename ATYPE::value_type>,
+                        dynamic_cindex_map> result_type;
+
+        auto bounds = parallel_chunks(a);
+        auto offsets = mask_offsets(m,bounds,KERNEL());
+        auto result = result_type::create(shape_t{offsets.back()});
+        auto data = result.data();
+
+        parallel_for_each_chunk(bounds,
+                [&a,&m,&offsets,data](size_t c,size_t b,size_t e)
+                {
+                    KERNEL::compress(a,m,b,e,data+offsets[c]);
+                });
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief selected elements
+    //!
+    //! Returns a one dimensional array with all elements of a selected by 
+    //! the mask m in the order of their linear index. 
+    /*!
+    \code
+    auto frame = ...;
+    auto good  = ...; //mask with the good pixels
+    auto pixels = compress(frame,good);
+    \endcode
+    !*/
+    //!
+    //! The selected elements are counted in parallel first. Then each 
+    //! thread copies the selected elements of its part of the array to the
+    //! result. For contiguous data and byte masks the AVX-512 compress
+    //! instructions are used if available (see simd_mask_kernel).
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \return new array with the selected elements
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    mdarray<std::vector<typename ATYPE::value_type>,dynamic_cindex_map> 
+    compress(const ATYPE &a,const MTYPE &m)
+    {
+        typedef mask_kernel_trait<ATYPE,MTYPE> trait_type;
+        check_equal_size(a,m,EXCEPTION_RECORD);
+
+        if(trait_type::use_data(a,m))
+            return compress(a,m,mask_kernels<trait_type::value>());
+        else
+            return compress(a,m,mask_kernels<false>());
+    }
+
+//end of namespace
+}
+}
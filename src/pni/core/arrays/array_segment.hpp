@@ -0,0 +1,436 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+#include <pni/core/algorithms/math/simd_convert.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief segment of a selection
+    //!
+    //! A segment describes a run of elements of a selection within the
+    //! linear storage of the original array. The elements of a segment
+    //! are located at
+    //!
+    //! \f[ o_i = o + i s \quad i=0,\ldots,n-1 \f]
+    //!
+    //! where \f$o\f$ is the offset, \f$n\f$ the size, and \f$s\f$ the
+    //! stride of the segment. Segments with a stride of 1 are contiguous in
+    //! memory and can be copied as a block. The stride is negative for 
+    //! segments running backwards through memory (see array_view::flip()).
+    //!
+    struct array_segment
+    {
+        //! offset of the first element in the original array
+        size_t offset;
+        //! number of elements in the segment
+        size_t size;
+        //! distance between two elements in the original array
+        ssize_t stride;
+    };
+
+    //! list of segments
+    using segment_list = std::vector<array_segment>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief decompose a strided layout into segments
+    //!
+    //! Decomposes the elements described by a start offset, a shape and the
+    //! strides of each dimension into segments. The trailing dimensions are
+    //! merged as long as their strides chain. Thus a slice of a C-ordered
+    //! array results in one contiguous segment per row (or per block of
+    //! rows). The segments are returned in the order in which the elements
+    //! are traversed with the last index varying fastest. For other orders
+    //! the dimensions have to be passed in reverse order.
+    //!
+    /*!
+    \code
+    //a (3,4) region from a (10,10) array
+    auto segs = make_segments(22,shape_t{3,4},shape_t{10,1});
+    //segs = {{22,4,1},{32,4,1},{42,4,1}}
+    \endcode
+    !*/
+    //!
+    //! Both containers must provide random access iterators.
+    //!
+    //! \tparam STYPE container type for the shape
+    //! \tparam DTYPE container type for the strides
+    //! \param start offset of the first element
+    //! \param shape number of elements along each dimension
+    //! \param strides stride of each dimension
+    //! \return list of segments
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE
+            >
+    segment_list make_segments(size_t start,const STYPE &shape,
+                               const DTYPE &strides)
+    {
+        segment_list segments;
+        size_t rank = shape.size();
+        auto n_iter = shape.begin();
+        auto s_iter = strides.begin();
+
+        if(std::find(shape.begin(),shape.end(),size_t(0))!=shape.end())
+            return segments;
+
+        //merge the trailing dimensions whose strides chain - dimensions 
+        //with a single element do not contribute to the layout
+        size_t run_size = 1;
+        ssize_t run_stride = 1;
+        size_t outer = rank;
+        for(;outer>0;--outer)
+        {
+            size_t n = n_iter[outer-1];
+            if(n==1) continue;
+
+            if(run_size==1) 
+                run_stride = s_iter[outer-1];
+            else if(ssize_t(s_iter[outer-1])!=run_stride*ssize_t(run_size))
+                break;
+
+            run_size *= n;
+        }
+
+        size_t nsegments = 1;
+        for(size_t d=0;d<outer;++d) nsegments *= n_iter[d];
+        segments.reserve(nsegments);
+
+        //iterate over the remaining outer dimensions
+        std::vector<size_t> index(outer,0);
+        size_t offset = start;
+        for(size_t n=0;n<nsegments;++n)
+        {
+            segments.push_back(array_segment{offset,run_size,run_stride});
+
+            for(size_t d=outer;d>0;--d)
+            {
+                offset += s_iter[d-1];
+                if(++index[d-1]<n_iter[d-1]) break;
+
+                offset -= index[d-1]*s_iter[d-1];
+                index[d-1] = 0;
+            }
+        }
+
+        return segments;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy data between segment lists
+    //!
+    //! Copies the elements described by the source segments to the
+    //! elements described by the destination segments. The two lists may
+    //! partition the data differently. Pieces which are contiguous on both
+    //! sides are copied as a block (which reduces to a memmove for
+    //! trivially copyable types and is vectorized for the conversion 
+    //! between float32 and the 16Bit floating point types, see 
+    //! simd_convert()). Copying stops when one of the two lists is
+    //! exhausted.
+    //!
+    //! \tparam STYPE source element type
+    //! \tparam DTYPE destination element type
+    //! \param src pointer to the source storage
+    //! \param src_segments segments in the source storage
+    //! \param dest pointer to the destination storage
+    //! \param dest_segments segments in the destination storage
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE
+            >
+    void copy_segments(const STYPE *src,const segment_list &src_segments,
+                       DTYPE *dest,const segment_list &dest_segments)
+    {
+        auto s = src_segments.begin();
+        auto d = dest_segments.begin();
+        size_t s_pos = 0,d_pos = 0;
+
+        while(s!=src_segments.end() && d!=dest_segments.end())
+        {
+            size_t n = std::min(s->size-s_pos,d->size-d_pos);
+            const STYPE *sp = src+s->offset+ssize_t(s_pos)*s->stride;
+            DTYPE *dp = dest+d->offset+ssize_t(d_pos)*d->stride;
+
+            if(s->stride==1 && d->stride==1)
+                simd_convert(sp,n,dp);
+            else
+                for(size_t i=0;i<n;++i,sp+=s->stride,dp+=d->stride) *dp = *sp;
+
+            if((s_pos+=n)==s->size) { ++s; s_pos = 0; }
+            if((d_pos+=n)==d->size) { ++d; d_pos = 0; }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief strided data trait
+    //!
+    //! \c value is true if the elements of CTYPE can be described by a 
+    //! few segments. This is the case for containers and for views on 
+    //! arrays with a strided index map. A view on a tiled array would 
+    //! consist of one segment per element.
+    //!
+    //! \tparam CTYPE container type
+    //!
+    template<typename CTYPE> struct strided_data : std::true_type
+    {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief strided data trait for views
+    //!
+    //! \tparam ATYPE array type of the view
+    //!
+    template<typename ATYPE> struct strided_data<array_view<ATYPE>> :
+        std::integral_constant<bool,
+            array_view<ATYPE>::map_type::implementation_type::strided>
+    {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief segments of a container
+    //!
+    //! A contiguous container consists of a single segment.
+    //!
+    //! \tparam CTYPE container type
+    //! \param c reference to the container
+    //! \return list with a single segment
+    //!
+    template<typename CTYPE>
+    segment_list segments(const CTYPE &c)
+    {
+        return segment_list{array_segment{0,c.size(),1}};
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief segments of a view
+    //!
+    //! \tparam ATYPE array type of the view
+    //! \param v reference to the view
+    //! \return segments of the view in the original array
+    //!
+    template<typename ATYPE>
+    segment_list segments(const array_view<ATYPE> &v)
+    {
+        return v.segments();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief storage pointer of a container
+    //!
+    //! Returns the pointer to which the offsets of the segments() of a
+    //! container refer.
+    //!
+    //! \tparam CTYPE container type
+    //! \param c reference to the container
+    //! \return pointer to the data of the container
+    //!
+    template<typename CTYPE>
+    auto segment_data(CTYPE &c) -> decltype(c.data())
+    {
+        return c.data();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief storage pointer of a view
+    //!
+    //! \tparam ATYPE array type of the view
+    //! \param v reference to the view
+    //! \return pointer to the data of the original array
+    //!
+    template<typename ATYPE>
+    auto segment_data(const array_view<ATYPE> &v) -> decltype(v.array().data())
+    {
+        return v.array().data();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief storage pointer of a view
+    //!
+    //! \tparam ATYPE array type of the view
+    //! \param v reference to the view
+    //! \return pointer to the data of the original array
+    //!
+    template<typename ATYPE>
+    auto segment_data(array_view<ATYPE> &v) -> decltype(v.array().data())
+    {
+        return v.array().data();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief element wise copy
+    //!
+    //! Fallback for containers which do not provide their data in memory.
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE
+            >
+    void copy_data(const STYPE &src,DTYPE &dest,std::false_type)
+    {
+        std::copy(src.begin(),src.end(),dest.begin());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief segment wise copy
+    //!
+    //! Used if source and destination provide their data in memory.
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE
+            >
+    void copy_data(const STYPE &src,DTYPE &dest,std::true_type)
+    {
+        copy_segments(segment_data(src),segments(src),
+                      segment_data(dest),segments(dest));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy a view 
+    //!
+    //! If the destination is contiguous the view is copied with 
+    //! array_view::copy_to() which processes transposed views in cache 
+    //! sized blocks. 
+    //!
+    template<
+             typename ATYPE,
+             typename DTYPE
+            >
+    void copy_data(const array_view<ATYPE> &src,DTYPE &dest,std::true_type)
+    {
+        auto dest_segments = segments(dest);
+        if(dest_segments.size()==1 && dest_segments[0].stride==1)
+            src.copy_to(segment_data(dest)+dest_segments[0].offset);
+        else
+            copy_segments(segment_data(src),segments(src),
+                          segment_data(dest),dest_segments);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy data with the same storage order
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE,
+             typename USE_SEGMENTS
+            >
+    void copy_data(const STYPE &src,DTYPE &dest,std::true_type,USE_SEGMENTS)
+    {
+        copy_data(src,dest,USE_SEGMENTS());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy data with different storage order
+    //!
+    //! The linear indices of source and destination refer to different 
+    //! elements. Every element is accessed by its multidimensional index.
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE,
+             typename USE_SEGMENTS
+            >
+    void copy_data(const STYPE &src,DTYPE &dest,std::false_type,USE_SEGMENTS)
+    {
+        typedef std::vector<size_t> index_type;
+
+        const auto &map = dest.map();
+        for(size_t i=0;i<dest.size();++i) 
+            dest[i] = src(map.template index<index_type>(i));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy data between arrays and views
+    //!
+    //! Copies all elements from the source to the destination. If both
+    //! provide their data in memory (see contiguous_data) and are strided 
+    //! (see strided_data) the copy is done along the segments of the 
+    //! source and the destination. Otherwise the elements are copied one 
+    //! by one using iterators. If source and 
+    //! destination have a different storage order (see is_same_order) the
+    //! elements are copied by their multidimensional index. 
+    //!
+    //! The caller has to ensure that the destination is large enough.
+    //!
+    //! \tparam STYPE source type
+    //! \tparam DTYPE destination type
+    //! \param src reference to the source
+    //! \param dest reference to the destination
+    //!
+    template<
+             typename STYPE,
+             typename DTYPE
+            >
+    void copy_data(const STYPE &src,DTYPE &dest)
+    {
+        typedef std::integral_constant<bool,
+                    contiguous_data<STYPE>::value &&
+                    contiguous_data<DTYPE>::value &&
+                    strided_data<STYPE>::value &&
+                    strided_data<DTYPE>::value> use_segments;
+
+        copy_data(src,dest,is_same_order<STYPE,DTYPE>(),use_segments());
+    }
+
+//end of namespace
+}
+}
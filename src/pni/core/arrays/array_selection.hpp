@@ -29,6 +29,7 @@
 #include <pni/core/utilities/container_utils.hpp>
 #include <pni/core/error/exception_utils.hpp>
 #include <pni/core/arrays/slice.hpp>
+#include <pni/core/arrays/array_segment.hpp>
 #include <pni/core/windows.hpp>
 
 namespace pni{
@@ -535,6 +536,78 @@ namespace core{
 
     }
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compute effective strides 
+    //!
+    //! Compute the strides of a selection with respect to the linear 
+    //! offset of the original array. The returned container has one 
+    //! element for each effective dimension of the selection. With these 
+    //! strides the offset of a selection element in the original array is 
+    //! 
+    //! \f[ o = o_0 + \sum_i s_i j_i \f]
+    //!
+    //! where \f$o_0\f$ is the start_offset() of the selection, \f$s_i\f$ the 
+    //! effective strides and \f$j_i\f$ the selection index. 
+    //!
+    //! The strides are obtained from the original index map and thus 
+    //! valid for every linear index map implementation.
+    //!
+    //! \tparam MAPT original index map type
+    //! \param map reference to the original index map
+    //! \param s reference to the selection 
+    //! \return effective strides of the selection 
+    //!
+    template<typename MAPT>
+    std::vector<ssize_t> effective_strides(const MAPT &map,
+                                           const array_selection &s)
+    {
+        typedef std::vector<size_t> index_type;
+
+        index_type index(map.rank(),0);
+        std::vector<ssize_t> strides;
+        strides.reserve(s.rank());
+
+        size_t origin = map.offset(index);
+        for(size_t d=0;d<index.size();++d)
+        {
+            if(s.full_shape()[d]==1) continue;
+
+            index[d] = 1;
+            strides.push_back(ssize_t(map.offset(index)-origin)*
+                              ssize_t(s.stride()[d]));
+            index[d] = 0;
+        }
+
+        return strides;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief decompose a selection into segments
+    //!
+    //! Breaks the selection into segments of elements in the original 
+    //! array (see make_segments()). For a C-ordered map every row of the 
+    //! selection becomes a contiguous segment. Rows are merged if the 
+    //! selection spans the full extent of the trailing dimensions. 
+    //!
+    //! \tparam MAPT original index map type
+    //! \param map reference to the original index map
+    //! \param s reference to the selection
+    //! \return list of segments
+    //!
+    template<typename MAPT>
+    segment_list segments(const MAPT &map,const array_selection &s)
+    {
+        typedef std::vector<size_t> index_type;
+
+        return make_segments(start_offset(map,s),
+                             s.template shape<index_type>(),
+                             effective_strides(map,s));
+    }
+
     //-------------------------------------------------------------------------
     //! 
     //! \ingroup mdim_array_internal_classes
@@ -27,10 +27,16 @@
 
 #include <memory>
 #include <functional>
+#include <algorithm>
+#include <numeric>
+#include <cstdlib>
 #include <pni/core/arrays/index_map/index_maps.hpp>
 #include <pni/core/utilities.hpp>
 #include <pni/core/arrays/array_selection.hpp>
+#include <pni/core/arrays/array_segment.hpp>
 #include <pni/core/arrays/index_utilities.hpp>
+#include <pni/core/arrays/view_iterator.hpp>
+#include <pni/core/arrays/masked_array.hpp>
 #include <pni/core/algorithms/math/inplace_arithmetics.hpp>
 #include <pni/core/types/types.hpp>
 #include <pni/core/types/container_trait.hpp>
@@ -79,13 +85,15 @@ namespace core{
             //! unique pointer type
             using unique_ptr =  std::unique_ptr<array_type>;
             //! iterator type
-            using iterator = container_iterator<array_type>;
+            using iterator = view_iterator<array_type>;
             //! const iterator type
-            using const_iterator = container_iterator<const array_type>;
+            using const_iterator = view_iterator<const array_type>;
             //! view type
             using view_type = array_view<array_type>;
             //! index type
             using index_type = std::vector<size_t>;
+            //! stride type
+            using stride_type = std::vector<ssize_t>;
             //! inplace arithetic type
             using inplace_arithmetic = typename ATYPE::inplace_arithmetic;
             //! map type
@@ -94,6 +102,10 @@ namespace core{
             //! type id of the value_type
             static const type_id_t type_id = ATYPE::type_id;
         private:
+            //! the iterators need access to the strides and offsets
+            friend class view_iterator<array_type>;
+            friend class view_iterator<const array_type>;
+
             //! parent array from which to draw data
             std::reference_wrapper<ATYPE> _parray; 
             //! selection object for index transformation 
@@ -109,6 +121,121 @@ namespace core{
             //! offset of the first element
             size_t _start_offset;
 
+            //! effective strides of the view in the original array
+            stride_type _strides;
+
+            //! number of elements along each dimension of the blocks 
+            //! used by copy_to() 
+            static const size_t block_size = 32;
+
+            //! true if the last index of the view varies fastest
+            static const bool c_order = map_type::implementation_type::c_order;
+
+            //! true if offsets are linear in the indices (see 
+            //! tiled_index_map_imp for a map where this is not the case)
+            static const bool strided = map_type::implementation_type::strided;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get dimension by traversal position
+            //!
+            //! Returns the dimension at position k if the dimensions of the 
+            //! view are ordered from the slowest to the fastest varying one. 
+            //! The order is determined by the index map of the original 
+            //! array.
+            //!
+            //! \param k position in traversal order
+            //! \return dimension index
+            //!
+            size_t dimension(size_t k) const
+            {
+                return c_order ? k : _strides.size()-1-k;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute offset from index
+            //!
+            //! Computes the offset of an element in the original array from
+            //! a multidimensional view index using the effective strides.
+            //! If the index map of the original array is not strided the 
+            //! offset is computed by the map.
+            //!
+            //! \tparam CTYPE index container type
+            //! \param index multidimensional index 
+            //! \return offset in the original array
+            //!
+            template<typename CTYPE>
+            size_t offset(const CTYPE &index) const
+            {
+                if(!strided) 
+                    return _parray.get().map().offset(_selection,index);
+
+                size_t o = _start_offset;
+                auto stride = _strides.begin();
+                for(auto i: index) o += size_t(i)*(*stride++);
+
+                return o;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute offset from linear index
+            //!
+            //! Computes the offset of an element in the original array from
+            //! the linear index of the element in the view.
+            //!
+            //! \param i linear index in the view
+            //! \return offset in the original array
+            //!
+            size_t offset(size_t i) const
+            {
+                if(!strided) 
+                    return offset(_imap.template index<index_type>(i));
+
+                if(_is_contiguous || _strides.empty()) return _start_offset+i;
+
+                //the index along the slowest dimension is what remains after
+                //all other dimensions have been processed
+                size_t o = _start_offset;
+                auto shape = _imap.begin();
+                for(size_t k=_strides.size()-1;k>0;--k)
+                {
+                    size_t d = dimension(k);
+                    size_t q = i/shape[d];
+                    o += (i-q*shape[d])*_strides[d];
+                    i = q;
+                }
+
+                return o+i*_strides[dimension(0)];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor for transformed views
+            //!
+            //! Creates a view on the same elements of the original array as
+            //! v but with a different shape and different strides. Used by 
+            //! permute(), flip(), and reshape().
+            //!
+            //! \param v reference to the view to transform
+            //! \param shape shape of the new view
+            //! \param start offset of the first element of the new view
+            //! \param strides strides of the new view
+            //!
+            array_view(const array_type &v,const index_type &shape,
+                       size_t start,stride_type &&strides):
+                _parray(v._parray),
+                _selection(v._selection),
+                _imap(map_utils<map_type>::create(shape)),
+                _index(v._index),
+                _is_contiguous(false),
+                _start_offset(start),
+                _strides(std::move(strides))
+            {
+                _is_contiguous = run_length()==size();
+            }
+
         public:
             //-----------------------------------------------------------------
             //! 
@@ -124,8 +251,10 @@ namespace core{
                 _selection(s),
                 _imap(map_utils<map_type>::create(_selection.shape<index_type>())),
                 _index(a.rank()),
-                _is_contiguous(pni::core::is_contiguous(a.map(),_selection)),
-                _start_offset(start_offset(a.map(),_selection))
+                _is_contiguous(strided && 
+                               pni::core::is_contiguous(a.map(),_selection)),
+                _start_offset(start_offset(a.map(),_selection)),
+                _strides(effective_strides(a.map(),_selection))
             { }
 
             //------------------------------------------------------------------
@@ -144,8 +273,10 @@ namespace core{
                 _selection(std::move(s)),
                 _imap(map_utils<map_type>::create(_selection.shape<index_type>())),
                 _index(a.rank()),
-                _is_contiguous(pni::core::is_contiguous(a.map(),_selection)),
-                _start_offset(start_offset(a.map(),_selection))
+                _is_contiguous(strided && 
+                               pni::core::is_contiguous(a.map(),_selection)),
+                _start_offset(start_offset(a.map(),_selection)),
+                _strides(effective_strides(a.map(),_selection))
             {}
 
 
@@ -159,7 +290,8 @@ namespace core{
                 _imap(c._imap),
                 _index(c._index),
                 _is_contiguous(c._is_contiguous),
-                _start_offset(c._start_offset)
+                _start_offset(c._start_offset),
+                _strides(c._strides)
             {}
 
             //-----------------------------------------------------------------
@@ -172,20 +304,24 @@ namespace core{
                 _imap(std::move(c._imap)),
                 _index(std::move(c._index)),
                 _is_contiguous(c._is_contiguous),
-                _start_offset(c._start_offset)
+                _start_offset(c._start_offset),
+                _strides(std::move(c._strides))
             {}
 
             //-----------------------------------------------------------------
             //!
             //! \brief copy assignment operator
             //!
+            //! If the source provides its data in memory (an array or a 
+            //! view on an array) the data is copied along the segments of 
+            //! the source and this view (see copy_data()).
+            //!
             template<typename ETYPE>
             array_type &operator=(const ETYPE &e)
             {
                 if((void*)this == (void*)&e) return *this;
                
-                //for(size_t i=0;i<size();++i) (*this)[i] = e[i];
-                std::copy(e.begin(),e.end(),this->begin());
+                copy_data(e,*this);
 
                 return *this;
             }
@@ -205,6 +341,7 @@ namespace core{
                 _index = std::move(a._index);
                 _is_contiguous = a._is_contiguous;
                 _start_offset  = a._start_offset;
+                _strides = std::move(a._strides);
 
                 return *this;
             }
@@ -228,17 +365,7 @@ namespace core{
                     >
             value_type &operator()(const CTYPE &index)
             {
-                typedef typename ATYPE::map_type omap_type;
-                auto &ref = _parray.get();
-
-                if(_is_contiguous)
-                    return ref[_start_offset + _imap.offset(index)];
-                else
-                {
-                    auto  map = const_cast<omap_type&>(ref.map());
-                    size_t o = map.offset(_selection,index);
-                    return ref[o];
-                }
+                return _parray.get()[offset(index)];
             }
 
             //-----------------------------------------------------------------
@@ -260,17 +387,7 @@ namespace core{
                     >
             value_type operator()(const CTYPE &index) const
             {
-                typedef typename ATYPE::map_type omap_type;
-                auto &ref = _parray.get();
-
-                if(_is_contiguous)
-                    return ref[_start_offset + _imap.offset(index)];
-                else
-                {
-                    auto  map = const_cast<omap_type&>(ref.map());
-                    size_t o = map.offset(_selection,index);
-                    return ref[o];
-                }
+                return _parray.get()[offset(index)];
             }
 
 
@@ -295,19 +412,7 @@ namespace core{
             template<typename ...ITypes> 
             value_type & operator()(ITypes ...indices)
             {
-                typedef typename ATYPE::map_type omap_type;
-                auto &ref = _parray.get();
-
-                if(_is_contiguous)
-                    return ref[_start_offset +
-                               _imap.offset(IDX_ARRAY(ITypes,indices))];
-                else
-                {
-                    auto  map = const_cast<omap_type&>(ref.map());
-                    size_t o = map.offset(_selection,IDX_ARRAY(ITypes,indices));
-                    return ref[o];
-                }
-
+                return _parray.get()[offset(IDX_ARRAY(ITypes,indices))];
             }
 
             //-----------------------------------------------------------------
@@ -332,18 +437,7 @@ namespace core{
             template<typename ...ITypes> 
             value_type operator()(ITypes ...indices) const
             {
-                typedef typename ATYPE::map_type omap_type;
-                auto &ref = _parray.get();
-
-                if(_is_contiguous)
-                    return ref[_start_offset + 
-                               _imap.offset(IDX_ARRAY(ITypes,indices))];
-                else
-                {
-                    //have to do some more work here
-                    auto map = const_cast<omap_type&>(ref.map());
-                    return ref[map.offset(_selection,IDX_ARRAY(ITypes,indices))];
-                }
+                return _parray.get()[offset(IDX_ARRAY(ITypes,indices))];
             }
 
             //-----------------------------------------------------------------
@@ -358,7 +452,7 @@ namespace core{
             //!
             template<typename CTYPE> CTYPE shape() const
             {
-                return _selection.template shape<CTYPE>();
+                return container_utils<CTYPE>::create(_imap.begin(),_imap.end());
             }
 
             //-----------------------------------------------------------------
@@ -377,14 +471,7 @@ namespace core{
 #ifdef DEBUG
                 check_index_in_dim(i,size(),EXCEPTION_RECORD);
 #endif
-                //compute the multidimensional index in the original array for
-                //the linear index i in the view
-                if(_is_contiguous) return _parray.get()[i+_start_offset];
-                else
-                {
-                    auto index = _imap.template index<index_type>(i);
-                    return (*this)(index); 
-                }
+                return _parray.get()[offset(i)];
             }
 
             //-----------------------------------------------------------------
@@ -405,14 +492,37 @@ namespace core{
 #ifdef DEBUG
                 check_index_in_dim(i,size(),EXCEPTION_RECORD);
 #endif
-                if(_is_contiguous) return _parray.get()[i+_start_offset];
-                else
-                {
-                    //compute the multidimensional index in the original array for
-                    //the linear index i in the view
-                    auto index = _imap.template index<index_type>(i);
-                    return (*this)(index); 
-                }
+                return _parray.get()[offset(i)];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief masked access
+            //!
+            //! Returns a masked_array referring to the elements selected by
+            //! mask. The mask is a multidimensional container of bool_t or 
+            //! uint8 elements or a bitmask_array with the same size as the 
+            //! view. Other arrays do not compile as masks (see is_mask_array).
+            /*!
+            \code
+            frame[bad_pixels] = 0;
+            \endcode
+            !*/
+            //!
+            //! \throws size_mismatch_error if mask and view have different
+            //! size
+            //! \tparam MTYPE mask type
+            //! \param mask reference to the mask
+            //! \return masked array 
+            //!
+            template<
+                     typename MTYPE,
+                     typename = typename std::enable_if<
+                         is_mask_array<MTYPE>::value>::type
+                    >
+            masked_array<array_view,MTYPE> operator[](const MTYPE &mask)
+            {
+                return masked_array<array_view,MTYPE>(*this,mask);
             }
 
             //-----------------------------------------------------------------
@@ -431,7 +541,7 @@ namespace core{
             const value_type *data() const
             {
                 if(_is_contiguous) 
-                    return &_parray.get()[_start_offset];
+                    return _parray.get().data()+_start_offset;
                 else
                     throw shape_mismatch_error(EXCEPTION_RECORD,
                             "Selection view is not contiguous!");
@@ -453,7 +563,7 @@ namespace core{
             value_type *data() 
             {
                 if(_is_contiguous) 
-                    return &_parray.get()[_start_offset];
+                    return _parray.get().data()+_start_offset;
                 else
                     throw shape_mismatch_error(EXCEPTION_RECORD,
                             "Selection view is not contiguous!");
@@ -555,7 +665,368 @@ namespace core{
             //! 
             size_t rank()  const 
             { 
-                return _selection.rank(); 
+                return _imap.rank(); 
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief length of contiguous runs
+            //!
+            //! Returns the number of elements of the view which are stored 
+            //! contiguously in the original array. For a contiguous view 
+            //! this is the size of the view. Otherwise it is the product of 
+            //! the fastest varying dimensions of the view whose elements 
+            //! follow each other in memory (1 if the fastest dimension is 
+            //! strided or the index map of the original array is not strided).
+            //! The view consists of size()/run_length() such runs.
+            //!
+            //! \return number of elements per contiguous run
+            //!
+            size_t run_length() const
+            {
+                if(_is_contiguous) return size();
+                if(!strided) return 1;
+
+                size_t block = 1;
+                auto shape = _imap.begin();
+                for(size_t k=_strides.size();k>0;--k)
+                {
+                    size_t d = dimension(k-1);
+                    if(shape[d]==1) continue;
+                    if(_strides[d]!=ssize_t(block)) break;
+                    block *= shape[d];
+                }
+
+                return block;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get segments
+            //!
+            //! Decomposes the view into segments of the original array. 
+            //! Each segment holds the offset of its first element in the 
+            //! original array, the number of elements, and the stride 
+            //! between them. The segments are ordered like the elements of 
+            //! the view (which follow the storage order of the original 
+            //! array). 
+            //! If the index map of the original array is not strided (like 
+            //! a tiled map) every element forms a segment of its own. 
+            //! copy_to() and copy_data() copy such views element by 
+            //! element instead.
+            /*!
+            \code
+            auto view = frame(slice(100,600),slice(200,1200));
+            const uint16 *src = view.array().data();
+            for(auto s: view.segments())
+                std::copy(src+s.offset,src+s.offset+s.size,roi_ptr+...);
+            \endcode
+            !*/
+            //!
+            //! \return list of segments 
+            //! 
+            segment_list segments() const
+            {
+                if(!strided)
+                {
+                    segment_list segs(size());
+                    for(size_t i=0;i<segs.size();++i) 
+                        segs[i] = array_segment{offset(i),1,1};
+                    return segs;
+                }
+
+                if(c_order) return make_segments(_start_offset,_imap,_strides);
+
+                //make_segments expects the fastest dimension last
+                index_type shape(_imap.begin(),_imap.end());
+                std::reverse(shape.begin(),shape.end());
+                return make_segments(_start_offset,shape,
+                                     stride_type(_strides.rbegin(),
+                                                 _strides.rend()));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get original array
+            //!
+            //! \return reference to the array the view refers to
+            //!
+            storage_type &array() { return _parray.get(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get original array
+            //!
+            //! \return const reference to the array the view refers to
+            //!
+            const storage_type &array() const { return _parray.get(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get strides
+            //!
+            //! Returns the distance (in elements of the original array) 
+            //! between two neighboring elements along each dimension of the
+            //! view. Strides are negative for dimensions which have been 
+            //! flipped.
+            //!
+            //! \return strides of the view
+            //!
+            const stride_type &strides() const noexcept { return _strides; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief permute dimensions
+            //!
+            //! Returns a view on the same data whose dimension k is the 
+            //! dimension axes[k] of this view. No data is copied. 
+            /*!
+            \code
+            auto volume = array_type::create(shape_t{100,200,300});
+            auto view = volume(slice(0,100),slice(0,200),slice(0,300));
+
+            //view with shape (300,100,200)
+            auto p = view.permute(shape_t{2,0,1});
+            \endcode
+            !*/
+            //!
+            //! \throws shape_mismatch_error if the number of axes does not 
+            //! match the rank of the view or if an axis is used twice
+            //! \throws index_error if an axis exceeds the rank of the view
+            //! \tparam CTYPE container type for the axes
+            //! \param axes the new order of the dimensions
+            //! \return permuted view
+            //!
+            template<typename CTYPE>
+            array_type permute(const CTYPE &axes) const
+            {
+                static_assert(strided,
+                              "Views on this array type cannot be permuted!");
+
+                if(axes.size()!=rank())
+                    throw shape_mismatch_error(EXCEPTION_RECORD,
+                            "Number of axes does not match the rank of the "
+                            "view!");
+
+                index_type shape(rank());
+                stride_type strides(rank());
+                std::vector<bool> used(rank(),false);
+                size_t d = 0;
+                for(auto axis: axes)
+                {
+                    check_index_in_dim(axis,rank(),EXCEPTION_RECORD);
+                    if(used[axis])
+                        throw shape_mismatch_error(EXCEPTION_RECORD,
+                                "Axes must be a permutation of the "
+                                "dimensions of the view!");
+                    used[axis] = true;
+
+                    shape[d] = _imap.begin()[axis];
+                    strides[d++] = _strides[axis];
+                }
+
+                return array_type(*this,shape,_start_offset,std::move(strides));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief transpose the view 
+            //!
+            //! Returns a view with the order of the dimensions reversed. 
+            //! For a 2D view this is the transposed matrix. No data is 
+            //! copied.
+            //!
+            //! \return transposed view
+            //!
+            array_type transpose() const
+            {
+                index_type axes(rank());
+                for(size_t d=0;d<axes.size();++d) axes[d] = axes.size()-1-d;
+
+                return permute(axes);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief flip a dimension
+            //!
+            //! Returns a view whose elements along dimension axis are in 
+            //! reverse order. No data is copied - the view uses a negative 
+            //! stride along this dimension.
+            //!
+            //! \throws index_error if axis exceeds the rank of the view
+            //! \param axis the dimension to flip
+            //! \return flipped view
+            //!
+            array_type flip(size_t axis) const
+            {
+                static_assert(strided,
+                              "Views on this array type cannot be flipped!");
+                check_index_in_dim(axis,rank(),EXCEPTION_RECORD);
+
+                stride_type strides(_strides);
+                size_t start = _start_offset + 
+                               ssize_t(_imap.begin()[axis]-1)*strides[axis];
+                strides[axis] = -strides[axis];
+
+                return array_type(*this,
+                                  index_type(_imap.begin(),_imap.end()),
+                                  start,std::move(strides));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reshape the view
+            //!
+            //! Returns a view with a new shape on the same data. The number 
+            //! of elements must not change and the view must be contiguous. 
+            //! The linear order of the elements remains the same.
+            /*!
+            \code
+            auto frames = stack(slice(0,10),slice(0,2048),slice(0,2048));
+
+            //view the 10 frames as a single (20480,2048) image
+            auto image = frames.reshape(shape_t{20480,2048});
+            \endcode
+            !*/
+            //!
+            //! \throws size_mismatch_error if the size of the new shape does
+            //! not match the size of the view
+            //! \throws shape_mismatch_error if the view is not contiguous
+            //! \tparam CTYPE container type for the shape
+            //! \param shape the new shape
+            //! \return reshaped view
+            //!
+            template<typename CTYPE>
+            array_type reshape(const CTYPE &shape) const
+            {
+                static_assert(strided,
+                              "Views on this array type cannot be reshaped!");
+
+                index_type new_shape(shape.begin(),shape.end());
+                size_t new_size = std::accumulate(new_shape.begin(),
+                                                  new_shape.end(),size_t(1),
+                                                  std::multiplies<size_t>());
+                if(new_size!=size())
+                    throw size_mismatch_error(EXCEPTION_RECORD,
+                            "Size of the new shape does not match the size "
+                            "of the view!");
+
+                if(!_is_contiguous)
+                    throw shape_mismatch_error(EXCEPTION_RECORD,
+                            "Only contiguous views can be reshaped!");
+
+                //compact strides in the storage order of the original array
+                size_t r = new_shape.size();
+                stride_type strides(r);
+                ssize_t stride = 1;
+                for(size_t k=r;k>0;--k)
+                {
+                    size_t d = c_order ? k-1 : r-k;
+                    strides[d] = stride;
+                    stride *= ssize_t(new_shape[d]);
+                }
+
+                return array_type(*this,new_shape,_start_offset,
+                                  std::move(strides));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy to memory 
+            //!
+            //! Copies the elements of the view in their linear order to 
+            //! contiguous memory. If the fastest varying dimension of the 
+            //! view is not contiguous in the original array (as for a 
+            //! transposed view) the data is copied in blocks of 
+            //! block_size x block_size elements spanned by this dimension 
+            //! and the dimension with the smallest stride. Thus every cache 
+            //! line read from the original array is used completely before 
+            //! it is evicted. Otherwise the data is copied along the 
+            //! segments of the view. Views on arrays with a non-strided 
+            //! index map are copied element by element. 
+            //!
+            //! The constructor of mdarray and the assignment of a view to an
+            //! array use this function (via copy_data()).
+            //!
+            //! \tparam T element type of the destination
+            //! \param dest pointer to memory for size() elements
+            //!
+            template<typename T>
+            void copy_to(T *dest) const
+            {
+                if(!strided)
+                {
+                    std::copy(begin(),end(),dest);
+                    return;
+                }
+
+                const auto *src = _parray.get().data();
+                size_t r = rank();
+                if(r<2 || run_length()!=1)
+                {
+                    copy_segments(src,segments(),
+                                  dest,segment_list{array_segment{0,size(),1}});
+                    return;
+                }
+
+                auto shape = _imap.begin();
+                //the fastest dimension of the destination and the dimension
+                //with the smallest stride in the original array
+                size_t f = dimension(r-1);
+                size_t b = dimension(0);
+                for(size_t d=0;d<r;++d)
+                    if(d!=f && std::abs(_strides[d])<std::abs(_strides[b])) 
+                        b = d;
+
+                //compact strides of the destination 
+                index_type dstrides(r);
+                size_t stride = 1;
+                for(size_t k=r;k>0;--k)
+                {
+                    dstrides[dimension(k-1)] = stride;
+                    stride *= shape[dimension(k-1)];
+                }
+
+                //iterate over the 2D planes spanned by f and b 
+                size_t nplanes = size()/(shape[f]*shape[b]);
+                index_type index(r,0);
+                size_t src_offset = _start_offset,dest_offset = 0;
+                for(size_t p=0;p<nplanes;++p)
+                {
+                    for(size_t i0=0;i0<shape[b];i0+=block_size)
+                    {
+                        size_t i1 = std::min(i0+block_size,shape[b]);
+                        for(size_t j0=0;j0<shape[f];j0+=block_size)
+                        {
+                            size_t j1 = std::min(j0+block_size,shape[f]);
+                            for(size_t i=i0;i<i1;++i)
+                            {
+                                const auto *s = src+src_offset+
+                                                ssize_t(i)*_strides[b]+
+                                                ssize_t(j0)*_strides[f];
+                                T *d = dest+dest_offset+i*dstrides[b]+j0;
+                                for(size_t j=j0;j<j1;++j,s+=_strides[f]) 
+                                    *d++ = *s;
+                            }
+                        }
+                    }
+
+                    //next plane - odometer over the remaining dimensions
+                    for(size_t k=r;k>0;--k)
+                    {
+                        size_t d = dimension(k-1);
+                        if(d==f || d==b) continue;
+
+                        src_offset += _strides[d];
+                        dest_offset += dstrides[d];
+                        if(++index[d]<shape[d]) break;
+
+                        src_offset -= ssize_t(index[d])*_strides[d];
+                        dest_offset -= index[d]*dstrides[d];
+                        index[d] = 0;
+                    }
+                }
             }
 
             //-----------------------------------------------------------------
@@ -643,6 +1114,8 @@ namespace core{
             template<typename RTYPE> 
             array_type &operator+=(const RTYPE &v) 
             { 
+                static_assert(is_same_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::add(*this,v); 
                 return *this;
             }
@@ -691,6 +1164,8 @@ namespace core{
             template<typename RTYPE> 
             array_type &operator-=(const RTYPE &v) 
             { 
+                static_assert(is_same_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::sub(*this,v); 
                 return *this;
             }
@@ -738,6 +1213,8 @@ namespace core{
             template<typename RTYPE>
             array_type &operator*=(const RTYPE &v) 
             { 
+                static_assert(is_same_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::mult(*this,v); 
                 return *this;
             }
@@ -785,6 +1262,8 @@ namespace core{
             template<typename RTYPE>
             array_type &operator/=(const RTYPE &v) 
             { 
+                static_assert(is_same_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::div(*this,v); 
                 return *this;
             }
@@ -0,0 +1,990 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <array>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/utilities/container_utils.hpp>
+#include <pni/core/utilities/proxy_iterator.hpp>
+#include <pni/core/arrays/aligned_allocator.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/algorithms/math/simd_bitmask.hpp>
+#include <pni/core/arrays/masked_array.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief reference to a single bit
+    //!
+    //! Proxy returned by the non-const access operators of bitmask_array.
+    //! It behaves like a reference to bool.
+    //!
+    class bit_reference
+    {
+        private:
+            //! word holding the bit
+            uint64 *_word;
+            //! the bit within the word
+            uint64 _bit;
+        public:
+            //!
+            //! \brief constructor
+            //!
+            //! \param word pointer to the word holding the bit
+            //! \param bit index of the bit within the word
+            //!
+            bit_reference(uint64 *word,size_t bit):
+                _word(word),
+                _bit(uint64(1)<<bit)
+            {}
+
+            //! get the value of the bit
+            operator bool() const { return (*_word & _bit)!=0; }
+
+            //! set the value of the bit
+            bit_reference &operator=(bool v)
+            {
+                if(v) *_word |= _bit;
+                else  *_word &= ~_bit;
+                return *this;
+            }
+
+            //! assign the value of another bit
+            bit_reference &operator=(const bit_reference &r)
+            {
+                return *this = bool(r);
+            }
+
+            //! invert the bit
+            void flip() { *_word ^= _bit; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief packed boolean array
+    //!
+    //! A multidimensional array of booleans storing one bit per element in 
+    //! 64 Bit words. Compared to an mdarray of bool_t, which takes one byte 
+    //! per element, a mask of a 16M pixel detector takes 2 MByte instead of
+    //! 16 MByte. The element access operators return proxies (see 
+    //! bit_reference). 
+    /*!
+    \code
+    auto frame = dynamic_array<uint16>::create(shape_t{4096,4096});
+    ...
+    auto hot = threshold_mask(frame,uint16(60000));
+    auto bad = hot | dead;
+    std::cout<<bad.count()<<" bad pixels"<<std::endl;
+    frame[bad] = 0;
+    \endcode
+    !*/
+    //!
+    //! The logical operations and the counting of set bits work on entire 
+    //! words. Bits beyond the last element of the last word are always 
+    //! zero. A bitmask_array can be used as a mask for all masked 
+    //! operations (see masked_array). The storage order is C order.
+    //!
+    class bitmask_array
+    {
+        public:
+            //================public types=====================================
+            //! element type
+            typedef bool value_type;
+            //! index map type
+            typedef dynamic_cindex_map map_type;
+            //! storage type for the mask words
+            typedef aligned_vector<uint64> storage_type;
+            //! reference type
+            typedef bit_reference reference;
+            //! const reference type
+            typedef bool const_reference;
+            //! iterator type
+            typedef proxy_iterator<bitmask_array> iterator;
+            //! const iterator type
+            typedef proxy_iterator<const bitmask_array> const_iterator;
+            //! reverse iterator type
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            //! const reverse iterator type
+            typedef std::reverse_iterator<const_iterator> 
+                const_reverse_iterator;
+        private:
+            //! index map
+            map_type _imap;
+            //! number of elements
+            size_t _size;
+            //! the mask words
+            storage_type _words;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief clear unused bits
+            //!
+            //! Clears the bits of the last word beyond the last element.
+            //!
+            void clear_padding()
+            {
+                size_t n = _size%bitmask_word_bits;
+                if(n) _words.back() &= (uint64(1)<<n)-1;
+            }
+
+        public:
+            //================constructors and destructor======================
+            //! default constructor
+            bitmask_array():
+                _imap(),
+                _size(0),
+                _words()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param map index map of the mask
+            //! \param value initial value of all elements
+            //!
+            explicit bitmask_array(const map_type &map,bool value=false):
+                _imap(map),
+                _size(map.max_elements()),
+                _words(nwords(_size),value ? ~uint64(0) : uint64(0))
+            {
+                clear_padding();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create a mask
+            //!
+            /*!
+            \code
+            auto mask = bitmask_array::create(shape_t{1024,2048});
+            \endcode
+            !*/
+            //! 
+            //! \tparam CTYPE container type for the shape
+            //! \param shape number of elements along each dimension
+            //! \param value initial value of all elements
+            //! \return new mask
+            //!
+            template<typename CTYPE> 
+            static bitmask_array create(const CTYPE &shape,bool value=false)
+            {
+                return bitmask_array(map_utils<map_type>::create(shape),value);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of words for n bits
+            //!
+            static size_t nwords(size_t n)
+            {
+                return (n+bitmask_word_bits-1)/bitmask_word_bits;
+            }
+
+            //==================inquiry methods================================
+            //! number of elements
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! number of dimensions
+            size_t rank() const { return _imap.rank(); }
+
+            //-----------------------------------------------------------------
+            //! reference to the index map
+            const map_type &map() const { return _imap; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief shape of the mask
+            //!
+            //! \tparam CTYPE container type for the shape
+            //! \return instance of CTYPE with the number of elements along
+            //!         each dimension
+            //!
+            template<typename CTYPE> CTYPE shape() const
+            {
+                auto c = container_utils<CTYPE>::create(_imap.rank());
+                std::copy(_imap.begin(),_imap.end(),c.begin());
+                return c;
+            }
+
+            //-----------------------------------------------------------------
+            //! number of mask words
+            size_t nwords() const { return _words.size(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief pointer to the mask words
+            //!
+            //! Bit i%64 of word i/64 holds element i. When writing words 
+            //! directly the bits beyond size() in the last word must remain 
+            //! zero.
+            //!
+            uint64 *words() { return _words.data(); }
+
+            //-----------------------------------------------------------------
+            //! pointer to the mask words
+            const uint64 *words() const { return _words.data(); }
+
+            //-----------------------------------------------------------------
+            //! reference to the word storage
+            storage_type &storage() { return _words; }
+
+            //-----------------------------------------------------------------
+            //! const reference to the word storage
+            const storage_type &storage() const { return _words; }
+
+            //=============operators and methods to access data================
+            //! get reference to element i
+            reference operator[](size_t i)
+            {
+                return reference(&_words[i/bitmask_word_bits],
+                                 i%bitmask_word_bits);
+            }
+
+            //-----------------------------------------------------------------
+            //! get value of element i
+            bool operator[](size_t i) const
+            {
+                return (_words[i/bitmask_word_bits]>>(i%bitmask_word_bits))&1;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get reference to element i
+            //!
+            //! \throws index_error if i exceeds the size of the mask
+            //! \param i linear index of the element
+            //! \return reference to the element
+            //!
+            reference at(size_t i)
+            {
+                check_index(i);
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get value of element i
+            //!
+            //! \throws index_error if i exceeds the size of the mask
+            //! \param i linear index of the element
+            //! \return value of the element
+            //!
+            bool at(size_t i) const
+            {
+                check_index(i);
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief multidimensional access
+            //!
+            /*!
+            \code
+            mask(100,200) = true;
+            \endcode
+            !*/
+            //!
+            //! \tparam ITYPES index types
+            //! \param i first index
+            //! \param indices remaining indices
+            //! \return reference to the element
+            //!
+            template<typename ...ITYPES>
+            reference operator()(size_t i,ITYPES ...indices)
+            {
+                return (*this)[offset(i,indices...)];
+            }
+
+            //-----------------------------------------------------------------
+            //! multidimensional read access
+            template<typename ...ITYPES>
+            bool operator()(size_t i,ITYPES ...indices) const
+            {
+                return (*this)[offset(i,indices...)];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief multidimensional access
+            //!
+            //! \tparam CTYPE index container type
+            //! \param index container with the indices
+            //! \return reference to the element
+            //!
+            template<
+                     typename CTYPE,
+                     typename = typename std::enable_if<
+                         !std::is_integral<CTYPE>::value>::type
+                    >
+            reference operator()(const CTYPE &index)
+            {
+                return (*this)[_imap.offset(index)];
+            }
+
+            //-----------------------------------------------------------------
+            //! multidimensional read access
+            template<
+                     typename CTYPE,
+                     typename = typename std::enable_if<
+                         !std::is_integral<CTYPE>::value>::type
+                    >
+            bool operator()(const CTYPE &index) const
+            {
+                return (*this)[_imap.offset(index)];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief linear offset of an element
+            //!
+            template<typename ...ITYPES>
+            size_t offset(size_t i,ITYPES ...indices) const
+            {
+                return _imap.offset(std::array<size_t,sizeof...(ITYPES)+1>{
+                                    {i,size_t(indices)...}});
+            }
+
+            //====================word wide operations=========================
+            //! set all elements to value
+            void fill(bool value)
+            {
+                std::fill(_words.begin(),_words.end(),
+                          value ? ~uint64(0) : uint64(0));
+                clear_padding();
+            }
+
+            //-----------------------------------------------------------------
+            //! invert all elements
+            void flip()
+            {
+                for(auto &w: _words) w = ~w;
+                clear_padding();
+            }
+
+            //-----------------------------------------------------------------
+            //! number of elements set to true
+            size_t count() const 
+            { 
+                return simd_bit_count(_words.data(),_words.size());
+            }
+
+            //-----------------------------------------------------------------
+            //! true if at least one element is set
+            bool any() const
+            {
+                return std::any_of(_words.begin(),_words.end(),
+                                   [](uint64 w) { return w!=0; });
+            }
+
+            //-----------------------------------------------------------------
+            //! true if all elements are set
+            bool all() const { return count()==_size; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief logical and
+            //!
+            //! \throws size_mismatch_error if the masks differ in size
+            //!
+            bitmask_array &operator&=(const bitmask_array &m)
+            {
+                check_equal_size(*this,m,EXCEPTION_RECORD);
+                const uint64 *q = m.words();
+                uint64 *p = words();
+                for(size_t i=0;i<_words.size();++i) p[i] &= q[i];
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief logical or
+            //!
+            //! \throws size_mismatch_error if the masks differ in size
+            //!
+            bitmask_array &operator|=(const bitmask_array &m)
+            {
+                check_equal_size(*this,m,EXCEPTION_RECORD);
+                const uint64 *q = m.words();
+                uint64 *p = words();
+                for(size_t i=0;i<_words.size();++i) p[i] |= q[i];
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief logical exclusive or
+            //!
+            //! \throws size_mismatch_error if the masks differ in size
+            //!
+            bitmask_array &operator^=(const bitmask_array &m)
+            {
+                check_equal_size(*this,m,EXCEPTION_RECORD);
+                const uint64 *q = m.words();
+                uint64 *p = words();
+                for(size_t i=0;i<_words.size();++i) p[i] ^= q[i];
+                return *this;
+            }
+
+            //=====================iterators===================================
+            //! iterator to the first element
+            iterator begin() { return iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! iterator to the last+1 element
+            iterator end() { return iterator(this,_size); }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the first element
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the last+1 element
+            const_iterator end() const { return const_iterator(this,_size); }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the last element
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the first-1 element
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the last element
+            const_reverse_iterator rbegin() const 
+            { 
+                return const_reverse_iterator(end()); 
+            }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the first-1 element
+            const_reverse_iterator rend() const 
+            { 
+                return const_reverse_iterator(begin()); 
+            }
+
+        private:
+            //! throw index_error if i is out of range
+            void check_index(size_t i) const
+            {
+                if(i<_size) return;
+
+                std::stringstream ss;
+                ss<<"Index "<<i<<" is out of range ("<<_size<<")!";
+                throw index_error(EXCEPTION_RECORD,ss.str());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief container trait for bitmask_array
+    //!
+    //! A bitmask_array does not provide its elements in memory. 
+    //!
+    template<> struct container_trait<bitmask_array>
+    {
+        //! random access to the elements
+        static const bool is_random_access = true;
+        //! the mask is iterable
+        static const bool is_iterable = true;
+        //! the elements are packed into words
+        static const bool is_contiguous = false;
+        //! the mask is multidimensional
+        static const bool is_multidim = true;
+    };
+
+    //=====================non-member operators================================
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief equality of two masks
+    //!
+    //! Two masks are equal if they have the same size and the same 
+    //! elements. 
+    //!
+    inline bool operator==(const bitmask_array &a,const bitmask_array &b)
+    {
+        return a.size()==b.size() &&
+               std::equal(a.words(),a.words()+a.nwords(),b.words());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief inequality of two masks
+    //!
+    inline bool operator!=(const bitmask_array &a,const bitmask_array &b)
+    {
+        return !(a==b);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief logical and of two masks
+    //!
+    //! \throws size_mismatch_error if the masks differ in size
+    //! \return new mask with the shape of a
+    //!
+    inline bitmask_array operator&(const bitmask_array &a,
+                                   const bitmask_array &b)
+    {
+        bitmask_array r(a);
+        return r &= b;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief logical or of two masks
+    //!
+    //! \throws size_mismatch_error if the masks differ in size
+    //! \return new mask with the shape of a
+    //!
+    inline bitmask_array operator|(const bitmask_array &a,
+                                   const bitmask_array &b)
+    {
+        bitmask_array r(a);
+        return r |= b;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief logical exclusive or of two masks
+    //!
+    //! \throws size_mismatch_error if the masks differ in size
+    //! \return new mask with the shape of a
+    //!
+    inline bitmask_array operator^(const bitmask_array &a,
+                                   const bitmask_array &b)
+    {
+        bitmask_array r(a);
+        return r ^= b;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief logical not of a mask
+    //!
+    //! \return new mask with all elements inverted
+    //!
+    inline bitmask_array operator~(const bitmask_array &a)
+    {
+        bitmask_array r(a);
+        r.flip();
+        return r;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief number of selected elements
+    //!
+    //! Overload of the generic mask_count() counting the set bits word by
+    //! word.
+    //!
+    //! \param m reference to the mask
+    //! \return number of elements set
+    //!
+    inline size_t mask_count(const bitmask_array &m) { return m.count(); }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief parallel chunks of mask words
+    //!
+    //! Splits the words of a mask into chunks for the threads of the 
+    //! default_thread_pool(). The boundaries are placed on cache lines of 
+    //! the (aligned) word storage. Masks with less than 
+    //! parallel_threshold() elements form a single chunk.
+    //!
+    //! \param m reference to the mask
+    //! \return chunk boundaries in units of words
+    //!
+    inline std::vector<size_t> word_chunks(const bitmask_array &m)
+    {
+        size_t nwords = m.nwords();
+        thread_pool &pool = default_thread_pool();
+
+        if(m.size()<parallel_threshold() || pool.size()<2 || nwords<2)
+            return std::vector<size_t>{0,nwords};
+
+        const size_t unit = cache_line_size/sizeof(uint64);
+        size_t nchunks = pool.size();
+        std::vector<size_t> bounds(nchunks+1,nwords);
+        bounds[0] = 0;
+        for(size_t c=1;c<nchunks;++c)
+            bounds[c] = std::min(nwords,(nwords*c/nchunks+unit-1)/unit*unit);
+
+        return bounds;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief masked fill with a bitmask - element wise
+    //!
+    template<typename ATYPE>
+    void masked_fill(ATYPE &a,const bitmask_array &m,
+                     const typename ATYPE::value_type &v,std::false_type)
+    {
+        masked_fill(a,m,v,mask_kernels<false>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief masked fill with a bitmask - word wise
+    //!
+    //! Words without set bits are skipped, fully set words are filled as a
+    //! block. For all other words only the selected elements are visited.
+    //!
+    template<typename ATYPE>
+    void masked_fill(ATYPE &a,const bitmask_array &m,
+                     const typename ATYPE::value_type &v,std::true_type)
+    {
+        if(!contiguous_data<ATYPE>::is_contiguous(a))
+        {
+            masked_fill(a,m,v,std::false_type());
+            return;
+        }
+
+        auto data = a.data();
+        const uint64 *words = m.words();
+        parallel_for_each_chunk(word_chunks(m),
+                [data,words,&v](size_t,size_t wb,size_t we)
+                {
+                    for(size_t k=wb;k<we;++k)
+                    {
+                        uint64 w = words[k];
+                        auto p = data+k*bitmask_word_bits;
+                        //padding bits are zero - a full word is never the 
+                        //last word of a mask with an incomplete word
+                        if(w==~uint64(0)) 
+                            std::fill(p,p+bitmask_word_bits,v);
+                        else
+                            for(;w;w&=w-1) p[lowest_bit(w)] = v;
+                    }
+                });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief assign a value to the elements selected by a bitmask
+    //!
+    //! Overload of the generic masked_fill() which processes the mask word
+    //! by word. This is what \c a[m]=v does for a bitmask_array m.
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \tparam ATYPE array type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \param v value to assign
+    //!
+    template<typename ATYPE>
+    void masked_fill(ATYPE &a,const bitmask_array &m,
+                     const typename ATYPE::value_type &v)
+    {
+        check_equal_size(a,m,EXCEPTION_RECORD);
+        masked_fill(a,m,v,std::integral_constant<bool,
+                                contiguous_data<ATYPE>::value>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief threshold comparison for a range of words
+    //!
+    //! Version for arrays providing their data in memory. 
+    //!
+    template<
+             typename ATYPE,
+             typename COMP
+            >
+    void threshold_words(const ATYPE &a,const typename ATYPE::value_type &t,
+                         COMP comp,uint64 *words,size_t wb,size_t we,
+                         std::true_type)
+    {
+        size_t b = wb*bitmask_word_bits;
+        size_t e = std::min(we*bitmask_word_bits,a.size());
+        simd_threshold(a.data()+b,e-b,t,comp,words+wb);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief threshold comparison for a range of words
+    //!
+    //! Version for arrays whose elements must be accessed one by one.
+    //!
+    template<
+             typename ATYPE,
+             typename COMP
+            >
+    void threshold_words(const ATYPE &a,const typename ATYPE::value_type &t,
+                         COMP comp,uint64 *words,size_t wb,size_t we,
+                         std::false_type)
+    {
+        size_t n = a.size();
+        for(size_t w=wb;w<we;++w)
+        {
+            uint64 word = 0;
+            size_t i = w*bitmask_word_bits;
+            for(size_t b=0;b<bitmask_word_bits && i<n;++b,++i)
+                word |= uint64(bool(comp(a[i],t)))<<b;
+            words[w] = word;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief create a mask from a threshold comparison
+    //!
+    //! Element i of the mask is set if comp(a[i],t) is true. 
+    /*!
+    \code
+    auto frame = ...;
+    auto hot  = threshold_mask(frame,uint16(60000));
+    auto dead = threshold_mask(frame,uint16(1),std::less<uint16>());
+    \endcode
+    !*/
+    //!
+    //! For arrays with contiguous data and the standard comparison functors
+    //! the comparisons are done with the AVX-512 compare instructions which
+    //! produce the mask words directly (see simd_threshold()). Large arrays
+    //! are processed in parallel.
+    //!
+    //! \tparam ATYPE array type
+    //! \tparam COMP comparison functor
+    //! \param a reference to the array
+    //! \param t threshold 
+    //! \param comp comparison functor 
+    //! \return mask with the shape of a
+    //!
+    template<
+             typename ATYPE,
+             typename COMP
+            >
+    bitmask_array threshold_mask(const ATYPE &a,
+                                 const typename ATYPE::value_type &t,
+                                 COMP comp)
+    {
+        typedef contiguous_data<ATYPE> contiguous_type;
+        typedef std::integral_constant<bool,contiguous_type::value> use_data;
+
+        auto mask = bitmask_array::create(a.template shape<shape_t>());
+        uint64 *words = mask.words();
+
+        auto bounds = word_chunks(mask);
+
+        if(contiguous_type::is_contiguous(a))
+            parallel_for_each_chunk(bounds,
+                    [&a,&t,&comp,words](size_t,size_t wb,size_t we)
+                    { threshold_words(a,t,comp,words,wb,we,use_data()); });
+        else
+            parallel_for_each_chunk(bounds,
+                    [&a,&t,&comp,words](size_t,size_t wb,size_t we)
+                    { 
+                        threshold_words(a,t,comp,words,wb,we,
+                                        std::false_type()); 
+                    });
+
+        return mask;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief create a mask from a threshold 
+    //!
+    //! Sets all elements of the mask for which a[i]>t.
+    //!
+    //! \tparam ATYPE array type
+    //! \param a reference to the array
+    //! \param t threshold 
+    //! \return mask with the shape of a
+    //!
+    template<typename ATYPE>
+    bitmask_array threshold_mask(const ATYPE &a,
+                                 const typename ATYPE::value_type &t)
+    {
+        return threshold_mask(a,t,std::greater<typename ATYPE::value_type>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pack a byte mask
+    //!
+    template<typename MTYPE> 
+    void pack_mask(const MTYPE &m,uint64 *words,std::true_type)
+    {
+        simd_pack_mask(m.data(),m.size(),words);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pack a mask - not used
+    //!
+    template<typename MTYPE> 
+    void pack_mask(const MTYPE &,uint64 *,std::false_type) {}
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief pack a mask
+    //!
+    //! Converts a mask of bool_t, uint8 or any other type convertible to 
+    //! bool to a bitmask_array. Contiguous byte masks are packed with the 
+    //! SIMD kernel (see simd_pack_mask()).
+    //!
+    //! \tparam MTYPE mask type
+    //! \param m reference to the mask
+    //! \return packed mask with the shape of m
+    //!
+    template<typename MTYPE> bitmask_array to_bitmask(const MTYPE &m)
+    {
+        typedef typename MTYPE::value_type value_type;
+        typedef std::integral_constant<bool,
+                    contiguous_data<MTYPE>::value && 
+                    is_byte_mask<value_type>::value> use_data;
+
+        if(use_data::value && contiguous_data<MTYPE>::is_contiguous(m))
+        {
+            auto mask = bitmask_array::create(m.template shape<shape_t>());
+            pack_mask(m,mask.words(),use_data());
+            return mask;
+        }
+
+        return threshold_mask(m,value_type(0),
+                              std::not_equal_to<value_type>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unpack a mask element by element
+    //!
+    template<typename ATYPE>
+    void unpack_mask(const bitmask_array &m,ATYPE &a,
+                     const typename ATYPE::value_type &one,
+                     const typename ATYPE::value_type &zero,std::false_type)
+    {
+        parallel_for_chunks(a,[&m,&a,&one,&zero](size_t b,size_t e)
+        {
+            for(size_t i=b;i<e;++i) a[i] = m[i] ? one : zero;
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unpack a mask to contiguous data
+    //!
+    template<typename ATYPE>
+    void unpack_mask(const bitmask_array &m,ATYPE &a,
+                     const typename ATYPE::value_type &one,
+                     const typename ATYPE::value_type &zero,std::true_type)
+    {
+        if(!contiguous_data<ATYPE>::is_contiguous(a))
+        {
+            unpack_mask(m,a,one,zero,std::false_type());
+            return;
+        }
+
+        auto data = a.data();
+        size_t n = a.size();
+        parallel_for_each_chunk(word_chunks(m),
+                [&m,&one,&zero,data,n](size_t,size_t wb,size_t we)
+                {
+                    size_t b = wb*bitmask_word_bits;
+                    size_t e = std::min(we*bitmask_word_bits,n);
+                    simd_unpack_mask(m.words()+wb,e-b,data+b,one,zero);
+                });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief unpack a mask
+    //!
+    //! Sets a[i] to one if element i of the mask is set and to zero 
+    //! otherwise. This converts a bitmask_array to a numeric array or a 
+    //! byte mask.
+    /*!
+    \code
+    auto weights = dynamic_array<float32>::create(mask.shape<shape_t>());
+    unpack_mask(mask,weights,1.0f,0.0f);
+    \endcode
+    !*/
+    //!
+    //! For arrays with contiguous data the AVX-512 blend instructions are 
+    //! used if available (see simd_unpack_mask()).
+    //!
+    //! \throws size_mismatch_error if array and mask differ in size
+    //! \tparam ATYPE array type
+    //! \param m reference to the mask
+    //! \param a reference to the array
+    //! \param one value for set elements
+    //! \param zero value for cleared elements
+    //!
+    template<typename ATYPE>
+    void unpack_mask(const bitmask_array &m,ATYPE &a,
+                     const typename ATYPE::value_type &one = 
+                     typename ATYPE::value_type(1),
+                     const typename ATYPE::value_type &zero = 
+                     typename ATYPE::value_type(0))
+    {
+        check_equal_size(m,a,EXCEPTION_RECORD);
+
+        unpack_mask(m,a,one,zero,
+                    std::integral_constant<bool,
+                        contiguous_data<ATYPE>::value>());
+    }
+
+//end of namespace
+}
+}
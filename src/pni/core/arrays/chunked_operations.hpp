@@ -0,0 +1,696 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <utility>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/arrays/mdarray.hpp>
+#include <pni/core/arrays/chunked_storage.hpp>
+#include <pni/core/algorithms/math/assign.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief process the chunks of a storage sequentially
+    //!
+    template<
+             typename STYPE,
+             typename FUNC
+            >
+    void for_each_storage_chunk(STYPE &storage,FUNC func,sequential_execution)
+    {
+        for(size_t c=0;c<storage.nchunks();++c)
+        {
+            size_t begin = storage.chunk_offset(c);
+            func(storage.chunk(c),begin,begin+storage.chunk_elements(c));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief process the chunks of a storage in parallel
+    //!
+    //! Every chunk is a task for the default_thread_pool(). Storages with 
+    //! less than parallel_threshold() elements or a single chunk are 
+    //! processed by the calling thread.
+    //!
+    template<
+             typename STYPE,
+             typename FUNC
+            >
+    void for_each_storage_chunk(STYPE &storage,FUNC func,parallel_execution)
+    {
+        thread_pool &pool = default_thread_pool();
+        if(storage.size()<parallel_threshold() || pool.size()<2 ||
+           storage.nchunks()<2)
+        {
+            for_each_storage_chunk(storage,func,sequential_execution());
+            return;
+        }
+
+        pool.run(storage.nchunks(),[&storage,&func](size_t c)
+        {
+            size_t begin = storage.chunk_offset(c);
+            func(storage.chunk(c),begin,begin+storage.chunk_elements(c));
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief process an array chunk by chunk
+    //!
+    //! Calls func(ptr,begin,end) for every chunk of an array with 
+    //! chunked_storage. [begin,end) is the linear index range of the chunk 
+    //! and ptr points to the element at begin. Within a chunk the data is 
+    //! contiguous. With parallel_execution the chunks are processed 
+    //! concurrently by the threads of the default_thread_pool(). 
+    /*!
+    \code
+    auto volume = chunked_array<float32>::create(shape_t{6400,2048,2048});
+
+    for_each_chunk(volume,[](float32 *ptr,size_t begin,size_t end)
+    {
+        std::fill(ptr,ptr+(end-begin),0.f);
+    },parallel_execution());
+    \endcode
+    !*/
+    //!
+    //! \tparam T element type
+    //! \tparam IMAP index map type
+    //! \tparam IPA inplace arithmetics type
+    //! \tparam FUNC function type
+    //! \tparam POLICY execution policy 
+    //! \param a reference to the array
+    //! \param func function to call for every chunk
+    //! \param policy sequential_execution or parallel_execution
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename FUNC,
+             typename POLICY
+            >
+    void for_each_chunk(mdarray<chunked_storage<T>,IMAP,IPA> &a,FUNC func,
+                        POLICY policy)
+    {
+        for_each_storage_chunk(a.storage(),func,policy);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief process a const array chunk by chunk
+    //!
+    //! Like the above version but func receives a const pointer.
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename FUNC,
+             typename POLICY
+            >
+    void for_each_chunk(const mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                        FUNC func,POLICY policy)
+    {
+        for_each_storage_chunk(a.storage(),func,policy);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief parallel reduction over the chunks of an array
+    //!
+    //! Computes func(ptr,begin,end) for every chunk (see for_each_chunk())
+    //! and combines the partial results in the order of the chunks with op.
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename RTYPE,
+             typename FUNC,
+             typename OP
+            >
+    RTYPE reduce_chunks(const mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                        RTYPE init,FUNC func,OP op)
+    {
+        const auto &storage = a.storage();
+        std::vector<RTYPE> partial(storage.nchunks(),init);
+
+        for_each_chunk(a,[&partial,&storage,&func](const T *ptr,size_t begin,
+                                                   size_t end)
+        {
+            partial[begin/storage.chunk_size()] = func(ptr,begin,end);
+        },parallel_execution());
+
+        RTYPE result = init;
+        for(const auto &p: partial) result = op(result,p);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for chunked storage
+    //!
+    //! A chunked array as a leaf of an expression is evaluated chunk by 
+    //! chunk: seek() positions the leaf at the chunk holding an element and 
+    //! returns the number of elements until the end of this chunk. 
+    //!
+    //! Chunks are never shared with other arrays. A chunked leaf can thus 
+    //! only overlap with a destination which is the very same array and 
+    //! hence refers to the same element at every index. 
+    //!
+    //! \tparam S element type of the storage
+    //! \tparam T element type of the result
+    //!
+    template<
+             typename S,
+             typename T
+            >
+    class packet_expression<chunked_storage<S>,T>
+    {
+        private:
+            //! the storage
+            const chunked_storage<S> *_storage;
+            //! pointer to the current chunk
+            const S *_data;
+            //! linear index of the first element in the current chunk
+            size_t _begin;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+
+            //! true if the leaf can be evaluated with packets
+            static const bool value = std::is_same<S,T>::value;
+
+            //! number of leaves with data in memory
+            static const size_t leaves = 1;
+
+            //-----------------------------------------------------------------
+            //! the storage must have the size of the destination
+            static bool is_valid(const chunked_storage<S> &e,const T *,
+                                 size_t n)
+            {
+                return e.size()==n;
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit packet_expression(const chunked_storage<S> &e):
+                _storage(&e),
+                _data(nullptr),
+                _begin(0)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief position the leaf 
+            //!
+            //! \param i index of the result
+            //! \return number of elements until the end of the chunk
+            //!
+            size_t seek(size_t i)
+            {
+                size_t c = i/_storage->chunk_size();
+                _begin = _storage->chunk_offset(c);
+                _data = _storage->chunk(c);
+                return _begin+_storage->chunk_elements(c)-i;
+            }
+
+            //-----------------------------------------------------------------
+            //! load the packet starting at element i
+            typename packet_type::type load(size_t i) const
+            {
+                return packet_type::load(_data+(i-_begin));
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluation of a chunk not possible
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    bool packet_evaluate_chunk(T *,const ETYPE &,size_t,size_t,
+                               std::false_type)
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate a chunk with packets
+    //!
+    //! The leaves of the expression are checked against the chunk as if it
+    //! was part of a contiguous array starting begin elements before the 
+    //! chunk. This is conservative: a contiguous leaf which is located in 
+    //! this range without overlapping with the chunk is evaluated element 
+    //! wise.
+    //!
+    //! \param ptr pointer to the chunk
+    //! \param expr reference to the expression
+    //! \param begin linear index of the first element of the chunk
+    //! \param end linear index of the last+1 element of the chunk
+    //! \return true if the chunk was evaluated
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    bool packet_evaluate_chunk(T *ptr,const ETYPE &expr,size_t begin,
+                               size_t end,std::true_type)
+    {
+        typedef packet_expression<ETYPE,T> expression_type;
+
+        auto base = reinterpret_cast<const T*>(
+                reinterpret_cast<std::uintptr_t>(ptr)-begin*sizeof(T));
+        if(!expression_type::is_valid(expr,base,expr.size())) return false;
+
+        packet_evaluate_range(ptr,expr,begin,end);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression chunk by chunk
+    //!
+    //! Destination and expression use the same storage order. The elements 
+    //! of every chunk are written through the chunk pointer - with SIMD 
+    //! packets if possible (see packet_evaluate()).
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename ETYPE,
+             typename POLICY
+            >
+    void evaluate_chunks(mdarray<chunked_storage<T>,IMAP,IPA> &dest,
+                         const ETYPE &expr,POLICY policy,std::true_type)
+    {
+        typedef packet_expression<ETYPE,T> expression_type;
+        typedef std::integral_constant<bool,
+                    simd_packet<T>::is_vectorized && 
+                    expression_type::value> use_packets;
+
+        for_each_chunk(dest,[&expr](T *ptr,size_t begin,size_t end)
+        {
+            if(packet_evaluate_chunk(ptr,expr,begin,end,use_packets())) 
+                return;
+
+            for(size_t i=begin;i<end;++i) *ptr++ = expr[i];
+        },policy);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression chunk by chunk
+    //!
+    //! Destination and expression use a different storage order. The 
+    //! expression is accessed by the multidimensional index of every 
+    //! element.
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename ETYPE,
+             typename POLICY
+            >
+    void evaluate_chunks(mdarray<chunked_storage<T>,IMAP,IPA> &dest,
+                         const ETYPE &expr,POLICY policy,std::false_type)
+    {
+        typedef std::vector<size_t> index_type;
+        const auto &map = dest.map();
+
+        for_each_chunk(dest,[&expr,&map](T *ptr,size_t begin,size_t end)
+        {
+            for(size_t i=begin;i<end;++i) 
+                *ptr++ = expr(map.template index<index_type>(i));
+        },policy);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression to a chunked array
+    //!
+    //! Overload of evaluate_expression() used by the assignment operator 
+    //! of mdarray. The destination is written chunk by chunk.
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename ETYPE
+            >
+    void evaluate_expression(mdarray<chunked_storage<T>,IMAP,IPA> &dest,
+                             const ETYPE &expr)
+    {
+        typedef mdarray<chunked_storage<T>,IMAP,IPA> array_type;
+
+        evaluate_chunks(dest,expr,sequential_execution(),
+                        is_same_order<array_type,ETYPE>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief assign an expression to a chunked array
+    //!
+    //! \throws size_mismatch_error if the sizes of dest and expr differ
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename ETYPE
+            >
+    void assign(mdarray<chunked_storage<T>,IMAP,IPA> &dest,const ETYPE &expr,
+                sequential_execution)
+    {
+        check_equal_size(dest,expr,EXCEPTION_RECORD);
+
+        evaluate_expression(dest,expr);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief assign an expression to a chunked array in parallel
+    //!
+    //! Every chunk of the destination is evaluated by a single thread of 
+    //! the default_thread_pool(). Thus threads never share a chunk (nor a 
+    //! cache line).
+    //!
+    //! \throws size_mismatch_error if the sizes of dest and expr differ
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename ETYPE
+            >
+    void assign(mdarray<chunked_storage<T>,IMAP,IPA> &dest,const ETYPE &expr,
+                parallel_execution)
+    {
+        typedef mdarray<chunked_storage<T>,IMAP,IPA> array_type;
+
+        check_equal_size(dest,expr,EXCEPTION_RECORD);
+
+        evaluate_chunks(dest,expr,parallel_execution(),
+                        is_same_order<array_type,ETYPE>());
+    }
+
+    //=====================array operations====================================
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief minimum of a chunked array
+    //!
+    //! The following functions provide the operations of 
+    //! array_operations.hpp for chunked arrays. The chunks are processed
+    //! in parallel (see for_each_chunk()).
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    T min(const mdarray<chunked_storage<T>,IMAP,IPA> &a)
+    {
+        return reduce_chunks(a,a[0],[](const T *ptr,size_t begin,size_t end)
+               {
+                   T result = ptr[0];
+                   for(size_t i=1;i<end-begin;++i)
+                       if(ptr[i]<result) result = ptr[i];
+                   return result;
+               },
+               [](const T &x,const T &y) { return y<x ? y : x; });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief maximum of a chunked array
+    //!
+    //! The chunks are searched in parallel (see for_each_chunk()).
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    T max(const mdarray<chunked_storage<T>,IMAP,IPA> &a)
+    {
+        return reduce_chunks(a,a[0],[](const T *ptr,size_t begin,size_t end)
+               {
+                   T result = ptr[0];
+                   for(size_t i=1;i<end-begin;++i)
+                       if(ptr[i]>result) result = ptr[i];
+                   return result;
+               },
+               [](const T &x,const T &y) { return y>x ? y : x; });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief offset of an extremum
+    //!
+    //! Returns the linear offset of the first element e for which no other
+    //! element x satisfies comp(x,e).
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename COMP
+            >
+    size_t extremum_offset(const mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                           COMP comp)
+    {
+        typedef std::pair<T,size_t> result_type;
+
+        return reduce_chunks(a,result_type(a[0],0),
+               [&comp](const T *ptr,size_t begin,size_t end)
+               {
+                   result_type result(ptr[0],begin);
+                   for(size_t i=1;i<end-begin;++i)
+                       if(comp(ptr[i],result.first)) 
+                           result = result_type(ptr[i],begin+i);
+                   return result;
+               },
+               [&comp](const result_type &x,const result_type &y)
+               {
+                   return comp(y.first,x.first) ? y : x;
+               }).second;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief linear offset of the maximum of a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    size_t max_offset(const mdarray<chunked_storage<T>,IMAP,IPA> &a)
+    {
+        return extremum_offset(a,[](const T &x,const T &y) { return x>y; });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief linear offset of the minimum of a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    size_t min_offset(const mdarray<chunked_storage<T>,IMAP,IPA> &a)
+    {
+        return extremum_offset(a,[](const T &x,const T &y) { return x<y; });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief apply a function to every element of a chunked array
+    //!
+    //! The chunks are processed in parallel.
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA,
+             typename FUNC
+            >
+    void transform_chunks(mdarray<chunked_storage<T>,IMAP,IPA> &a,FUNC func)
+    {
+        for_each_chunk(a,[&func](T *ptr,size_t begin,size_t end)
+        {
+            for(size_t i=0;i<end-begin;++i) func(ptr[i]);
+        },parallel_execution());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief clip a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    void clip(mdarray<chunked_storage<T>,IMAP,IPA> &a,
+              typename chunked_storage<T>::value_type minth,
+              typename chunked_storage<T>::value_type maxth)
+    {
+        transform_chunks(a,[minth,maxth](T &v)
+        {
+            if(v<=minth) v = minth;
+            else if(v>=maxth) v = maxth;
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief clip a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    void clip(mdarray<chunked_storage<T>,IMAP,IPA> &a,
+              typename chunked_storage<T>::value_type minth,
+              typename chunked_storage<T>::value_type maxth,
+              typename chunked_storage<T>::value_type minval,
+              typename chunked_storage<T>::value_type maxval)
+    {
+        transform_chunks(a,[minth,maxth,minval,maxval](T &v)
+        {
+            if(v<=minth) v = minval;
+            else if(v>=maxth) v = maxval;
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief clip minimum values of a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    void min_clip(mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                  typename chunked_storage<T>::value_type threshold)
+    {
+        min_clip(a,threshold,threshold);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief clip minimum values of a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    void min_clip(mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                  typename chunked_storage<T>::value_type threshold,
+                  typename chunked_storage<T>::value_type value)
+    {
+        transform_chunks(a,[threshold,value](T &v)
+        {
+            if(v<=threshold) v = value;
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief clip maximum values of a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    void max_clip(mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                  typename chunked_storage<T>::value_type threshold)
+    {
+        max_clip(a,threshold,threshold);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief clip maximum values of a chunked array
+    //!
+    template<
+             typename T,
+             typename IMAP,
+             typename IPA
+            >
+    void max_clip(mdarray<chunked_storage<T>,IMAP,IPA> &a,
+                  typename chunked_storage<T>::value_type threshold,
+                  typename chunked_storage<T>::value_type value)
+    {
+        transform_chunks(a,[threshold,value](T &v)
+        {
+            if(v>=threshold) v = value;
+        });
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,345 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/utilities/container_iterator.hpp>
+#include <pni/core/arrays/aligned_allocator.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief default chunk size 
+    //!
+    //! Size of a chunk in bytes used by chunked_storage if no chunk size is
+    //! given.
+    //!
+    static const size_t default_chunk_bytes = 64*1024*1024;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief storage made of separately allocated chunks
+    //!
+    //! A storage type for mdarray which does not require a single large 
+    //! allocation. The linear index range of the array is split into chunks
+    //! of chunk_size() elements (the last chunk may be shorter) and every 
+    //! chunk is allocated on its own. Chunks are aligned to 64 Bytes and 
+    //! allocations of at least huge_page_size bytes are backed by 
+    //! transparent huge pages (see aligned_allocator). The elements are 
+    //! value initialized.
+    /*!
+    \code
+    typedef chunked_array<float32> array_type;
+    typedef array_factory<array_type> factory;
+
+    //a volume of 100 GByte - every chunk holds 16 frames
+    auto volume = factory::create_chunked(shape_t{6400,2048,2048},
+                                          shape_t{16,2048,2048});
+    \endcode
+    !*/
+    //!
+    //! As the index maps of the array are not aware of the chunks the 
+    //! chunks are blocks of the linear storage. For an array in C order 
+    //! with a chunk size which is a multiple of the size of an entry along
+    //! the first dimension every chunk holds a fixed number of entries 
+    //! (a slab of frames for an image stack).
+    //!
+    //! Element access via operator[] has to locate the chunk first. 
+    //! Algorithms working on large amounts of data should thus process the
+    //! data chunk by chunk via chunk() (see for_each_chunk()). The data is 
+    //! not contiguous and the storage does not provide data().
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> class chunked_storage
+    {
+        public:
+            //=================public types====================================
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T* pointer;
+            //! const pointer type
+            typedef const T* const_pointer;
+            //! reference type
+            typedef T& reference;
+            //! const reference type
+            typedef const T& const_reference;
+            //! iterator type
+            typedef container_iterator<chunked_storage<T>> iterator;
+            //! const iterator type
+            typedef container_iterator<const chunked_storage<T>> 
+                const_iterator;
+            //! reverse iterator type
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            //! const reverse iterator type
+            typedef std::reverse_iterator<const_iterator> 
+                const_reverse_iterator;
+            //! size type
+            typedef size_t size_type;
+            //! pointer difference type
+            typedef std::ptrdiff_t difference_type;
+            //! container type of a single chunk
+            typedef aligned_vector<T,64,true> chunk_type;
+        private:
+            //! total number of elements
+            size_t _size;
+            //! number of elements per chunk
+            size_t _chunk_size;
+            //! the chunks
+            std::vector<chunk_type> _chunks;
+
+            //-----------------------------------------------------------------
+            void check_index(size_t i) const
+            {
+                if(i>=_size)
+                {
+                    std::stringstream ss;
+                    ss<<"Index "<<i<<" exceeds storage size "<<_size<<"!";
+                    throw index_error(EXCEPTION_RECORD,ss.str());
+                }
+            }
+        public:
+            //=================constructors====================================
+            //! default constructor - empty storage
+            chunked_storage():
+                _size(0),
+                _chunk_size(default_chunk_size()),
+                _chunks()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! Allocates n elements in chunks of default_chunk_size() 
+            //! elements.
+            //!
+            //! \param n number of elements
+            //!
+            explicit chunked_storage(size_t n):
+                chunked_storage(n,default_chunk_size())
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \throws value_error if chunk_size is 0
+            //! \param n number of elements
+            //! \param chunk_size number of elements per chunk
+            //!
+            chunked_storage(size_t n,size_t chunk_size):
+                _size(n),
+                _chunk_size(chunk_size),
+                _chunks()
+            {
+                if(!chunk_size)
+                    throw value_error(EXCEPTION_RECORD,
+                            "The chunk size must not be 0!");
+
+                _chunks.reserve((n+chunk_size-1)/chunk_size);
+                for(size_t offset=0;offset<n;offset+=chunk_size)
+                    _chunks.emplace_back(std::min(chunk_size,n-offset));
+            }
+
+            //=================public methods==================================
+            //! default number of elements per chunk
+            static size_t default_chunk_size() noexcept
+            {
+                return std::max<size_t>(default_chunk_bytes/sizeof(T),1);
+            }
+
+            //-----------------------------------------------------------------
+            //! number of elements
+            size_t size() const noexcept { return _size; }
+
+            //-----------------------------------------------------------------
+            //! true if the storage is empty
+            bool empty() const noexcept { return _size==0; }
+
+            //=================chunk access====================================
+            //! number of chunks
+            size_t nchunks() const noexcept { return _chunks.size(); }
+
+            //-----------------------------------------------------------------
+            //! number of elements per chunk (except for the last one)
+            size_t chunk_size() const noexcept { return _chunk_size; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief linear index of a chunk
+            //!
+            //! \param c chunk index
+            //! \return linear index of the first element of chunk c
+            //!
+            size_t chunk_offset(size_t c) const noexcept 
+            { 
+                return c*_chunk_size; 
+            }
+
+            //-----------------------------------------------------------------
+            //! number of elements in chunk c
+            size_t chunk_elements(size_t c) const noexcept 
+            { 
+                return _chunks[c].size(); 
+            }
+
+            //-----------------------------------------------------------------
+            //! pointer to the first element of chunk c
+            pointer chunk(size_t c) noexcept { return _chunks[c].data(); }
+
+            //-----------------------------------------------------------------
+            //! const pointer to the first element of chunk c
+            const_pointer chunk(size_t c) const noexcept 
+            { 
+                return _chunks[c].data(); 
+            }
+
+            //=================element access==================================
+            //! unchecked element access
+            reference operator[](size_t i) 
+            { 
+                return _chunks[i/_chunk_size][i%_chunk_size]; 
+            }
+
+            //-----------------------------------------------------------------
+            //! unchecked element access
+            const_reference operator[](size_t i) const 
+            { 
+                return _chunks[i/_chunk_size][i%_chunk_size]; 
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief checked element access
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i element index
+            //! \return reference to the element
+            //!
+            reference at(size_t i) 
+            { 
+                check_index(i);
+                return (*this)[i]; 
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief checked element access
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i element index
+            //! \return reference to the element
+            //!
+            const_reference at(size_t i) const 
+            { 
+                check_index(i);
+                return (*this)[i]; 
+            }
+
+            //-----------------------------------------------------------------
+            //! reference to the first element
+            reference front() { return _chunks.front().front(); }
+
+            //-----------------------------------------------------------------
+            //! reference to the first element
+            const_reference front() const { return _chunks.front().front(); }
+
+            //-----------------------------------------------------------------
+            //! reference to the last element
+            reference back() { return _chunks.back().back(); }
+
+            //-----------------------------------------------------------------
+            //! reference to the last element
+            const_reference back() const { return _chunks.back().back(); }
+
+            //=================iterators=======================================
+            //! iterator to the first element
+            iterator begin() { return iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! iterator to the last+1 element
+            iterator end() { return iterator(this,_size); }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the first element
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the last+1 element
+            const_iterator end() const { return const_iterator(this,_size); }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the last element
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the last element
+            const_reverse_iterator rbegin() const 
+            { 
+                return const_reverse_iterator(end()); 
+            }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the first-1 element
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the first-1 element
+            const_reverse_iterator rend() const 
+            { 
+                return const_reverse_iterator(begin()); 
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief container trait for chunked storage
+    //!
+    template<typename T> struct container_trait<chunked_storage<T>>
+    {
+        //! random access
+        static const bool is_random_access = true;
+        //! iterable
+        static const bool is_iterable   = true;
+        //! data is not contiguous
+        static const bool is_contiguous = false;
+        //! storage is one dimensional
+        static const bool is_multidim   = false;
+    };
+
+//end of namespace
+}
+}
@@ -0,0 +1,98 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/arrays/pointer_range_storage.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief non-owning storage
+    //!
+    //! A storage type for mdarray referring to memory owned by somebody else
+    //! (a driver buffer, a buffer from another library, ...). Like a span it 
+    //! only stores a pointer and the number of elements. Creating an array 
+    //! over such a buffer does not copy any data.
+    /*!
+    \code
+    typedef external_array<uint16> array_type;
+    typedef array_factory<array_type> factory;
+
+    uint16 *frame = driver.next_frame();
+    auto a = factory::wrap(frame,shape_t{2048,2048});
+    a(slice(0,10),slice(0,10)) = 0; //modifies the drivers buffer
+    \endcode
+    !*/
+    //!
+    //! The user is responsible that the buffer lives longer than any array 
+    //! or view referring to it. Copies of the storage (and thus of arrays 
+    //! using it) refer to the same buffer. As the storage cannot allocate 
+    //! memory, functions creating new arrays of this type (like 
+    //! mdarray::create) are not available.
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> class external_storage : 
+        public pointer_range_storage<T>
+    {
+        public:
+            //=================constructors====================================
+            //! default constructor - empty storage
+            external_storage() noexcept:pointer_range_storage<T>() {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param data pointer to the first element of the buffer
+            //! \param n number of elements in the buffer
+            //!
+            external_storage(T *data,size_t n) noexcept:
+                pointer_range_storage<T>(data,n)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief container trait for external storage
+    //!
+    template<typename T> struct container_trait<external_storage<T>>
+    {
+        //! random access
+        static const bool is_random_access = true;
+        //! iterable
+        static const bool is_iterable   = true;
+        //! data is contiguous
+        static const bool is_contiguous = true;
+        //! storage is one dimensional
+        static const bool is_multidim   = false;
+    };
+
+//end of namespace
+}
+}
@@ -0,0 +1,502 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+#include <pni/core/types/types.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/arrays/mdarray.hpp>
+#include <pni/core/arrays/slice.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief ring buffer for frames
+    //!
+    //! Stores the last K frames of a stream of frames (for instance the 
+    //! images of a detector) in K preallocated slots of a single (K,...) 
+    //! array. Inserting a frame with push() is O(1) in the number of frames
+    //! and does not allocate memory: the oldest frame is overwritten. 
+    //! Along with the frames the buffer maintains the rolling sum over all
+    //! frames in the buffer.
+    /*!
+    \code
+    frame_ring_buffer<uint16> buffer(100,shape_t{2048,2048});
+
+    //producer thread
+    while(acquisition_running()) buffer.push(read_frame());
+
+    //consumer threads
+    auto frame = dynamic_array<uint16>::create(shape_t{2048,2048});
+    auto mean  = dynamic_array<float64>::create(shape_t{2048,2048});
+    buffer.copy_frame(0,frame); //latest frame
+    buffer.copy_mean(mean);     //mean over the last 100 frames
+    \endcode
+    !*/
+    //!
+    //! \section frame_ring_buffer_threads Threads
+    //!
+    //! The buffer can be used by one producer thread calling push() and 
+    //! any number of consumer threads. The producer never waits for 
+    //! consumers. Consumers obtain consistent copies of frames and of the 
+    //! rolling sum with copy_frame(), copy_sum() and copy_mean(). These use
+    //! a sequence number per slot (a seqlock): a copy which overlapped with
+    //! the producer writing the same data is repeated. 
+    //!
+    //! The views returned by slot(), frame() and window() refer directly to
+    //! the storage of the buffer. They are not synchronized with the 
+    //! producer and should only be used by the producer thread or while no
+    //! frames are pushed. Views remain valid for the lifetime of the 
+    //! buffer.
+    //!
+    //! The rolling sum is accumulated in double precision. It is updated 
+    //! incrementally by push() (the evicted frame is subtracted). For 
+    //! integer frames the sum is exact as long as it stays below 2^53. For
+    //! floating point frames adding and subtracting frames of different 
+    //! magnitude leaves rounding errors in the sum. To keep these from 
+    //! accumulating over a long stream, push() also sums up the frames of 
+    //! each cycle through the slots in a second buffer. When the last slot 
+    //! is written this buffer holds the sum over the stored frames and 
+    //! replaces the incremental sum. Thus the error never spans more than 
+    //! capacity() frames. This costs the memory of a second sum but no 
+    //! extra pass over the frames.
+    //!
+    //! \tparam T element type of the frames
+    //!
+    template<typename T> class frame_ring_buffer
+    {
+        public:
+            //! element type
+            typedef T value_type;
+            //! array type holding the frames
+            typedef mdarray<std::vector<T>,dynamic_cindex_map> array_type;
+            //! view type for a single frame 
+            typedef array_view<array_type> view_type;
+            //! const view type for a single frame
+            typedef array_view<const array_type> const_view_type;
+            //! array type for the rolling sum
+            typedef mdarray<std::vector<float64>,dynamic_cindex_map> 
+                sum_type;
+        private:
+            //! number of slots
+            size_t _capacity;
+            //! frame shape 
+            shape_t _frame_shape;
+            //! number of elements in a frame
+            size_t _frame_size;
+            //! frame storage of shape (K,...)
+            array_type _frames;
+            //! rolling sum over all frames in the buffer
+            sum_type _sum;
+            //! sum over the frames pushed in the actual cycle through the slots
+            sum_type _cycle_sum;
+            //! number of frames pushed so far
+            std::atomic<uint64> _count;
+            //! sequence number for each slot 
+            std::unique_ptr<std::atomic<uint64>[]> _slot_sequence;
+            //! sequence number for the rolling sum 
+            std::atomic<uint64> _sum_sequence;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create the selection for a slot
+            //!
+            std::vector<slice> slot_selection(size_t s) const
+            {
+                std::vector<slice> selection{slice(s,s+1)};
+                for(auto n: _frame_shape) selection.push_back(slice(0,n));
+                return selection;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check a container size
+            //!
+            //! \throws size_mismatch_error if c does not have the size of a 
+            //! frame
+            //!
+            template<typename CTYPE> void check_frame_size(const CTYPE &c) const
+            {
+                if(c.size()==_frame_size) return;
+
+                std::stringstream ss;
+                ss<<"Container size ("<<c.size()<<") does not match the ";
+                ss<<"frame size ("<<_frame_size<<")!";
+                throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief frame number of the k-th latest frame
+            //!
+            //! \throws index_error if k exceeds the number of frames 
+            //! \param k frame index (0 is the latest frame)
+            //! \param count number of frames pushed
+            //!
+            uint64 frame_number(size_t k,uint64 count) const
+            {
+                if(k>=std::min<uint64>(count,capacity()))
+                {
+                    std::stringstream ss;
+                    ss<<"Frame index "<<k<<" exceeds the number of frames ";
+                    ss<<"in the buffer ("<<size()<<")!";
+                    throw index_error(EXCEPTION_RECORD,ss.str());
+                }
+
+                return count-1-k;
+            }
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! Allocates the memory for k frames of the given shape. All 
+            //! memory is allocated here. 
+            //!
+            //! \throws value_error if k is 0 
+            //! \tparam CTYPE container type for the frame shape
+            //! \param k number of frames in the buffer
+            //! \param frame_shape shape of a single frame
+            //!
+            template<typename CTYPE>
+            frame_ring_buffer(size_t k,const CTYPE &frame_shape):
+                _capacity(k),
+                _frame_shape(frame_shape.begin(),frame_shape.end()),
+                _frame_size(std::accumulate(_frame_shape.begin(),
+                                            _frame_shape.end(),size_t(1),
+                                            std::multiplies<size_t>())),
+                _frames(),
+                _sum(sum_type::create(_frame_shape)),
+                _cycle_sum(sum_type::create(_frame_shape)),
+                _count(0),
+                _slot_sequence(new std::atomic<uint64>[k ? k : 1]),
+                _sum_sequence(0)
+            {
+                if(!k)
+                    throw value_error(EXCEPTION_RECORD,
+                            "A frame buffer requires at least one slot!");
+
+                shape_t shape{k};
+                shape.insert(shape.end(),_frame_shape.begin(),
+                             _frame_shape.end());
+                _frames = array_type::create(shape);
+                std::fill(_frames.begin(),_frames.end(),value_type(0));
+                std::fill(_sum.begin(),_sum.end(),0.);
+                std::fill(_cycle_sum.begin(),_cycle_sum.end(),0.);
+
+                for(size_t s=0;s<k;++s) _slot_sequence[s].store(0);
+            }
+
+            //-----------------------------------------------------------------
+            //! copy construction is not allowed
+            frame_ring_buffer(const frame_ring_buffer &) = delete;
+
+            //-----------------------------------------------------------------
+            //! copy assignment is not allowed
+            frame_ring_buffer &operator=(const frame_ring_buffer &) = delete;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of slots 
+            //!
+            //! \return maximum number of frames in the buffer (K)
+            //!
+            size_t capacity() const { return _capacity; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of frames
+            //!
+            //! \return number of frames currently in the buffer
+            //!
+            size_t size() const 
+            { 
+                return std::min<uint64>(_count.load(),capacity()); 
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief total number of frames 
+            //!
+            //! \return number of frames pushed since the buffer was created
+            //!
+            uint64 count() const { return _count.load(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief shape of a frame
+            //!
+            const shape_t &frame_shape() const { return _frame_shape; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief insert a frame
+            //!
+            //! Copies the frame to the slot of the oldest frame and updates
+            //! the rolling sum. Once all slots have been overwritten the 
+            //! rolling sum is replaced by the sum over the stored frames. 
+            //! Must only be called by one thread at a time. 
+            //!
+            //! \throws size_mismatch_error if the frame does not have the 
+            //! size of the frames in the buffer
+            //! \tparam ATYPE array type of the frame
+            //! \param frame the new frame
+            //!
+            template<typename ATYPE> void push(const ATYPE &frame)
+            {
+                check_frame_size(frame);
+
+                uint64 n = _count.load(std::memory_order_relaxed);
+                size_t s = n%capacity();
+                bool evict = n>=capacity();
+                value_type *p = _frames.data()+s*_frame_size;
+                float64 *sum = _sum.data();
+                float64 *cycle_sum = _cycle_sum.data();
+
+                std::atomic<uint64> &sequence = _slot_sequence[s];
+                sequence.store(2*n+1,std::memory_order_relaxed);
+                _sum_sequence.store(2*n+1,std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                auto iter = frame.begin();
+                if(evict && s+1==capacity())
+                    //last slot of a cycle - renew the sum
+                    for(size_t i=0;i<_frame_size;++i,++iter)
+                    {
+                        value_type v = *iter;
+                        sum[i] = cycle_sum[i]+float64(v);
+                        cycle_sum[i] = 0.;
+                        p[i] = v;
+                    }
+                else if(evict)
+                    for(size_t i=0;i<_frame_size;++i,++iter)
+                    {
+                        value_type v = *iter;
+                        sum[i] += float64(v)-float64(p[i]);
+                        cycle_sum[i] += float64(v);
+                        p[i] = v;
+                    }
+                else
+                    for(size_t i=0;i<_frame_size;++i,++iter)
+                    {
+                        value_type v = *iter;
+                        sum[i] += float64(v);
+                        p[i] = v;
+                    }
+
+                sequence.store(2*n+2,std::memory_order_release);
+                _sum_sequence.store(2*n+2,std::memory_order_release);
+                _count.store(n+1,std::memory_order_release);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy a frame
+            //!
+            //! Copies the k-th latest frame (k=0 is the latest frame) to 
+            //! dest. If the producer overwrites the frame during the copy 
+            //! the copy is repeated with the frame which is then the k-th 
+            //! latest. This function can be called concurrently to push().
+            //!
+            //! \throws index_error if k exceeds the number of frames in the
+            //! buffer
+            //! \throws size_mismatch_error if dest does not have the size of
+            //! a frame
+            //! \tparam CTYPE container type
+            //! \param k frame index 
+            //! \param dest container to which the frame is copied
+            //! \return number of the frame copied (counting from 0)
+            //!
+            template<typename CTYPE>
+            uint64 copy_frame(size_t k,CTYPE &dest) const
+            {
+                check_frame_size(dest);
+
+                while(true)
+                {
+                    uint64 n = frame_number(k,
+                                   _count.load(std::memory_order_acquire));
+                    size_t s = n%capacity();
+                    const value_type *p = _frames.data()+s*_frame_size;
+                    const std::atomic<uint64> &sequence = _slot_sequence[s];
+
+                    if(sequence.load(std::memory_order_acquire)!=2*n+2) 
+                        continue;
+                    std::copy(p,p+_frame_size,dest.begin());
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if(sequence.load(std::memory_order_relaxed)==2*n+2) 
+                        return n;
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy the rolling sum
+            //!
+            //! Copies the sum over all frames in the buffer to dest. This 
+            //! function can be called concurrently to push().
+            //!
+            //! \throws size_mismatch_error if dest does not have the size of
+            //! a frame
+            //! \tparam CTYPE container type
+            //! \param dest container to which the sum is copied
+            //! \return number of frames pushed when the sum was copied
+            //!
+            template<typename CTYPE> uint64 copy_sum(CTYPE &dest) const
+            {
+                check_frame_size(dest);
+
+                while(true)
+                {
+                    uint64 seq = _sum_sequence.load(std::memory_order_acquire);
+                    if(seq%2) continue;
+
+                    std::copy(_sum.begin(),_sum.end(),dest.begin());
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if(_sum_sequence.load(std::memory_order_relaxed)==seq) 
+                        return seq/2;
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy the rolling mean
+            //!
+            //! Copies the mean over all frames in the buffer to dest which 
+            //! should have a floating point element type. This function can
+            //! be called concurrently to push().
+            //!
+            //! \throws size_mismatch_error if dest does not have the size of
+            //! a frame
+            //! \throws value_error if the buffer is empty
+            //! \tparam CTYPE container type
+            //! \param dest container to which the mean is copied
+            //! \return number of frames pushed when the mean was computed
+            //!
+            template<typename CTYPE> uint64 copy_mean(CTYPE &dest) const
+            {
+                uint64 n = copy_sum(dest);
+                if(!n)
+                    throw value_error(EXCEPTION_RECORD,
+                            "Cannot compute the mean of an empty buffer!");
+
+                float64 scale = 1./std::min<uint64>(n,capacity());
+                for(auto &v: dest) v *= scale;
+                return n;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief view on a slot
+            //!
+            //! Returns a view on slot s of the buffer. The view refers to the
+            //! contiguous storage of the slot. Slot s holds the frames 
+            //! s, s+K, s+2K, ... 
+            //!
+            //! \throws index_error if s exceeds the number of slots
+            //! \param s slot index
+            //! \return view on the slot
+            //!
+            view_type slot(size_t s)
+            {
+                check_index_in_dim(s,capacity(),EXCEPTION_RECORD);
+                return _frames(slot_selection(s));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief view on a slot
+            //!
+            //! \throws index_error if s exceeds the number of slots
+            //! \param s slot index
+            //! \return const view on the slot
+            //!
+            const_view_type slot(size_t s) const
+            {
+                check_index_in_dim(s,capacity(),EXCEPTION_RECORD);
+                return _frames(slot_selection(s));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief view on a frame 
+            //!
+            //! Returns a view on the k-th latest frame (k=0 is the latest 
+            //! frame). 
+            //!
+            //! \throws index_error if k exceeds the number of frames in the
+            //! buffer
+            //! \param k frame index
+            //! \return const view on the frame 
+            //!
+            const_view_type frame(size_t k) const
+            {
+                return slot(frame_number(k,_count.load())%capacity());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief views on all frames
+            //!
+            //! Returns views on all frames in the buffer in the order in 
+            //! which they were pushed. The first view refers to the oldest 
+            //! frame, the last to the latest. 
+            //!
+            //! \return vector of views 
+            //!
+            std::vector<const_view_type> window() const
+            {
+                std::vector<const_view_type> views;
+                uint64 n = _count.load();
+                size_t size = std::min<uint64>(n,capacity());
+
+                views.reserve(size);
+                for(size_t k=size;k>0;--k)
+                    views.push_back(slot((n-k)%capacity()));
+
+                return views;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief rolling sum 
+            //!
+            //! Returns a reference to the rolling sum. The sum is not 
+            //! synchronized with push() (see copy_sum()).
+            //!
+            //! \return reference to the sum over all frames in the buffer
+            //!
+            const sum_type &sum() const { return _sum; }
+    };
+
+//end of namespace
+}
+}
@@ -46,6 +46,11 @@ namespace core{
     //! 
     class c_index_map_imp
     {
+        public:
+            //! the last index varies fastest
+            static const bool c_order = true;
+            //! offsets are linear in the indices
+            static const bool strided = true;
         private:
             //!
             //! \brief compute the offset 
@@ -28,6 +28,9 @@
 #include <pni/core/arrays/index_map/index_map.hpp>
 #include <pni/core/arrays/index_map/static_index_map.hpp>
 #include <pni/core/arrays/index_map/c_index_map_imp.hpp>
+#include <pni/core/arrays/index_map/f_index_map_imp.hpp>
+#include <pni/core/arrays/index_map/tiled_index_map_imp.hpp>
+#include <pni/core/types/container_trait.hpp>
 #include <pni/core/utilities/container_utils.hpp>
 
 namespace pni{
@@ -80,6 +83,124 @@ namespace core{
     template<size_t NDIMS> 
     using fixed_dim_cindex_map = index_map<std::array<size_t,NDIMS>,c_index_map_imp>;
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief template for a static Fortran map
+    //!  
+    //! A template alias for a static index map with Fortran (column major) 
+    //! ordering.
+    //! 
+    //! \code
+    //! static_findex_map<3,3> matrix_map; 
+    //! \endcode
+    //! 
+    //! \tparam DIMS number of elements along each dimension
+    //! 
+    template<size_t... DIMS> 
+    using static_findex_map = static_index_map<f_index_map_imp,DIMS...>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief definition of a dynamic Fortran index map
+    //!  
+    //! Type definition of a fully dynamic index map with Fortran (column 
+    //! major) ordering. Use this map for data written by Fortran codes or
+    //! detectors reading out column by column.
+    //! 
+    typedef index_map<std::vector<size_t>,f_index_map_imp> dynamic_findex_map;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief fixed dimension dynamic Fortran index map
+    //! 
+    //! Like fixed_dim_cindex_map but with Fortran (column major) ordering.
+    //!
+    //! \tparam NDIMS number of dimensions
+    template<size_t NDIMS> 
+    using fixed_dim_findex_map = index_map<std::array<size_t,NDIMS>,f_index_map_imp>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief dynamic tiled index map
+    //!  
+    //! A fully dynamic index map storing the data in tiles of TILE elements
+    //! along each dimension (see tiled_index_map_imp). Use this map for 
+    //! large images and volumes which are accessed by neighborhood 
+    //! (stencils, filters) or along different axes (transposes, rotations).
+    //!
+    //! \code
+    //! typedef dynamic_tiled_index_map<32> map_type;
+    //! \endcode
+    //! 
+    //! \tparam TILE number of elements along each dimension of a tile
+    //!
+    template<size_t TILE> 
+    using dynamic_tiled_index_map = index_map<std::vector<size_t>,
+                                              tiled_index_map_imp<TILE>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief fixed dimension tiled index map
+    //! 
+    //! Like fixed_dim_cindex_map but with tiled storage.
+    //!
+    //! \tparam NDIMS number of dimensions
+    //! \tparam TILE number of elements along each dimension of a tile
+    //!
+    template<
+             size_t NDIMS,
+             size_t TILE
+            > 
+    using fixed_dim_tiled_index_map = index_map<std::array<size_t,NDIMS>,
+                                                tiled_index_map_imp<TILE>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief check storage order of two types
+    //!
+    //! \c value is true if the linear indices of two types refer to the same 
+    //! multidimensional indices. This is the case if both are arrays using 
+    //! the same index map implementation (and thus the same storage order)
+    //! or if at least one of them is not a multidimensional array (like a
+    //! std::vector or a scalar).
+    //!
+    //! \tparam T1 first type
+    //! \tparam T2 second type
+    //!
+    template<
+             typename T1,
+             typename T2,
+             bool = container_trait<typename std::remove_const<T1>::type>::is_multidim &&
+                    container_trait<typename std::remove_const<T2>::type>::is_multidim
+            >
+    struct is_same_order : std::true_type
+    {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief check storage order of two arrays
+    //!
+    //! Specialization for two multidimensional arrays. 
+    //!
+    //! \tparam T1 first array type
+    //! \tparam T2 second array type
+    //!
+    template<
+             typename T1,
+             typename T2
+            >
+    struct is_same_order<T1,T2,true> : 
+        std::is_same<typename T1::map_type::implementation_type,
+                     typename T2::map_type::implementation_type>
+    {};
+
     //=================define some convienance function========================
 
     /*!
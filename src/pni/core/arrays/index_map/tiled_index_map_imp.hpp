@@ -0,0 +1,444 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <type_traits>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief tiled index map implementation
+    //! 
+    //! This implementation stores an array as a set of tiles (blocks) with 
+    //! an edge length of TILE elements along each dimension. The tiles are 
+    //! stored one after the other in C order and the elements within a tile
+    //! are stored in C order too. Thus elements which are close to each 
+    //! other along any dimension are also close in memory. This reduces 
+    //! cache misses for stencils, rotations, and transpositions. 
+    //!
+    //! Tiles at the upper end of a dimension are truncated if the number of 
+    //! elements along this dimension is not a multiple of TILE. As a 
+    //! consequence no padding is required and the map addresses exactly
+    //! as many elements as a C index map of the same shape.
+    //!
+    //! In the 2D case the offset of the element (i,j) in an array of shape
+    //! (n,m) is 
+    //!
+    //! \f[ o = t_i T m + t_j T h + r_i w + r_j \f]
+    //!
+    //! where \f$t=\lfloor i/T\rfloor\f$ and \f$r = i \bmod T\f$ are the 
+    //! tile index and the index within the tile, and \f$h\f$ and \f$w\f$ the
+    //! (possibly truncated) height and width of the tile.
+    //!
+    //! Offsets are not linear in the indices. Thus views on tiled arrays 
+    //! cannot use strides and are never contiguous. Computing an offset 
+    //! is also more expensive than for a C-ordered map - the layout pays 
+    //! off for large arrays which do not fit into the cache. 
+    //!
+    //! \tparam TILE number of elements along each dimension of a tile
+    //! 
+    template<size_t TILE> class tiled_index_map_imp
+    {
+        static_assert(TILE>0,"The tile size must not be 0!");
+        public:
+            //! tiles and the elements within a tile are stored in C order
+            static const bool c_order = true;
+            //! offsets cannot be computed from strides
+            static const bool strided = false;
+            //! number of elements along each dimension of a tile
+            static const size_t tile_size = TILE;
+        private:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief tile extent
+            //!
+            //! \param n number of elements along a dimension
+            //! \param first first index of the tile along this dimension
+            //! \return number of elements of the tile along this dimension
+            //!
+            static size_t extent(size_t n,size_t first)
+            {
+                return n-first < TILE ? n-first : TILE;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief first index of a tile
+            //!
+            //! For a power of two TILE the index is rounded down with a 
+            //! mask, otherwise with a division.
+            //!
+            //! \param i index along a dimension
+            //! \return first index of the tile containing i
+            //!
+            static size_t tile_start(size_t i)
+            {
+                return (TILE&(TILE-1))==0 ? i&~(TILE-1) : (i/TILE)*TILE;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief add a dimension to the offset
+            //!
+            //! Updates the offset of the first element of the tile, the 
+            //! number of elements of the tile along the dimensions 
+            //! processed so far, and the offset within the tile.
+            //!
+            //! \param n number of elements along the dimension
+            //! \param i index along the dimension
+            //! \param offset offset of the first element of the tile
+            //! \param inner number of elements of the tile
+            //! \param local offset within the tile
+            //!
+            static void add_dimension(size_t n,size_t i,size_t &offset,
+                                      size_t &inner,size_t &local)
+            {
+                size_t first = tile_start(i);
+                size_t h = extent(n,first);
+
+                offset = offset*n + first*inner;
+                inner *= h;
+                local = local*h + (i-first);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute the offset 
+            //! 
+            //! Computes the offset for a shape range. The index values are 
+            //! obtained from a function which returns the index along the 
+            //! next dimension on every call.
+            //!
+            //! \tparam SITERT shape iterator type
+            //! \tparam IFUNC index function type
+            //! \param shape_start iterator to the first shape element
+            //! \param shape_stop iterator to the last+1 shape element
+            //! \param next_index function returning the next index value 
+            //! \return offset value
+            //! 
+            template<
+                     typename SITERT,
+                     typename IFUNC
+                    >
+            static size_t offset(SITERT shape_start,SITERT shape_stop,
+                                 IFUNC &&next_index)
+            {
+                //The offset of the first element of the tile is 
+                //accumulated with Horner's scheme - after processing 
+                //dimension d it is the offset in units of the number of 
+                //elements along the dimensions following d. This avoids 
+                //divisions.
+                //
+                //number of elements of the current tile along the 
+                //dimensions which have already been processed
+                size_t inner = 1;
+                size_t offset = 0,local = 0;
+
+                for(;shape_start!=shape_stop;++shape_start)
+                    add_dimension(*shape_start,next_index(),offset,inner,
+                                  local);
+
+                return offset+local;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief add dimensions D to N-1 to the offset
+            //!
+            //! Unrolls the offset computation for an index of fixed rank 
+            //! at compile time.
+            //!
+            //! \tparam CSHAPE container type for the shape
+            //! \tparam N rank of the index
+            //! \tparam D first dimension to add
+            //! \param shape instance of CSHAPE with shape data
+            //! \param index index array
+            //! \param offset offset of the first element of the tile
+            //! \param inner number of elements of the tile
+            //! \param local offset within the tile
+            //!
+            template<
+                     typename CSHAPE,
+                     size_t N,
+                     size_t D
+                    >
+            static void add_dimensions(const CSHAPE &shape,
+                                       const std::array<size_t,N> &index,
+                                       std::integral_constant<size_t,D>,
+                                       size_t &offset,size_t &inner,
+                                       size_t &local)
+            {
+                add_dimension(shape[D],index[D],offset,inner,local);
+                add_dimensions(shape,index,
+                               std::integral_constant<size_t,D+1>(),
+                               offset,inner,local);
+            }
+
+            //-----------------------------------------------------------------
+            //! end of the recursion - all dimensions have been added
+            template<
+                     typename CSHAPE,
+                     size_t N
+                    >
+            static void add_dimensions(const CSHAPE &,
+                                       const std::array<size_t,N> &,
+                                       std::integral_constant<size_t,N>,
+                                       size_t &,size_t &,size_t &)
+            { }
+
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute the offset
+            //!
+            //! Compute the linear offset for a given shape and index. The 
+            //! functions assumes that the index and the shape container are 
+            //! of equal size.  However, this must be ensured by the calling 
+            //! function.
+            //!
+            //! \tparam CSHAPE container type for the shape data
+            //! \tparam CINDEX container type for the index data
+            //! \param shape instance of CSHAPE with shape data
+            //! \param index instance of CINDEX with index data
+            //! \return linear offset
+            //!
+            template<
+                     typename CSHAPE,
+                     typename CINDEX
+                    >
+            static size_t offset(const CSHAPE &shape,const CINDEX &index)
+            {
+                auto iter = index.begin();
+                return offset(shape.begin(),shape.end(),
+                              [&iter]() { return size_t(*iter++); });
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute the offset for an index of fixed rank
+            //!
+            //! This overload is used by the variadic element access 
+            //! operators of the array types. The rank of the index is 
+            //! known at compile time and the computation is unrolled. 
+            //!
+            //! \tparam CSHAPE container type for the shape data
+            //! \tparam N rank of the index
+            //! \param shape instance of CSHAPE with shape data
+            //! \param index index array
+            //! \return linear offset
+            //!
+            template<
+                     typename CSHAPE,
+                     size_t N
+                    >
+            static size_t offset(const CSHAPE &shape,
+                                 const std::array<size_t,N> &index)
+            {
+                size_t inner = 1;
+                size_t offset = 0,local = 0;
+
+                add_dimensions(shape,index,std::integral_constant<size_t,0>(),
+                               offset,inner,local);
+
+                return offset+local;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute offset for selection
+            //! 
+            //! Computes the linear offset for a given selection index. The
+            //! selection index is not required to have the same rank as the
+            //! original array. 
+            //! 
+            //! \tparam SELTYPE selection type
+            //! \tparam CSHAPE original shape of the array
+            //! \tparam SINDEX selection index type
+            //! \param sel reference to the selection
+            //! \param shape the original shape
+            //! \param index selection index
+            //! \return linear offset
+            //!
+            template<
+                     typename SELTYPE,
+                     typename CSHAPE,
+                     typename SINDEX
+                    >
+            static size_t offset(const SELTYPE &sel,const CSHAPE &shape,
+                                 const SINDEX &index)
+            {
+                auto sel_shape = sel.full_shape().begin();
+                auto sel_offset = sel.offset().begin();
+                auto sel_stride = sel.stride().begin();
+                auto sel_index = index.begin();
+
+                return offset(shape.begin(),shape.end(),
+                        [&]() 
+                        { 
+                            size_t i = *sel_offset++;
+                            if(*sel_shape++ != 1) 
+                                i += size_t(*sel_index++)*(*sel_stride);
+                            ++sel_stride;
+                            return i;
+                        });
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute index
+            //!
+            //! Compute the multidimensional index for a given shape and 
+            //! offset. The function assumes that the index container is of 
+            //! appropriate size (the size of the shape container) which 
+            //! must be ensured by the calling function.
+            //! 
+            //! \tparam CINDEX container type for index values
+            //! \tparam CSHAPE container type for shape values
+            //! \param shape instance of CSHAPE with shape information
+            //! \param idx instance of CINDEX for index data
+            //! \param offset linear offset 
+            //!
+            template<
+                     typename CINDEX,
+                     typename CSHAPE
+                    >
+            static void index(const CSHAPE &shape,CINDEX &idx,size_t offset)
+            {
+                size_t outer = std::accumulate(shape.begin(),shape.end(),
+                                               size_t(1),
+                                               std::multiplies<size_t>());
+                size_t inner = 1;
+
+                //first pass - determine the tile 
+                auto i = idx.begin();
+                for(auto n = shape.begin();n!=shape.end();++n,++i)
+                {
+                    outer /= *n;
+                    size_t t = offset/(TILE*inner*outer);
+                    *i = t*TILE;
+                    offset -= (*i)*inner*outer;
+                    inner *= extent(*n,*i);
+                }
+
+                //second pass - the remaining offset is the C order offset
+                //within the tile
+                auto ri = idx.rbegin();
+                auto rn = shape.rbegin();
+                for(;rn!=shape.rend();++rn,++ri)
+                {
+                    size_t h = extent(*rn,*ri);
+                    *ri += offset%h;
+                    offset /= h;
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief iterate over common runs with C order 
+            //!
+            //! Within a tile the elements along the last dimension are 
+            //! stored contiguously - as they are in a C-ordered array. This
+            //! function calls 
+            //! \code
+            //! f(c_offset,tiled_offset,length)
+            //! \endcode
+            //! for every such run of elements, where \c c_offset and 
+            //! \c tiled_offset are the offsets of the first element of the 
+            //! run in a C-ordered and a tiled array of the given shape. 
+            //! Conversions between the two layouts can be done with one
+            //! block copy per run. 
+            //!
+            //! \tparam CSHAPE container type for the shape
+            //! \tparam FUNC function type
+            //! \param shape instance of CSHAPE with shape information
+            //! \param f function called for every run
+            //!
+            template<
+                     typename CSHAPE,
+                     typename FUNC
+                    >
+            static void for_each_run(const CSHAPE &shape,FUNC &&f)
+            {
+                std::vector<size_t> s(shape.begin(),shape.end());
+                size_t rank = s.size();
+                if(rank==0) { f(size_t(0),size_t(0),size_t(1)); return; }
+                if(std::find(s.begin(),s.end(),size_t(0))!=s.end()) return;
+
+                //C strides of the shape
+                std::vector<size_t> strides(rank,1);
+                for(size_t d=rank-1;d>0;--d) strides[d-1] = strides[d]*s[d];
+
+                //index of the first element of the current row
+                std::vector<size_t> index(rank,0);
+                size_t tiled_offset = 0;
+                while(true)
+                {
+                    //process the rows of a tile
+                    std::vector<size_t> h(rank);
+                    for(size_t d=0;d<rank;++d) h[d] = extent(s[d],index[d]);
+
+                    std::vector<size_t> local(rank,0);
+                    size_t w = h[rank-1];
+                    while(true)
+                    {
+                        size_t c_offset = 0;
+                        for(size_t d=0;d<rank;++d)
+                            c_offset += (index[d]+local[d])*strides[d];
+
+                        f(c_offset,tiled_offset,w);
+                        tiled_offset += w;
+
+                        //next row within the tile
+                        size_t d = rank-1;
+                        for(;d>0;--d)
+                        {
+                            if(++local[d-1]<h[d-1]) break;
+                            local[d-1] = 0;
+                        }
+                        if(d==0) break;
+                    }
+
+                    //next tile
+                    size_t d = rank;
+                    for(;d>0;--d)
+                    {
+                        index[d-1] += TILE;
+                        if(index[d-1]<s[d-1]) break;
+                        index[d-1] = 0;
+                    }
+                    if(d==0) break;
+                }
+            }
+    };
+
+//end of namespace
+}
+}
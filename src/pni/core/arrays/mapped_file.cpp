@@ -0,0 +1,244 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <cstring>
+#include <cerrno>
+#include <sstream>
+#include <pni/core/arrays/mapped_file.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace pni{
+namespace core{
+
+#ifndef _MSC_VER
+namespace{
+    //
+    // close a file descriptor when leaving the scope - the mapping keeps 
+    // its own reference to the file
+    //
+    struct file_descriptor_guard
+    {
+        int fd;
+        ~file_descriptor_guard() { if(fd>=0) close(fd); }
+    };
+
+    //-------------------------------------------------------------------------
+    string errno_message(const string &message)
+    {
+        std::stringstream ss;
+        ss<<message<<": "<<std::strerror(errno);
+        return ss.str();
+    }
+}
+
+    //-------------------------------------------------------------------------
+    void mapped_file::map(int fd,const string &path,size_t offset,
+                          size_t size)
+    {
+        //the file offset of a mapping must be a multiple of the page size
+        size_t page_size = size_t(sysconf(_SC_PAGESIZE));
+        size_t aligned_offset = offset - offset%page_size;
+
+        _offset = offset - aligned_offset;
+        _size   = size;
+        _mapped_size = _size + _offset;
+        if(_size == 0) return;
+
+        //read-only mappings are private and thus copy-on-write - writing 
+        //to the data modifies only the pages in memory but never the file
+        int flags = _mode == map_mode::READ_WRITE ? MAP_SHARED : MAP_PRIVATE;
+
+        void *address = mmap(nullptr,_mapped_size,PROT_READ|PROT_WRITE,flags,
+                             fd,off_t(aligned_offset));
+        if(address == MAP_FAILED)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot map file ["+path+"]"));
+
+        _address = address;
+    }
+
+    //-------------------------------------------------------------------------
+    mapped_file::mapped_file(const string &path,map_mode mode,size_t offset,
+                             size_t size):
+        _address(nullptr),
+        _mapped_size(0),
+        _offset(0),
+        _size(0),
+        _mode(mode)
+    {
+        int flags = mode == map_mode::READ_WRITE ? O_RDWR : O_RDONLY;
+        file_descriptor_guard guard{open(path.c_str(),flags)};
+        if(guard.fd < 0)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot open file ["+path+"]"));
+
+        struct stat info;
+        if(fstat(guard.fd,&info) != 0)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot stat file ["+path+"]"));
+
+        size_t file_size = size_t(info.st_size);
+        if(offset > file_size || (size && size > file_size-offset))
+        {
+            std::stringstream ss;
+            ss<<"File ["<<path<<"] with "<<file_size<<" Bytes is too small "
+              <<"to map "<<size<<" Bytes at offset "<<offset<<"!";
+            throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        map(guard.fd,path,offset,size ? size : file_size-offset);
+    }
+
+    //-------------------------------------------------------------------------
+    mapped_file::mapped_file(const string &path,size_t size):
+        _address(nullptr),
+        _mapped_size(0),
+        _offset(0),
+        _size(0),
+        _mode(map_mode::READ_WRITE)
+    {
+        file_descriptor_guard guard{open(path.c_str(),O_RDWR|O_CREAT|O_TRUNC,
+                                         0644)};
+        if(guard.fd < 0)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot create file ["+path+"]"));
+
+        if(ftruncate(guard.fd,off_t(size)) != 0)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot resize file ["+path+"]"));
+
+        map(guard.fd,path,0,size);
+    }
+
+    //-------------------------------------------------------------------------
+    mapped_file::mapped_file(size_t size):
+        _address(nullptr),
+        _mapped_size(size),
+        _offset(0),
+        _size(size),
+        _mode(map_mode::READ_WRITE)
+    {
+        if(_size == 0) return;
+
+        void *address = mmap(nullptr,_mapped_size,PROT_READ|PROT_WRITE,
+                             MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+        if(address == MAP_FAILED)
+            throw memory_allocation_error(EXCEPTION_RECORD,
+                    errno_message("Cannot create anonymous mapping"));
+
+        _address = address;
+    }
+
+    //-------------------------------------------------------------------------
+    mapped_file::~mapped_file()
+    {
+        if(_address) munmap(_address,_mapped_size);
+    }
+
+    //-------------------------------------------------------------------------
+    void mapped_file::advise(map_advice advice,size_t offset,size_t size) const
+    {
+        if(offset > _size || size > _size-offset)
+            throw range_error(EXCEPTION_RECORD,
+                              "Advice range exceeds the mapping!");
+
+        if(size == 0) size = _size - offset;
+        if(size == 0) return;
+
+        int flag = MADV_NORMAL;
+        switch(advice)
+        {
+            case map_advice::SEQUENTIAL: flag = MADV_SEQUENTIAL; break;
+            case map_advice::RANDOM:     flag = MADV_RANDOM; break;
+            case map_advice::WILLNEED:   flag = MADV_WILLNEED; break;
+            case map_advice::DONTNEED:   flag = MADV_DONTNEED; break;
+            default: break;
+        }
+
+        //madvise requires a page aligned start address
+        size_t page_size = size_t(sysconf(_SC_PAGESIZE));
+        size_t begin = _offset + offset;
+        size_t aligned_begin = begin - begin%page_size;
+        if(madvise(static_cast<char*>(_address)+aligned_begin,
+                   size + (begin-aligned_begin),flag) != 0)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot pass hint to mapping"));
+    }
+
+    //-------------------------------------------------------------------------
+    void mapped_file::sync() const
+    {
+        if(!_address || _mode != map_mode::READ_WRITE) return;
+
+        if(msync(_address,_mapped_size,MS_SYNC) != 0)
+            throw file_error(EXCEPTION_RECORD,
+                             errno_message("Cannot synchronize mapping"));
+    }
+#else
+    //
+    // memory mapped files are currently only supported on POSIX systems
+    //
+    void mapped_file::map(int,const string &,size_t,size_t) {}
+
+    mapped_file::mapped_file(const string &,map_mode mode,size_t,size_t):
+        _address(nullptr),_mapped_size(0),_offset(0),_size(0),_mode(mode)
+    {
+        throw not_implemented_error(EXCEPTION_RECORD,
+                "Memory mapped files are not supported on this platform!");
+    }
+
+    mapped_file::mapped_file(const string &,size_t):
+        _address(nullptr),_mapped_size(0),_offset(0),_size(0),
+        _mode(map_mode::READ_WRITE)
+    {
+        throw not_implemented_error(EXCEPTION_RECORD,
+                "Memory mapped files are not supported on this platform!");
+    }
+
+    mapped_file::mapped_file(size_t):
+        _address(nullptr),_mapped_size(0),_offset(0),_size(0),
+        _mode(map_mode::READ_WRITE)
+    {
+        throw not_implemented_error(EXCEPTION_RECORD,
+                "Memory mapped files are not supported on this platform!");
+    }
+
+    mapped_file::~mapped_file() {}
+
+    void mapped_file::advise(map_advice,size_t,size_t) const {}
+
+    void mapped_file::sync() const {}
+#endif
+
+//end of namespace
+}
+}
@@ -0,0 +1,200 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <pni/core/types/types.hpp>
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief access mode of a file mapping
+    //!
+    //! A READ_ONLY mapping never modifies the file. Its pages are mapped 
+    //! copy-on-write so the data can still be changed in memory - a page 
+    //! is copied on the first write to it and the changes are discarded 
+    //! with the mapping.
+    //!
+    enum class map_mode { READ_ONLY,  //!< the file is never modified
+                          READ_WRITE  //!< changes are written to the file
+                        };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief access pattern hints for a file mapping
+    //!
+    //! The hints are passed to the kernel via madvise. They do not change 
+    //! the semantics of the mapping but only how pages are read ahead and 
+    //! kept in memory.
+    //!
+    enum class map_advice { NORMAL,     //!< no special treatment
+                            SEQUENTIAL, //!< aggressive read ahead
+                            RANDOM,     //!< no read ahead
+                            WILLNEED,   //!< fault in the pages now
+                            DONTNEED    //!< pages will not be used soon
+                          };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief memory mapped file
+    //!
+    //! RAII wrapper around a memory mapping. The mapping is either backed by
+    //! a file or, if constructed from a size only, by anonymous memory. 
+    //! Pages are not read when the mapping is established but fault in on 
+    //! first access. 
+    //!
+    //! Instances can neither be copied nor moved. mapped_storage owns its 
+    //! mapping via std::unique_ptr.
+    //!
+    class PNICORE_EXPORT mapped_file
+    {
+        private:
+            //! start address of the mapping (page aligned)
+            void *_address;
+            //! size of the mapping in bytes
+            size_t _mapped_size;
+            //! offset of the user data with respect to _address
+            size_t _offset;
+            //! size of the user data in bytes
+            size_t _size;
+            //! access mode
+            map_mode _mode;
+
+            //! establish the mapping for an open file
+            void map(int fd,const string &path,size_t offset,size_t size);
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief map an existing file
+            //!
+            //! Maps size bytes of an existing file starting at offset. If 
+            //! size is 0 everything from offset to the end of the file 
+            //! is mapped. The offset does not have to be page aligned which 
+            //! allows skipping a header in front of the data.
+            //!
+            //! \throws file_error if the file cannot be opened or mapped
+            //! \throws size_mismatch_error if the file is too small
+            //! \param path file system path to the file
+            //! \param mode access mode
+            //! \param offset offset of the data in bytes
+            //! \param size number of bytes to map
+            //!
+            explicit mapped_file(const string &path,
+                                 map_mode mode,
+                                 size_t offset = 0,
+                                 size_t size = 0);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create a file and map it
+            //!
+            //! Creates a new file of size bytes (an existing file is 
+            //! truncated) and maps it read-write. The file is sparse and 
+            //! reads as zeros until written.
+            //!
+            //! \throws file_error if the file cannot be created or mapped
+            //! \param path file system path to the new file
+            //! \param size size of the file in bytes
+            //!
+            explicit mapped_file(const string &path,size_t size);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief anonymous mapping
+            //!
+            //! Creates a zero initialized mapping of size bytes which is 
+            //! not backed by a file. 
+            //!
+            //! \throws memory_allocation_error if the mapping fails
+            //! \param size size of the mapping in bytes
+            //!
+            explicit mapped_file(size_t size);
+
+            //-----------------------------------------------------------------
+            //! no copy construction
+            mapped_file(const mapped_file &) = delete;
+
+            //-----------------------------------------------------------------
+            //! no copy assignment
+            mapped_file &operator=(const mapped_file &) = delete;
+
+            //-----------------------------------------------------------------
+            //! destructor - removes the mapping
+            ~mapped_file();
+
+            //-----------------------------------------------------------------
+            //! pointer to the mapped data
+            void *data() const noexcept 
+            { 
+                return static_cast<char*>(_address)+_offset; 
+            }
+
+            //-----------------------------------------------------------------
+            //! size of the mapped data in bytes
+            size_t size() const noexcept { return _size; }
+
+            //-----------------------------------------------------------------
+            //! access mode of the mapping
+            map_mode mode() const noexcept { return _mode; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief pass access pattern hint
+            //!
+            //! Passes a hint for the byte range [offset,offset+size) to the
+            //! kernel. If size is 0 the hint applies to everything from 
+            //! offset to the end of the mapping. On systems without madvise
+            //! this function does nothing. 
+            //!
+            //! For READ_ONLY and anonymous mappings DONTNEED discards all 
+            //! changes made to the pages in the range. 
+            //!
+            //! \throws range_error if the range exceeds the mapping
+            //! \throws file_error if the kernel rejects the hint
+            //! \param advice the access pattern hint
+            //! \param offset start of the range in bytes
+            //! \param size size of the range in bytes
+            //!
+            void advise(map_advice advice,size_t offset=0,size_t size=0) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write changes to disk
+            //!
+            //! Blocks until all modified pages are written to the file. 
+            //! Does nothing for read-only and anonymous mappings.
+            //!
+            //! \throws file_error if the pages cannot be written
+            //!
+            void sync() const;
+    };
+
+//end of namespace
+}
+}
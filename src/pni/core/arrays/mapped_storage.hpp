@@ -0,0 +1,256 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <memory>
+#include <cstring>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/arrays/mapped_file.hpp>
+#include <pni/core/arrays/pointer_range_storage.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief memory mapped storage
+    //!
+    //! A storage type for mdarray whose elements live in a memory mapped 
+    //! file. Nothing is read when the storage is created - pages fault in 
+    //! on first access and are managed by the kernels page cache. This 
+    //! allows processing files much larger than the available memory 
+    //! without reading them into a std::vector first.
+    /*!
+    \code
+    typedef mdarray<mapped_storage<uint16>> array_type;
+    typedef array_factory<array_type> factory;
+
+    //map an existing file read-only
+    auto frames = factory::map("scan.raw",shape_t{1000,2048,2048});
+    frames.storage().advise(map_advice::SEQUENTIAL);
+
+    //create a new file of appropriate size
+    auto result = factory::create_mapped("result.raw",shape_t{2048,2048});
+    \endcode
+    !*/
+    //!
+    //! The storage owns its mapping. Like any other storage it has value 
+    //! semantics: a copy is an anonymous storage holding a copy of the 
+    //! data, moving transfers the mapping. Writing to the elements of a 
+    //! read-only mapping only changes the pages in memory (copy-on-write), 
+    //! the file remains untouched.
+    //!
+    //! A storage constructed from a number of elements only is backed by 
+    //! anonymous memory. This is what container_utils uses and makes 
+    //! temporary arrays of this type possible.
+    //!
+    //! \tparam T element type (must be trivially copyable)
+    //!
+    template<typename T> class mapped_storage : 
+        public pointer_range_storage<T>
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Only trivially copyable types can be memory mapped!");
+        private:
+            //! base class type
+            typedef pointer_range_storage<T> base_type;
+            //! the mapping
+            std::unique_ptr<mapped_file> _file;
+
+            //-----------------------------------------------------------------
+            //! construct from a mapping
+            explicit mapped_storage(mapped_file *file):
+                base_type(static_cast<T*>(file->data()),file->size()/sizeof(T)),
+                _file(file)
+            {}
+        public:
+            //=================constructors====================================
+            //! default constructor - empty storage
+            mapped_storage():base_type(),_file() {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief anonymous storage
+            //!
+            //! Creates a zero initialized storage for n elements which is 
+            //! not backed by a file. 
+            //!
+            //! \throws memory_allocation_error if the mapping fails
+            //! \param n number of elements
+            //!
+            explicit mapped_storage(size_t n):
+                mapped_storage(new mapped_file(n*sizeof(T)))
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy constructor
+            //!
+            //! Copies the data to a new anonymous mapping. 
+            //!
+            //! \throws memory_allocation_error if the mapping fails
+            //! \param s the original storage
+            //!
+            mapped_storage(const mapped_storage<T> &s):
+                mapped_storage(s.size())
+            {
+                if(s.size()) 
+                    std::memcpy(this->data(),s.data(),s.size()*sizeof(T));
+            }
+
+            //-----------------------------------------------------------------
+            //! move constructor - takes the mapping of s
+            mapped_storage(mapped_storage<T> &&s) noexcept:
+                base_type(s),
+                _file(std::move(s._file))
+            {
+                s.clear_range();
+            }
+
+            //=================assignment operators============================
+            //! copy assignment - copies the data to a new anonymous mapping
+            mapped_storage<T> &operator=(const mapped_storage<T> &s)
+            {
+                if(this == &s) return *this;
+
+                mapped_storage<T> temp(s);
+                *this = std::move(temp);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! move assignment - takes the mapping of s
+            mapped_storage<T> &operator=(mapped_storage<T> &&s) noexcept
+            {
+                if(this == &s) return *this;
+
+                base_type::operator=(s);
+                _file = std::move(s._file);
+                s.clear_range();
+                return *this;
+            }
+
+            //=================static factory functions========================
+            //!
+            //! \brief map an existing file
+            //!
+            //! Maps n elements stored in a file starting at offset bytes 
+            //! from the beginning of the file. 
+            //!
+            //! \throws file_error if the file cannot be opened or mapped
+            //! \throws size_mismatch_error if the file is too small
+            //! \param path path to the file
+            //! \param n number of elements
+            //! \param mode access mode
+            //! \param offset offset of the first element in bytes
+            //! \return storage instance
+            //!
+            static mapped_storage map(const string &path,size_t n,
+                                      map_mode mode = map_mode::READ_ONLY,
+                                      size_t offset = 0)
+            {
+                if(n==0) return mapped_storage();
+
+                return mapped_storage(new mapped_file(path,mode,offset,
+                                                      n*sizeof(T)));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create a new file 
+            //!
+            //! Creates a new file (an existing file will be truncated) for n
+            //! elements and maps it read-write. All elements are initially 
+            //! zero.
+            //! 
+            //! \throws file_error if the file cannot be created or mapped
+            //! \param path path to the new file
+            //! \param n number of elements
+            //! \return storage instance
+            //!
+            static mapped_storage create(const string &path,size_t n)
+            {
+                return mapped_storage(new mapped_file(path,n*sizeof(T)));
+            }
+
+            //=================public methods==================================
+            //! access mode of the mapping
+            map_mode mode() const noexcept 
+            { 
+                return _file ? _file->mode() : map_mode::READ_WRITE;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief pass access pattern hint
+            //!
+            //! Passes an access pattern hint for the elements 
+            //! [offset,offset+n) to the kernel. If n is 0 the hint applies 
+            //! to all elements from offset to the end.
+            //!
+            //! \throws range_error if the range exceeds the storage
+            //! \throws file_error if the kernel rejects the hint
+            //! \param advice the access pattern hint
+            //! \param offset index of the first element
+            //! \param n number of elements 
+            //!
+            void advise(map_advice advice,size_t offset=0,size_t n=0) const
+            {
+                if(_file) _file->advise(advice,offset*sizeof(T),n*sizeof(T));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write changes to disk
+            //!
+            //! \throws file_error if the data cannot be written
+            //!
+            void sync() const
+            {
+                if(_file) _file->sync();
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief container trait for mapped storage
+    //!
+    template<typename T> struct container_trait<mapped_storage<T>>
+    {
+        //! random access
+        static const bool is_random_access = true;
+        //! iterable
+        static const bool is_iterable   = true;
+        //! data is contiguous
+        static const bool is_contiguous = true;
+        //! storage is one dimensional
+        static const bool is_multidim   = false;
+    };
+
+//end of namespace
+}
+}
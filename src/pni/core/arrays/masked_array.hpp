@@ -0,0 +1,763 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+#include <pni/core/algorithms/math/parallel_chunks.hpp>
+#include <pni/core/algorithms/math/simd_mask.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief mask array trait
+    //!
+    //! True for containers which can select the elements of an array in 
+    //! the masked access of mdarray and array_view. These are 
+    //! multidimensional containers with bool_t, bool or uint8 elements. 
+    //! The latter includes bitmask_array. Other arrays (for instance float64
+    //! arrays) are not accepted as masks.
+    //!
+    //! \tparam MTYPE mask type
+    //! \tparam MULTIDIM true if MTYPE is a multidimensional container
+    //!
+    template<
+             typename MTYPE,
+             bool MULTIDIM = container_trait<MTYPE>::is_multidim
+            >
+    struct is_mask_array
+    {
+        //! not a multidimensional container
+        static const bool value = false;
+    };
+
+    //! \cond no_doc
+    template<typename MTYPE> struct is_mask_array<MTYPE,true>
+    {
+        typedef typename MTYPE::value_type value_type;
+        static const bool value = std::is_same<value_type,bool_t>::value ||
+                                  std::is_same<value_type,bool>::value ||
+                                  std::is_same<value_type,uint8>::value;
+    };
+    //! \endcond
+
+    //-------------------------------------------------------------------------
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief mask kernels
+    //!
+    //! Element access used by the mask algorithms for a chunk [b,e) of an
+    //! array. This default version uses the [] operators of the containers.
+    //!
+    //! \tparam USE_DATA true if the data pointers of the containers can be 
+    //!         used
+    //!
+    template<bool USE_DATA> struct mask_kernels
+    {
+        //! number of selected elements
+        template<typename MTYPE>
+        static size_t count(const MTYPE &m,size_t b,size_t e)
+        {
+            size_t k = 0;
+            for(size_t i=b;i<e;++i) if(m[i]) ++k;
+            return k;
+        }
+
+        //! assign a value to the selected elements
+        template<
+                 typename ATYPE,
+                 typename MTYPE,
+                 typename T
+                >
+        static void fill(ATYPE &a,const MTYPE &m,const T &v,size_t b,size_t e)
+        {
+            for(size_t i=b;i<e;++i) if(m[i]) a[i] = v;
+        }
+
+        //! copy the selected elements to dest
+        template<
+                 typename ATYPE,
+                 typename MTYPE,
+                 typename T
+                >
+        static void compress(const ATYPE &a,const MTYPE &m,size_t b,size_t e,
+                             T *dest)
+        {
+            for(size_t i=b;i<e;++i) if(m[i]) *dest++ = a[i];
+        }
+
+        //! assign elements from v starting at k to the selected elements
+        template<
+                 typename VTYPE,
+                 typename MTYPE,
+                 typename ATYPE
+                >
+        static void expand(const VTYPE &v,size_t k,const MTYPE &m,ATYPE &a,
+                           size_t b,size_t e)
+        {
+            for(size_t i=b;i<e;++i) if(m[i]) a[i] = v[k++];
+        }
+
+        //! reduce the selected elements
+        template<
+                 typename ATYPE,
+                 typename MTYPE,
+                 typename RTYPE,
+                 typename OP
+                >
+        static RTYPE reduce(const ATYPE &a,const MTYPE &m,size_t b,size_t e,
+                            RTYPE r,OP op)
+        {
+            for(size_t i=b;i<e;++i) if(m[i]) r = op(r,a[i]);
+            return r;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief mask kernels for contiguous data
+    //!
+    //! Works directly on the data pointers of the containers and uses the
+    //! SIMD compress and expand kernels (see simd_mask_kernel).
+    //!
+    template<> struct mask_kernels<true>
+    {
+        //! number of selected elements
+        template<typename MTYPE>
+        static size_t count(const MTYPE &m,size_t b,size_t e)
+        {
+            return simd_mask_count(m.data()+b,e-b);
+        }
+
+        //! assign a value to the selected elements
+        template<
+                 typename ATYPE,
+                 typename MTYPE,
+                 typename T
+                >
+        static void fill(ATYPE &a,const MTYPE &m,const T &v,size_t b,size_t e)
+        {
+            auto p = a.data();
+            auto q = m.data();
+            for(size_t i=b;i<e;++i) if(q[i]) p[i] = v;
+        }
+
+        //! copy the selected elements to dest
+        template<
+                 typename ATYPE,
+                 typename MTYPE,
+                 typename T
+                >
+        static void compress(const ATYPE &a,const MTYPE &m,size_t b,size_t e,
+                             T *dest)
+        {
+            simd_compress(a.data()+b,m.data()+b,e-b,dest);
+        }
+
+        //! assign elements from v starting at k to the selected elements
+        template<
+                 typename VTYPE,
+                 typename MTYPE,
+                 typename ATYPE
+                >
+        static void expand(const VTYPE &v,size_t k,const MTYPE &m,ATYPE &a,
+                           size_t b,size_t e)
+        {
+            simd_expand(v.data()+k,m.data()+b,e-b,a.data()+b);
+        }
+
+        //! reduce the selected elements
+        template<
+                 typename ATYPE,
+                 typename MTYPE,
+                 typename RTYPE,
+                 typename OP
+                >
+        static RTYPE reduce(const ATYPE &a,const MTYPE &m,size_t b,size_t e,
+                            RTYPE r,OP op)
+        {
+            auto p = a.data();
+            auto q = m.data();
+            for(size_t i=b;i<e;++i) if(q[i]) r = op(r,p[i]);
+            return r;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief select the mask kernels
+    //!
+    //! The pointer based kernels can be used if the array and the mask
+    //! provide their data in memory and the mask is a byte mask (see 
+    //! is_byte_mask). 
+    //!
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    struct mask_kernel_trait
+    {
+        //! true if the pointer based kernels may be used
+        static const bool value = 
+            contiguous_data<ATYPE>::value && contiguous_data<MTYPE>::value &&
+            is_byte_mask<typename MTYPE::value_type>::value;
+
+        //! true if the pointer based kernels can be used for the instances
+        static bool use_data(const ATYPE &a,const MTYPE &m)
+        {
+            return value && contiguous_data<ATYPE>::is_contiguous(a) &&
+                            contiguous_data<MTYPE>::is_contiguous(m);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //! 
+    //! \ingroup mdim_array_internal_classes
+    //! \brief number of elements selected per chunk
+    //!
+    //! Returns the offset of the first selected element of each chunk among
+    //! all selected elements. The last entry is the total number of 
+    //! selected elements. 
+    //! 
+    template<
+             typename MTYPE,
+             typename KERNEL
+            >
+    std::vector<size_t> mask_offsets(const MTYPE &m,
+                                     const std::vector<size_t> &bounds,KERNEL)
+    {
+        std::vector<size_t> offsets(bounds.size(),0);
+        parallel_for_each_chunk(bounds,
+                [&m,&offsets](size_t c,size_t b,size_t e)
+                {
+                    offsets[c+1] = KERNEL::count(m,b,e);
+                });
+
+        for(size_t c=1;c<offsets.size();++c) offsets[c] += offsets[c-1];
+        return offsets;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief number of selected elements
+    //!
+    //! Returns the number of non-zero elements of a mask. Large masks are 
+    //! processed in parallel.
+    //!
+    //! \tparam MTYPE mask type
+    //! \param m reference to the mask
+    //! \return number of selected elements
+    //! 
+    template<typename MTYPE> size_t mask_count(const MTYPE &m)
+    {
+        typedef mask_kernel_trait<MTYPE,MTYPE> trait_type;
+
+        if(trait_type::use_data(m,m))
+            return parallel_reduce(m,size_t(0),[&m](size_t b,size_t e)
+                    { return mask_kernels<trait_type::value>::count(m,b,e); },
+                    std::plus<size_t>());
+        else
+            return parallel_reduce(m,size_t(0),[&m](size_t b,size_t e)
+                    { return mask_kernels<false>::count(m,b,e); },
+                    std::plus<size_t>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief masked fill implementation
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE,
+             typename T,
+             typename KERNEL
+            >
+    void masked_fill(ATYPE &a,const MTYPE &m,const T &v,KERNEL)
+    {
+        parallel_for_chunks(a,[&a,&m,&v](size_t b,size_t e)
+        {
+            KERNEL::fill(a,m,v,b,e);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief assign a value to the selected elements
+    //!
+    //! Sets all elements a[i] with m[i] true to v. This is what 
+    //! \c a[m]=v does.
+    /*!
+    \code
+    auto frame = ...;
+    auto bad_pixels = dynamic_array<bool_t>::create(frame.shape<shape_t>());
+    ...
+    masked_fill(frame,bad_pixels,0);
+    \endcode
+    !*/
+    //!
+    //! The mask is applied to the linear index of the array. It usually has
+    //! the same shape as the array. 
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \param v value to assign
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    void masked_fill(ATYPE &a,const MTYPE &m,
+                     const typename ATYPE::value_type &v)
+    {
+        typedef mask_kernel_trait<ATYPE,MTYPE> trait_type;
+        check_equal_size(a,m,EXCEPTION_RECORD);
+
+        if(trait_type::use_data(a,m))
+            masked_fill(a,m,v,mask_kernels<trait_type::value>());
+        else
+            masked_fill(a,m,v,mask_kernels<false>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief masked assignment implementation
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE,
+             typename VTYPE,
+             typename KERNEL
+            >
+    void masked_assign(ATYPE &a,const MTYPE &m,const VTYPE &values,KERNEL)
+    {
+        auto bounds = parallel_chunks(a);
+        auto offsets = mask_offsets(m,bounds,KERNEL());
+
+        if(offsets.back()!=values.size())
+        {
+            std::stringstream ss;
+            ss<<"Mask selects "<<offsets.back()<<" elements but ";
+            ss<<values.size()<<" values were provided!";
+            throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        parallel_for_each_chunk(bounds,
+                [&a,&m,&values,&offsets](size_t c,size_t b,size_t e)
+                {
+                    KERNEL::expand(values,offsets[c],m,a,b,e);
+                });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief assign values to the selected elements
+    //!
+    //! Assigns the elements of values in order to the elements of a 
+    //! selected by m. This is what \c a[m]=values does. The number of values
+    //! must be equal to the number of selected elements (see mask_count()).
+    //! Use this together with compress() to modify only the selected 
+    //! elements.
+    /*!
+    \code
+    auto selected = compress(frame,mask);
+    ...
+    masked_assign(frame,mask,selected);
+    \endcode
+    !*/
+    //!
+    //! The selected elements are counted in parallel first. Then each 
+    //! thread expands its part of the values to the array.
+    //!
+    //! \throws size_mismatch_error if array and mask have different size or 
+    //! the number of values does not match the number of selected elements
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \tparam VTYPE container type for the values
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \param values the values to assign
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE,
+             typename VTYPE
+            >
+    void masked_assign(ATYPE &a,const MTYPE &m,const VTYPE &values)
+    {
+        typedef mask_kernel_trait<ATYPE,MTYPE> trait_type;
+        typedef std::integral_constant<bool,
+                    trait_type::value && contiguous_data<VTYPE>::value &&
+                    std::is_same<typename ATYPE::value_type,
+                                 typename VTYPE::value_type>::value> use_data;
+
+        check_equal_size(a,m,EXCEPTION_RECORD);
+
+        if(trait_type::use_data(a,m) && 
+           contiguous_data<VTYPE>::is_contiguous(values))
+            masked_assign(a,m,values,mask_kernels<use_data::value>());
+        else
+            masked_assign(a,m,values,mask_kernels<false>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief masked reduction
+    //!
+    //! Each chunk of the array is reduced in parallel by applying 
+    //! r=op(r,a[i]) to all selected elements starting with init. The 
+    //! results of the chunks are combined with combine.
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \tparam RTYPE result type
+    //! \tparam OP element operation
+    //! \tparam COMBINE operation combining two results
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \param init neutral element of the reduction
+    //! \param op element operation
+    //! \param combine operation combining the results of two chunks
+    //! \return result of the reduction
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE,
+             typename RTYPE,
+             typename OP,
+             typename COMBINE
+            >
+    RTYPE masked_reduce(const ATYPE &a,const MTYPE &m,RTYPE init,OP op,
+                        COMBINE combine)
+    {
+        typedef mask_kernel_trait<ATYPE,MTYPE> trait_type;
+        typedef mask_kernels<trait_type::value> data_kernel;
+        typedef mask_kernels<false> element_kernel;
+
+        check_equal_size(a,m,EXCEPTION_RECORD);
+
+        if(trait_type::use_data(a,m))
+            return parallel_reduce(a,init,
+                    [&a,&m,&init,&op](size_t b,size_t e)
+                    { return data_kernel::reduce(a,m,b,e,init,op); },
+                    combine);
+        else
+            return parallel_reduce(a,init,
+                    [&a,&m,&init,&op](size_t b,size_t e)
+                    { return element_kernel::reduce(a,m,b,e,init,op); },
+                    combine);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief sum of the selected elements
+    //!
+    //! The sum is accumulated with the element type of the array. Use 
+    //! masked_mean() to avoid overflows for small integer types.
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \return sum of all selected elements
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    typename ATYPE::value_type masked_sum(const ATYPE &a,const MTYPE &m)
+    {
+        typedef typename ATYPE::value_type value_type;
+
+        return masked_reduce(a,m,value_type(0),std::plus<value_type>(),
+                             std::plus<value_type>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief mean of the selected elements
+    //!
+    //! The elements are accumulated in double precision. 
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \throws value_error if no element is selected
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \return mean value of all selected elements
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    float64 masked_mean(const ATYPE &a,const MTYPE &m)
+    {
+        typedef std::pair<size_t,float64> result_type;
+        typedef typename ATYPE::value_type value_type;
+
+        result_type r = masked_reduce(a,m,result_type(0,0.),
+                [](const result_type &x,const value_type &v)
+                { return result_type(x.first+1,x.second+v); },
+                [](const result_type &x,const result_type &y)
+                { return result_type(x.first+y.first,x.second+y.second); });
+
+        if(!r.first) 
+            throw value_error(EXCEPTION_RECORD,"Mask selects no elements!");
+
+        return r.second/r.first;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief masked extremum
+    //!
+    //! Returns the smallest of the selected elements with respect to comp.
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE,
+             typename COMP
+            >
+    typename ATYPE::value_type masked_extremum(const ATYPE &a,const MTYPE &m,
+                                               COMP comp)
+    {
+        typedef typename ATYPE::value_type value_type;
+        typedef std::pair<bool,value_type> result_type;
+
+        result_type r = masked_reduce(a,m,result_type(false,value_type()),
+                [&comp](const result_type &x,const value_type &v)
+                {
+                    return (!x.first || comp(v,x.second)) ? 
+                           result_type(true,v) : x;
+                },
+                [&comp](const result_type &x,const result_type &y)
+                {
+                    if(!x.first) return y;
+                    if(!y.first) return x;
+                    return comp(y.second,x.second) ? y : x;
+                });
+
+        if(!r.first) 
+            throw value_error(EXCEPTION_RECORD,"Mask selects no elements!");
+
+        return r.second;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief minimum of the selected elements
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \throws value_error if no element is selected
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \return smallest selected element
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    typename ATYPE::value_type masked_min(const ATYPE &a,const MTYPE &m)
+    {
+        return masked_extremum(a,m,std::less<typename ATYPE::value_type>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief maximum of the selected elements
+    //!
+    //! \throws size_mismatch_error if array and mask have different size
+    //! \throws value_error if no element is selected
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //! \param a reference to the array
+    //! \param m reference to the mask
+    //! \return largest selected element
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    typename ATYPE::value_type masked_max(const ATYPE &a,const MTYPE &m)
+    {
+        return masked_extremum(a,m,
+                               std::greater<typename ATYPE::value_type>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief masked array
+    //!
+    //! A masked array is returned by the [] operator of mdarray and 
+    //! array_view if called with a mask (a multidimensional container of 
+    //! bool_t or uint8 elements). It refers to the elements of the array 
+    //! selected by the mask and allows assignment to these elements. 
+    /*!
+    \code
+    auto frame = ...;
+    auto mask  = ...;
+
+    frame[mask] = 0;      //set all masked pixels to 0
+    frame[mask] = values; //values.size() must be equal to frame[mask].size()
+    \endcode
+    !*/
+    //!
+    //! A masked array holds references to the array and the mask. It must 
+    //! not be used after one of them has been destroyed. 
+    //!
+    //! \tparam ATYPE array type
+    //! \tparam MTYPE mask type
+    //!
+    template<
+             typename ATYPE,
+             typename MTYPE
+            >
+    class masked_array
+    {
+        public:
+            //! array type
+            typedef ATYPE array_type;
+            //! mask type
+            typedef MTYPE mask_type;
+            //! element type
+            typedef typename ATYPE::value_type value_type;
+        private:
+            //! reference to the array
+            ATYPE &_array;
+            //! reference to the mask
+            const MTYPE &_mask;
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \throws size_mismatch_error if array and mask have different
+            //! size
+            //! \param a reference to the array
+            //! \param m reference to the mask
+            //!
+            masked_array(ATYPE &a,const MTYPE &m):
+                _array(a),
+                _mask(m)
+            {
+                check_equal_size(a,m,EXCEPTION_RECORD);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief assign a value 
+            //!
+            //! Assigns v to all selected elements (see masked_fill()).
+            //!
+            //! \param v value to assign
+            //! \return reference to the masked array
+            //!
+            masked_array &operator=(const value_type &v)
+            {
+                masked_fill(_array,_mask,v);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief assign values 
+            //!
+            //! Assigns the values in order to the selected elements (see
+            //! masked_assign()).
+            //!
+            //! \throws size_mismatch_error if the number of values does not
+            //! match the number of selected elements
+            //! \tparam VTYPE container type
+            //! \param values container with the values to assign
+            //! \return reference to the masked array
+            //!
+            template<
+                     typename VTYPE,
+                     typename = typename std::enable_if<
+                         !std::is_convertible<VTYPE,value_type>::value
+                         >::type
+                    >
+            masked_array &operator=(const VTYPE &values)
+            {
+                masked_assign(_array,_mask,values);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of selected elements
+            //!
+            size_t size() const { return mask_count(_mask); }
+
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief reference to the array
+            //!
+            ATYPE &array() { return _array; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reference to the mask
+            //!
+            const MTYPE &mask() const { return _mask; }
+    };
+
+//end of namespace
+}
+}
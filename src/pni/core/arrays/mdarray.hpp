@@ -33,6 +33,7 @@
 #include<cstdarg>
 #include<cstdio>
 #include<memory>
+#include<numeric>
 
 
 #include <pni/core/error/exception_utils.hpp>
@@ -40,6 +41,7 @@
 #include <pni/core/utilities.hpp>
 #include <pni/core/arrays/slice.hpp>
 #include <pni/core/arrays/array_view.hpp>
+#include <pni/core/arrays/masked_array.hpp>
 #include <pni/core/arrays/array_factory.hpp>
 #include <pni/core/arrays/array_view_utils.hpp>
 #include <pni/core/arrays/index_map/index_maps.hpp>
@@ -103,6 +105,59 @@ namespace core {
             IMAP _imap;  
             //! instance of STORAGE
             STORAGE _data;  
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of elements of an entry
+            //!
+            //! Returns the number of elements of a single entry along the 
+            //! first dimension. 
+            //!
+            size_t entry_size() const
+            {
+                if(!_imap.rank()) return 0;
+
+                auto first = std::next(_imap.begin());
+                return std::accumulate(first,_imap.end(),size_t(1),
+                                       std::multiplies<size_t>());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check if the array can grow
+            //!
+            //! The first dimension can only grow if it varies slowest.
+            //!
+            //! \throws shape_mismatch_error if the array has rank 0
+            //!
+            void check_growable() const
+            {
+                static_assert(map_type::implementation_type::c_order &&
+                              map_type::implementation_type::strided,
+                              "Only arrays in C order can grow!");
+
+                if(!_imap.rank())
+                    throw shape_mismatch_error(EXCEPTION_RECORD,
+                            "An array of rank 0 cannot grow!");
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief geometric growth
+            //!
+            //! Ensures that memory for n entries is allocated. If 
+            //! reallocation is necessary the capacity is at least doubled.
+            //!
+            //! \param n number of entries 
+            //!
+            void grow(size_t n)
+            {
+                size_t c = capacity();
+                if(n<=c) return;
+
+                _data.reserve(std::max(n,2*c)*entry_size());
+            }
+
         public:
 
             //=================constructors and destructor=====================
@@ -143,7 +198,8 @@ namespace core {
             //!
             //! This constructor creates a new array from an array view 
             //! instance.  The resulting array object has the same shape as 
-            //! the view. 
+            //! the view. The data is copied along the segments of the view
+            //! (see copy_data()).
             //! 
             //! \tparam ATYPE storage type of the view
             //! \param view reference to the view
@@ -153,7 +209,7 @@ namespace core {
                 _imap(map_utils<map_type>::create(view.template shape<shape_t>())),
                 _data(container_utils<storage_type>::create(view.size()))
             {
-                std::copy(view.begin(),view.end(),_data.begin());
+                copy_data(view,*this);
             }
 
 
@@ -173,9 +229,9 @@ namespace core {
                 _imap(map_utils<map_type>::create(array.template shape<shape_t>())),
                 _data(container_utils<storage_type>::create(array.size()))
             {
-                //copy data
-                for(size_t i=0;i<array.size();++i) (*this)[i] = array[i];
-                //std::copy(array.begin(),array.end(),this->begin());
+                //copy data - expressions are evaluated in SIMD packets if
+                //possible
+                evaluate_expression(*this,array);
             }
 
             //====================static methods to create arrays==============
@@ -241,8 +297,7 @@ namespace core {
             {
                 if((void*)this == (void*)&array) return *this;
     
-                size_t s = array.size();
-                for(size_t i=0;i<s;++i) (*this)[i] = array[i];
+                evaluate_expression(*this,array);
 
                 return *this;
             }
@@ -360,6 +415,36 @@ namespace core {
 #endif
             }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief masked access
+            //!
+            //! Returns a masked_array referring to the elements selected by
+            //! mask. The mask is a multidimensional container of bool_t or 
+            //! uint8 elements or a bitmask_array with the same size as the 
+            //! array. Other arrays do not compile as masks (see is_mask_array).
+            /*!
+            \code
+            frame[bad_pixels] = 0;
+            \endcode
+            !*/
+            //!
+            //! \throws size_mismatch_error if mask and array have different
+            //! size
+            //! \tparam MTYPE mask type
+            //! \param mask reference to the mask
+            //! \return masked array 
+            //!
+            template<
+                     typename MTYPE,
+                     typename = typename std::enable_if<
+                         is_mask_array<MTYPE>::value>::type
+                    >
+            masked_array<array_type,MTYPE> operator[](const MTYPE &mask)
+            {
+                return masked_array<array_type,MTYPE>(*this,mask);
+            }
+
             //-----------------------------------------------------------------
             //! 
             //! \brief get value at i
@@ -600,6 +685,37 @@ namespace core {
                 return _data.data();
             }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get storage
+            //!
+            //! Return a const reference to the storage object of the array. 
+            //! For arrays representing an expression this is the expression 
+            //! template instance.
+            //!
+            //! \return reference to the storage
+            //!
+            const storage_type &storage() const
+            {
+                return _data;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get storage
+            //!
+            //! Return a reference to the storage object of the array. This 
+            //! gives algorithms access to the internals of a storage (like 
+            //! the chunks of chunked_storage). The size of the storage must 
+            //! not be changed.
+            //!
+            //! \return reference to the storage
+            //!
+            storage_type &storage()
+            {
+                return _data;
+            }
+
             //-----------------------------------------------------------------
             //!
             //! \brief reference to first element
@@ -706,6 +822,125 @@ namespace core {
             //! 
             const_reverse_iterator rend() const { return _data.rend(); }
 
+
+            //=============growing the array along the first dimension=========
+            //!
+            //! \brief capacity along the first dimension
+            //!
+            //! Returns the number of entries along the first dimension 
+            //! (frames in case of an image stack) for which memory is 
+            //! allocated. Up to this number, append() and resize() do not
+            //! reallocate the data.
+            //!
+            //! \return number of entries along the first dimension which fit
+            //!         into the allocated memory
+            //!
+            size_t capacity() const
+            {
+                size_t n = entry_size();
+                return n ? _data.capacity()/n : 0;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reserve memory along the first dimension
+            //!
+            //! Allocates memory for at least n entries along the first 
+            //! dimension. The shape of the array does not change. 
+            //!
+            //! The data is reallocated if n exceeds capacity(). In this case
+            //! all pointers obtained from data() and all iterators of the 
+            //! array are invalidated. Views remain valid.
+            //!
+            //! \param n number of entries along the first dimension
+            //!
+            void reserve(size_t n)
+            {
+                check_growable();
+                _data.reserve(n*entry_size());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief change the size of the first dimension
+            //!
+            //! Changes the number of entries along the first dimension to n.
+            //! New elements are value initialized. If n exceeds capacity()
+            //! the data is reallocated with geometric growth (see append()).
+            //!
+            //! Pointers obtained from data() and iterators of the array are 
+            //! invalidated when the data is reallocated. Views created before
+            //! keep their shape. They remain valid as long as they do not 
+            //! refer to entries beyond the new size.
+            //!
+            //! \throws shape_mismatch_error if the array has rank 0
+            //! \param n new number of entries along the first dimension
+            //!
+            void resize(size_t n)
+            {
+                check_growable();
+                grow(n);
+                _data.resize(n*entry_size(),value_type());
+                *_imap.begin() = n;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief append an entry along the first dimension
+            //!
+            //! Appends an entry (for instance a frame to an image stack) to 
+            //! the array by increasing the first dimension by one. The 
+            //! capacity grows geometrically - whenever the entry does not fit
+            //! into the allocated memory the capacity is doubled. Thus, 
+            //! appending N entries costs O(N) copies in total. 
+            /*!
+            \code
+            auto stack = dynamic_array<uint16>::create(shape_t{0,2048,2048});
+            stack.reserve(100);
+
+            while(scan_running())
+            {
+                auto frame = read_frame();
+                stack.append(frame);
+            }
+            auto last = stack(stack.shape<shape_t>()[0]-1,
+                              slice(0,2048),slice(0,2048));
+            \endcode
+            !*/
+            //!
+            //! The array references the frame data in C order with the first
+            //! dimension varying slowest. Thus, appending does not change 
+            //! the linear index of existing elements. 
+            //!
+            //! \li views onto the array remain valid and keep their shape
+            //! \li pointers obtained from data() (also those of views) and 
+            //!     iterators are invalidated if capacity() changes
+            //!
+            //! \throws size_mismatch_error if the size of entry does not 
+            //! match the size of an entry of the array
+            //! \throws shape_mismatch_error if the array has rank 0
+            //! \tparam ATYPE array type of the entry
+            //! \param entry the data to append 
+            //!
+            template<typename ATYPE>
+            void append(const ATYPE &entry)
+            {
+                check_growable();
+                size_t n = entry_size();
+                if(entry.size()!=n)
+                {
+                    std::stringstream ss;
+                    ss<<"Size of the entry ("<<entry.size()<<") does not ";
+                    ss<<"match the size of an array entry ("<<n<<")!";
+                    throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+                }
+
+                size_t entries = *_imap.begin();
+                grow(entries+1);
+                _data.insert(_data.end(),entry.begin(),entry.end());
+                *_imap.begin() = entries+1;
+            }
+
             //==========implementation of unary arithmetic operators===========
             //!
             //! \brief unary addition of a scalar
@@ -744,6 +979,8 @@ namespace core {
             template<typename ATYPE> 
             array_type &operator+=(const ATYPE &v) 
             { 
+                static_assert(is_same_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::add(*this,v); 
                 return *this;
             }
@@ -786,6 +1023,8 @@ namespace core {
             template<typename ATYPE> 
             array_type &operator-=(const ATYPE &v) 
             { 
+                static_assert(is_same_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::sub(*this,v); 
                 return *this; 
             }
@@ -828,6 +1067,8 @@ namespace core {
             template<typename ATYPE>
             array_type &operator*=(const ATYPE &v) 
             { 
+                static_assert(is_same_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::mult(*this,v); 
                 return *this;
             }
@@ -870,6 +1111,8 @@ namespace core {
             template<typename ATYPE>
             array_type &operator/=(const ATYPE &v) 
             { 
+                static_assert(is_same_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::div(*this,v); 
                 return *this;
             }
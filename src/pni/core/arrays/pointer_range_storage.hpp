@@ -0,0 +1,227 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <iterator>
+#include <sstream>
+#include <pni/core/types/types.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief contiguous range of elements
+    //!
+    //! Base class of the storage types whose elements are a contiguous 
+    //! range of memory not managed by a standard container (external_storage
+    //! and mapped_storage). It stores a pointer to the first element and the
+    //! number of elements and provides the element access and iterator 
+    //! interface required by mdarray. Iterators are plain pointers.
+    //! 
+    //! The class does not own the memory. Managing the lifetime of the 
+    //! range is up to the derived class.
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> class pointer_range_storage
+    {
+        public:
+            //=================public types====================================
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T* pointer;
+            //! const pointer type
+            typedef const T* const_pointer;
+            //! reference type
+            typedef T& reference;
+            //! const reference type
+            typedef const T& const_reference;
+            //! iterator type
+            typedef T* iterator;
+            //! const iterator type
+            typedef const T* const_iterator;
+            //! reverse iterator type
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            //! const reverse iterator type
+            typedef std::reverse_iterator<const_iterator> 
+                const_reverse_iterator;
+            //! size type
+            typedef size_t size_type;
+            //! pointer difference type
+            typedef std::ptrdiff_t difference_type;
+        protected:
+            //! pointer to the first element
+            T *_data;
+            //! number of elements
+            size_t _size;
+
+            //=================constructors====================================
+            //! default constructor - empty range
+            pointer_range_storage() noexcept:_data(nullptr),_size(0) {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param data pointer to the first element
+            //! \param n number of elements
+            //!
+            pointer_range_storage(T *data,size_t n) noexcept:
+                _data(data),
+                _size(n)
+            {}
+
+            //-----------------------------------------------------------------
+            //! reset to an empty range
+            void clear_range() noexcept
+            {
+                _data = nullptr;
+                _size = 0;
+            }
+        public:
+            //=================public methods==================================
+            //! number of elements
+            size_t size() const noexcept { return _size; }
+
+            //-----------------------------------------------------------------
+            //! true if the storage is empty
+            bool empty() const noexcept { return _size==0; }
+
+            //-----------------------------------------------------------------
+            //! pointer to the first element
+            pointer data() noexcept { return _data; }
+            
+            //-----------------------------------------------------------------
+            //! const pointer to the first element
+            const_pointer data() const noexcept { return _data; }
+
+            //=================element access==================================
+            //! unchecked element access
+            reference operator[](size_t i) { return _data[i]; }
+
+            //-----------------------------------------------------------------
+            //! unchecked element access
+            const_reference operator[](size_t i) const { return _data[i]; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief checked element access
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i element index
+            //! \return reference to the element
+            //!
+            reference at(size_t i) 
+            { 
+                check_index(i);
+                return _data[i]; 
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief checked element access
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i element index
+            //! \return reference to the element
+            //!
+            const_reference at(size_t i) const 
+            { 
+                check_index(i);
+                return _data[i]; 
+            }
+
+            //-----------------------------------------------------------------
+            //! reference to the first element
+            reference front() { return _data[0]; }
+
+            //-----------------------------------------------------------------
+            //! reference to the first element
+            const_reference front() const { return _data[0]; }
+
+            //-----------------------------------------------------------------
+            //! reference to the last element
+            reference back() { return _data[_size-1]; }
+
+            //-----------------------------------------------------------------
+            //! reference to the last element
+            const_reference back() const { return _data[_size-1]; }
+
+            //=================iterators=======================================
+            //! iterator to the first element
+            iterator begin() noexcept { return _data; }
+
+            //-----------------------------------------------------------------
+            //! iterator to the last+1 element
+            iterator end() noexcept { return _data+_size; }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the first element
+            const_iterator begin() const noexcept { return _data; }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the last+1 element
+            const_iterator end() const noexcept { return _data+_size; }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the last element
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the last element
+            const_reverse_iterator rbegin() const 
+            { 
+                return const_reverse_iterator(end()); 
+            }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the first-1 element
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the first-1 element
+            const_reverse_iterator rend() const 
+            { 
+                return const_reverse_iterator(begin()); 
+            }
+        private:
+            //-----------------------------------------------------------------
+            void check_index(size_t i) const
+            {
+                if(i>=_size)
+                {
+                    std::stringstream ss;
+                    ss<<"Index "<<i<<" exceeds storage size "<<_size<<"!";
+                    throw index_error(EXCEPTION_RECORD,ss.str());
+                }
+            }
+    };
+
+//end of namespace
+}
+}
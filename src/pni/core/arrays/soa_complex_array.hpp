@@ -0,0 +1,1581 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <ostream>
+#include <complex>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/utilities/container_utils.hpp>
+#include <pni/core/utilities/container_iterator.hpp>
+#include <pni/core/utilities/proxy_iterator.hpp>
+#include <pni/core/arrays/mdarray.hpp>
+#include <pni/core/arrays/aligned_allocator.hpp>
+#include <pni/core/arrays/array_arithmetic.hpp>
+#include <pni/core/algorithms/math/simd_complex.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
+
+namespace pni{
+namespace core{
+
+    template<typename T> class soa_complex_array;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief reference to a split complex number
+    //!
+    //! Proxy returned by the non-const access operators of 
+    //! soa_complex_array. It behaves like a reference to std::complex<T>.
+    //!
+    //! \tparam T element type of the real and imaginary parts
+    //!
+    template<typename T> class complex_reference
+    {
+        private:
+            //! the real part
+            T *_re;
+            //! the imaginary part
+            T *_im;
+        public:
+            //! complex type
+            typedef std::complex<T> value_type;
+
+            //!
+            //! \brief constructor
+            //!
+            //! \param re pointer to the real part
+            //! \param im pointer to the imaginary part
+            //!
+            complex_reference(T *re,T *im):
+                _re(re),
+                _im(im)
+            {}
+
+            //! get the complex number
+            operator value_type() const { return value_type(*_re,*_im); }
+
+            //! set the complex number
+            complex_reference &operator=(const value_type &v)
+            {
+                *_re = v.real();
+                *_im = v.imag();
+                return *this;
+            }
+
+            //! assign the value of another element
+            complex_reference &operator=(const complex_reference &r)
+            {
+                return *this = value_type(r);
+            }
+
+            //! real part
+            T real() const { return *_re; }
+
+            //! imaginary part
+            T imag() const { return *_im; }
+
+            //! equality with a complex number
+            friend bool operator==(const complex_reference &a,
+                                   const value_type &b)
+            {
+                return value_type(a)==b;
+            }
+
+            //! equality with a complex number
+            friend bool operator==(const value_type &a,
+                                   const complex_reference &b)
+            {
+                return a==value_type(b);
+            }
+
+            //! inequality with a complex number
+            friend bool operator!=(const complex_reference &a,
+                                   const value_type &b)
+            {
+                return !(a==b);
+            }
+
+            //! inequality with a complex number
+            friend bool operator!=(const value_type &a,
+                                   const complex_reference &b)
+            {
+                return !(a==b);
+            }
+
+            //! write the complex number to a stream
+            friend std::ostream &operator<<(std::ostream &o,
+                                            const complex_reference &r)
+            {
+                return o<<value_type(r);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief magnitude of a split complex number
+    //!
+    //! The magnitude is computed as \f$\sqrt{re^2+im^2}\f$ for single 
+    //! elements and packets. Unlike std::abs no scaling is applied. The 
+    //! result overflows if the squares exceed the floating point range.
+    //!
+    struct complex_abs_op
+    {
+        //! the function is available for packets
+        static const bool is_vectorized = true;
+
+        //! apply the function to a single element
+        template<typename T> static T apply(T re,T im)
+        {
+            return std::sqrt(re*re+im*im);
+        }
+
+        //! apply the function to a packet
+        template<typename PT>
+        static typename PT::type packet(typename PT::type re,
+                                        typename PT::type im)
+        {
+            return PT::sqrt(PT::add(PT::mult(re,re),PT::mult(im,im)));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief phase of a split complex number
+    //!
+    //! The phase is computed with std::atan2 element by element. 
+    //!
+    struct complex_arg_op
+    {
+        //! the function is not available for packets
+        static const bool is_vectorized = false;
+
+        //! apply the function to a single element
+        template<typename T> static T apply(T re,T im)
+        {
+            return std::atan2(im,re);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief expression template for functions of split complex numbers
+    //!
+    //! Computes a real valued function (see complex_abs_op and 
+    //! complex_arg_op) of the elements of a soa_complex_array when an 
+    //! element is accessed. The expression refers to the planes of the 
+    //! array and becomes invalid when the array is destroyed.
+    //!
+    //! \tparam T element type of the real and imaginary parts
+    //! \tparam FUNC function type
+    //!
+    template<
+             typename T,
+             typename FUNC
+            >
+    class complex_plane_op
+    {
+        private:
+            //! pointer to the real plane
+            const T *_re;
+            //! pointer to the imaginary plane
+            const T *_im;
+            //! number of elements
+            size_t _size;
+        public:
+            //--------------------public types---------------------------------
+            //! result type of the function
+            typedef T value_type;
+            //! type of the expression template
+            typedef complex_plane_op<T,FUNC> array_type;
+            //! storage type
+            typedef void storage_type;
+            //! non-const iterator type - just for interface
+            typedef container_iterator<array_type> iterator;
+            //! const iterator type
+            typedef container_iterator<const array_type> const_iterator;
+            //! reverse iterator type
+            typedef container_iterator<array_type> reverse_iterator;
+            //! const reverse iterator type
+            typedef container_iterator<const array_type> const_reverse_iterator;
+            //! index map type
+            typedef dynamic_cindex_map map_type;
+            //! inplace arithmetic type
+            typedef inplace_arithmetics inplace_arithmetic;
+
+            //===================constructors==================================
+            //!
+            //! \brief constructor
+            //!
+            //! \param re pointer to the real plane
+            //! \param im pointer to the imaginary plane
+            //! \param size number of elements
+            //!
+            complex_plane_op(const T *re,const T *im,size_t size):
+                _re(re),
+                _im(im),
+                _size(size)
+            {}
+
+            //====================public methods===============================
+            //! pointer to the real plane
+            const T *real_data() const { return _re; }
+
+            //-----------------------------------------------------------------
+            //! pointer to the imaginary plane
+            const T *imag_data() const { return _im; }
+
+            //-----------------------------------------------------------------
+            //! get result at i
+            value_type operator[](size_t i) const
+            {
+                return FUNC::apply(_re[i],_im[i]);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get result at i
+            //! 
+            //! \throws index_error if i>=size()
+            //! \param i index for which to compute the result
+            //! \return result of the function
+            //! 
+            value_type at(size_t i) const
+            {
+                if(i>=size())
+                    throw index_error(EXCEPTION_RECORD,"array index exceeded!");
+
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //! number of elements
+            size_t size() const { return _size; }
+
+            //=====================iterators===================================
+            //! get const iterator to the first element
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! get const iterator to last+1 element
+            const_iterator end() const 
+            { 
+                return const_iterator(this,this->size()); 
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief packet evaluator for functions of split complex numbers
+    //!
+    //! Both planes are loaded and combined with the packet version of the 
+    //! function. Functions without a packet version (complex_arg_op) are 
+    //! evaluated element by element.
+    //!
+    //! \tparam T element type of the planes
+    //! \tparam FUNC function type
+    //!
+    template<
+             typename T,
+             typename FUNC
+            >
+    class packet_expression<complex_plane_op<T,FUNC>,T>
+    {
+        private:
+            //! expression type
+            typedef complex_plane_op<T,FUNC> expression_type;
+            //! pointer to the real plane
+            const T *_re;
+            //! pointer to the imaginary plane
+            const T *_im;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+
+            //! true if the function can be evaluated with packets
+            static const bool value = FUNC::is_vectorized && 
+                                      packet_type::is_vectorized;
+
+            //! both planes are in memory
+            static const size_t leaves = 2;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check instance
+            //!
+            //! The planes must not partially overlap with the destination.
+            //!
+            static bool is_valid(const expression_type &e,const T *dest,
+                                 size_t n)
+            {
+                if(e.size()!=n) return false;
+
+                for(const T *p: {e.real_data(),e.imag_data()})
+                    if(!(p==dest || p+n<=dest || dest+n<=p)) return false;
+
+                return true;
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit packet_expression(const expression_type &e):
+                _re(e.real_data()),
+                _im(e.imag_data())
+            {}
+
+            //-----------------------------------------------------------------
+            //! planes can be loaded at every index
+            size_t seek(size_t) const 
+            { 
+                return std::numeric_limits<size_t>::max(); 
+            }
+
+            //-----------------------------------------------------------------
+            //! compute the packet starting at element i
+            typename packet_type::type load(size_t i) const
+            {
+                return FUNC::template packet<packet_type>(
+                        packet_type::load(_re+i),packet_type::load(_im+i));
+            }
+    };
+
+    //=========================================================================
+    // evaluation of expressions into split complex arrays
+    //=========================================================================
+    //
+    // An expression assigned to a soa_complex_array is evaluated with two 
+    // packets per element block - one for the real and one for the 
+    // imaginary parts. Operands with real values (real arrays, real 
+    // scalars, and real valued sub-expressions) carry no imaginary packet. 
+    // Mixed operations follow std::complex: a complex multiplied by a real 
+    // value scales both parts, adding a real value only changes the real 
+    // part. Complex divisions are evaluated element by element.
+    //
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for real valued expressions
+    //!
+    //! The default implementation evaluates a real valued operand with 
+    //! packet_expression. Complex operands stored interleaved cannot be 
+    //! evaluated this way.
+    //!
+    //! \tparam ETYPE expression type
+    //! \tparam T element type of the real and imaginary planes
+    //!
+    template<
+             typename ETYPE,
+             typename T
+            >
+    class soa_packet_expression
+    {
+        private:
+            //! evaluator for the expression
+            typedef packet_expression<ETYPE,T> expression_type;
+            //! the evaluator
+            expression_type _expr;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+            //! register type 
+            typedef typename packet_type::type register_type;
+
+            //! true if the expression can be evaluated with packets
+            static const bool value = expression_type::value &&
+                    std::is_same<typename ETYPE::value_type,T>::value;
+
+            //! the expression is real valued
+            static const bool is_real = true;
+
+            //! number of leaves with data in memory
+            static const size_t leaves = expression_type::leaves;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check instance
+            //!
+            //! \param e reference to the expression
+            //! \param re pointer to the real plane of the destination
+            //! \param im pointer to the imaginary plane of the destination
+            //! \param n number of elements in the destination
+            //! \return true if packet evaluation is possible
+            //!
+            static bool is_valid(const ETYPE &e,const T *re,const T *im,
+                                 size_t n)
+            {
+                return expression_type::is_valid(e,re,n) && 
+                       expression_type::is_valid(e,im,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit soa_packet_expression(const ETYPE &e):_expr(e) {}
+
+            //-----------------------------------------------------------------
+            //! position the expression at element i
+            size_t seek(size_t i) { return _expr.seek(i); }
+
+            //-----------------------------------------------------------------
+            //! load the packets starting at element i
+            void load(size_t i,register_type &re,register_type &) const
+            {
+                re = _expr.load(i);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for split complex arrays
+    //!
+    //! \tparam T element type of the real and imaginary planes
+    //!
+    template<typename T> 
+    class soa_packet_expression<soa_complex_array<T>,T>
+    {
+        private:
+            //! pointer to the real plane
+            const T *_re;
+            //! pointer to the imaginary plane
+            const T *_im;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+            //! register type 
+            typedef typename packet_type::type register_type;
+
+            //! true if the array can be evaluated with packets
+            static const bool value = packet_type::is_vectorized;
+
+            //! the array is complex valued
+            static const bool is_real = false;
+
+            //! both planes are in memory
+            static const size_t leaves = 2;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check instance
+            //!
+            //! The planes of two different arrays never overlap. 
+            //!
+            static bool is_valid(const soa_complex_array<T> &e,const T *,
+                                 const T *,size_t n)
+            {
+                return e.size()==n;
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit soa_packet_expression(const soa_complex_array<T> &e):
+                _re(e.real().data()),
+                _im(e.imag().data())
+            {}
+
+            //-----------------------------------------------------------------
+            //! planes can be loaded at every index
+            size_t seek(size_t) const 
+            { 
+                return std::numeric_limits<size_t>::max(); 
+            }
+
+            //-----------------------------------------------------------------
+            //! load the packets starting at element i
+            void load(size_t i,register_type &re,register_type &im) const
+            {
+                re = packet_type::load(_re+i);
+                im = packet_type::load(_im+i);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for scalars
+    //!
+    //! Complex scalars must have the element type of the destination.
+    //! Real scalars must have the type of the planes or an integer type.
+    //!
+    //! \tparam S scalar type
+    //! \tparam T element type of the real and imaginary planes
+    //!
+    template<
+             typename S,
+             typename T
+            >
+    class soa_packet_expression<scalar<S>,T>
+    {
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+            //! register type 
+            typedef typename packet_type::type register_type;
+        private:
+            //! broadcast real part
+            register_type _re;
+            //! broadcast imaginary part
+            register_type _im;
+
+            //! convert a complex scalar
+            static std::complex<T> to_complex(const std::complex<T> &v)
+            {
+                return v;
+            }
+
+            //! convert a real scalar
+            template<typename U> static std::complex<T> to_complex(U v)
+            {
+                return std::complex<T>(T(v));
+            }
+        public:
+            //! true if the scalar can be evaluated with packets
+            static const bool value = packet_type::is_vectorized &&
+                    (std::is_same<S,std::complex<T>>::value ||
+                     std::is_same<S,T>::value || std::is_integral<S>::value);
+
+            //! true for real scalars
+            static const bool is_real = !std::is_same<S,std::complex<T>>::value;
+
+            //! scalars have no data in memory
+            static const size_t leaves = 0;
+
+            //-----------------------------------------------------------------
+            //! scalars are always valid
+            static bool is_valid(const scalar<S> &,const T *,const T *,size_t)
+            {
+                return true;
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit soa_packet_expression(const scalar<S> &s)
+            {
+                std::complex<T> v = to_complex(S(s));
+                _re = packet_type::set1(v.real());
+                _im = packet_type::set1(v.imag());
+            }
+
+            //-----------------------------------------------------------------
+            //! scalars can be loaded at every index
+            size_t seek(size_t) const 
+            { 
+                return std::numeric_limits<size_t>::max(); 
+            }
+
+            //-----------------------------------------------------------------
+            //! broadcast the scalar 
+            void load(size_t,register_type &re,register_type &im) const
+            {
+                re = _re;
+                im = _im;
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex addition kernel
+    //!
+    struct soa_add_kernel
+    {
+        //!
+        //! \brief apply the kernel
+        //!
+        //! \tparam PT packet type
+        //! \tparam R1 true if the first operand is real
+        //! \tparam R2 true if the second operand is real
+        //!
+        template<
+                 typename PT,
+                 bool R1,
+                 bool R2
+                >
+        static void packet(typename PT::type ar,typename PT::type ai,
+                           typename PT::type br,typename PT::type bi,
+                           typename PT::type &re,typename PT::type &im)
+        {
+            re = PT::add(ar,br);
+            if(R1 && R2) return;
+
+            im = R1 ? bi : (R2 ? ai : PT::add(ai,bi));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex subtraction kernel
+    //!
+    struct soa_sub_kernel
+    {
+        //! apply the kernel (see soa_add_kernel)
+        template<
+                 typename PT,
+                 bool R1,
+                 bool R2
+                >
+        static void packet(typename PT::type ar,typename PT::type ai,
+                           typename PT::type br,typename PT::type bi,
+                           typename PT::type &re,typename PT::type &im)
+        {
+            re = PT::sub(ar,br);
+            if(R1 && R2) return;
+
+            im = R1 ? PT::mult(bi,PT::set1(-1)) : 
+                      (R2 ? ai : PT::sub(ai,bi));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex multiplication kernel
+    //!
+    //! With split planes a complex multiplication
+    //! \f[ (a+ib)(c+id) = (ac-bd) + i(ad+bc) \f]
+    //! needs four multiplications and two additions without any shuffles.
+    //!
+    struct soa_mult_kernel
+    {
+        //! apply the kernel (see soa_add_kernel)
+        template<
+                 typename PT,
+                 bool R1,
+                 bool R2
+                >
+        static void packet(typename PT::type ar,typename PT::type ai,
+                           typename PT::type br,typename PT::type bi,
+                           typename PT::type &re,typename PT::type &im)
+        {
+            if(R1 || R2)
+            {
+                re = PT::mult(ar,br);
+                if(R1 && R2) return;
+
+                im = R1 ? PT::mult(ar,bi) : PT::mult(ai,br);
+            }
+            else
+            {
+                re = PT::sub(PT::mult(ar,br),PT::mult(ai,bi));
+                im = PT::add(PT::mult(ar,bi),PT::mult(ai,br));
+            }
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for binary operations
+    //!
+    //! The operands must not be broadcast. The value type of the operation 
+    //! must either be std::complex<T> or T if both operands are real.
+    //!
+    //! \tparam OPTYPE expression template type (add_op, sub_op, mult_op)
+    //! \tparam KERNEL kernel type
+    //! \tparam T element type of the real and imaginary planes
+    //!
+    template<
+             typename OPTYPE,
+             typename KERNEL,
+             typename T
+            >
+    class soa_packet_binary_expression
+    {
+        private:
+            //! first operand type
+            typedef typename std::remove_cv<typename std::remove_reference<
+                decltype(std::declval<OPTYPE>().op1())>::type>::type op1_type;
+            //! second operand type
+            typedef typename std::remove_cv<typename std::remove_reference<
+                decltype(std::declval<OPTYPE>().op2())>::type>::type op2_type;
+            //! evaluator of the first operand
+            typedef soa_packet_expression<op1_type,T> op1_expression;
+            //! evaluator of the second operand
+            typedef soa_packet_expression<op2_type,T> op2_expression;
+
+            //! first operand
+            op1_expression _op1;
+            //! second operand
+            op2_expression _op2;
+        public:
+            //! packet type
+            typedef simd_packet<T> packet_type;
+            //! register type 
+            typedef typename packet_type::type register_type;
+
+            //! true if the operation is real valued
+            static const bool is_real = 
+                std::is_same<typename OPTYPE::value_type,T>::value;
+
+            //! true if the operation can be evaluated with packets
+            static const bool value = packet_type::is_vectorized &&
+                op1_expression::value && op2_expression::value &&
+                (std::is_same<typename OPTYPE::value_type,
+                              std::complex<T>>::value ||
+                 (is_real && op1_expression::is_real && 
+                  op2_expression::is_real));
+
+            //! number of leaves with data in memory
+            static const size_t leaves = op1_expression::leaves + 
+                                         op2_expression::leaves;
+
+            //-----------------------------------------------------------------
+            //! check instance
+            static bool is_valid(const OPTYPE &e,const T *re,const T *im,
+                                 size_t n)
+            {
+                return e.op1_broadcast().is_identity() &&
+                       e.op2_broadcast().is_identity() &&
+                       op1_expression::is_valid(e.op1(),re,im,n) &&
+                       op2_expression::is_valid(e.op2(),re,im,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit soa_packet_binary_expression(const OPTYPE &e):
+                _op1(e.op1()),
+                _op2(e.op2())
+            {}
+
+            //-----------------------------------------------------------------
+            //! position both operands at element i
+            size_t seek(size_t i)
+            {
+                return std::min(_op1.seek(i),_op2.seek(i));
+            }
+
+            //-----------------------------------------------------------------
+            //! compute the packets starting at element i
+            void load(size_t i,register_type &re,register_type &im) const
+            {
+                register_type ar = register_type(),ai = register_type();
+                register_type br = register_type(),bi = register_type();
+                _op1.load(i,ar,ai);
+                _op2.load(i,br,bi);
+                KERNEL::template packet<packet_type,op1_expression::is_real,
+                                        op2_expression::is_real>(ar,ai,br,bi,
+                                                                 re,im);
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for additions
+    //!
+    template<typename OP1T,typename OP2T,typename T>
+    class soa_packet_expression<add_op<OP1T,OP2T>,T>:
+        public soa_packet_binary_expression<add_op<OP1T,OP2T>,soa_add_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit soa_packet_expression(const add_op<OP1T,OP2T> &e):
+                soa_packet_binary_expression<add_op<OP1T,OP2T>,
+                                             soa_add_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for subtractions
+    //!
+    template<typename OP1T,typename OP2T,typename T>
+    class soa_packet_expression<sub_op<OP1T,OP2T>,T>:
+        public soa_packet_binary_expression<sub_op<OP1T,OP2T>,soa_sub_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit soa_packet_expression(const sub_op<OP1T,OP2T> &e):
+                soa_packet_binary_expression<sub_op<OP1T,OP2T>,
+                                             soa_sub_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for multiplications
+    //!
+    template<typename OP1T,typename OP2T,typename T>
+    class soa_packet_expression<mult_op<OP1T,OP2T>,T>:
+        public soa_packet_binary_expression<mult_op<OP1T,OP2T>,
+                                            soa_mult_kernel,T>
+    {
+        public:
+            //! constructor
+            explicit soa_packet_expression(const mult_op<OP1T,OP2T> &e):
+                soa_packet_binary_expression<mult_op<OP1T,OP2T>,
+                                             soa_mult_kernel,T>(e)
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluator for arrays
+    //!
+    //! An mdarray is evaluated via its storage.
+    //!
+    template<
+             typename STORAGE,
+             typename IMAP,
+             typename IPA,
+             typename T
+            >
+    class soa_packet_expression<mdarray<STORAGE,IMAP,IPA>,T>:
+        public soa_packet_expression<STORAGE,T>
+    {
+        private:
+            //! base class
+            typedef soa_packet_expression<STORAGE,T> base_type;
+            //! array type
+            typedef mdarray<STORAGE,IMAP,IPA> array_type;
+        public:
+            //-----------------------------------------------------------------
+            //! check the storage
+            static bool is_valid(const array_type &e,const T *re,const T *im,
+                                 size_t n)
+            {
+                return base_type::is_valid(e.storage(),re,im,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit soa_packet_expression(const array_type &e):
+                base_type(e.storage())
+            {}
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression into split planes
+    //!
+    //! Evaluates the elements [begin,end) in blocks whose working set fits 
+    //! into the L1 cache (see packet_evaluate_range()). The caller has to 
+    //! ensure that the expression can be evaluated with packets.
+    //!
+    //! \tparam T element type of the planes
+    //! \tparam ETYPE expression type
+    //! \param re pointer to the real plane
+    //! \param im pointer to the imaginary plane
+    //! \param expr reference to the expression
+    //! \param begin first element to evaluate
+    //! \param end one after the last element to evaluate
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    void soa_evaluate_range(T *re,T *im,const ETYPE &expr,size_t begin,
+                            size_t end)
+    {
+        typedef soa_packet_expression<ETYPE,T> expression_type;
+        typedef typename expression_type::packet_type packet_type;
+        typedef typename packet_type::type register_type;
+
+        const size_t psize = packet_type::size;
+        const size_t bsize = 
+            ((l1_cache_size/(expression_type::leaves+2)/sizeof(T))/
+             psize+1)*psize;
+
+        expression_type e(expr);
+        for(size_t b=begin;b<end;b+=bsize)
+        {
+            size_t block_end = b+bsize<end ? b+bsize : end;
+            size_t i = b;
+            while(i<block_end)
+            {
+                size_t run = e.seek(i);
+                size_t run_end = run<block_end-i ? i+run : block_end;
+
+                for(;i+psize<=run_end;i+=psize) 
+                {
+                    register_type r = packet_type::set1(T(0)),m = r;
+                    e.load(i,r,m);
+                    packet_type::store(re+i,r);
+                    packet_type::store(im+i,m);
+                }
+
+                for(;i<run_end;++i) 
+                {
+                    std::complex<T> v(expr[i]);
+                    re[i] = v.real();
+                    im[i] = v.imag();
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluation not possible
+    //!
+    //! \return always false
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    bool soa_evaluate(soa_complex_array<T> &,const ETYPE &,std::false_type)
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief split complex evaluation 
+    //!
+    //! Does the runtime checks and evaluates the expression.
+    //!
+    //! \return true if the expression was evaluated
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    bool soa_evaluate(soa_complex_array<T> &dest,const ETYPE &expr,
+                      std::true_type)
+    {
+        typedef soa_packet_expression<ETYPE,T> expression_type;
+
+        size_t n = dest.size();
+        T *re = dest.real().data();
+        T *im = dest.imag().data();
+        if(expr.size()!=n || !expression_type::is_valid(expr,re,im,n)) 
+            return false;
+
+        soa_evaluate_range(re,im,expr,0,n);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression into a split complex array
+    //!
+    //! Returns false and does nothing if the expression cannot be evaluated
+    //! with packets (see soa_packet_expression).
+    //!
+    //! \tparam T element type of the planes
+    //! \tparam ETYPE expression type
+    //! \param dest reference to the destination
+    //! \param expr reference to the expression
+    //! \return true if the expression was evaluated
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    bool soa_evaluate(soa_complex_array<T> &dest,const ETYPE &expr)
+    {
+        typedef soa_packet_expression<ETYPE,T> expression_type;
+
+        return soa_evaluate(dest,expr,
+                std::integral_constant<bool,expression_type::value>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief complex array with split real and imaginary parts
+    //!
+    //! A multidimensional array of std::complex<T> storing the real and 
+    //! the imaginary parts in two separate planes (structure of arrays). 
+    //! With this layout SIMD kernels work on plain real packets. A complex
+    //! multiplication, for instance, needs no shuffles at all, and the
+    //! magnitude of a packet of numbers is computed from two loads. 
+    /*!
+    \code
+    typedef soa_complex_array<float32> array_type;
+
+    array_type psi(interleaved_wave);   //split an interleaved array
+    array_type probe = array_type::create(psi.shape<shape_t>());
+    ...
+    psi *= probe;                       
+    dynamic_array<float32> amp(psi.abs());
+    psi.real() *= 2.f;                  //work on a plane directly
+    interleave(psi,interleaved_wave);   //and back to std::complex
+    \endcode
+    !*/
+    //!
+    //! The array can be used as an operand of the arithmetic operators. An
+    //! expression assigned to a soa_complex_array is evaluated plane wise 
+    //! in SIMD packets if all its operands are split complex arrays, real 
+    //! arrays, or scalars and no operand is broadcast. Otherwise the 
+    //! expression is evaluated element by element. The array must be the 
+    //! left operand of mixed operations with real operands since the 
+    //! result type of an expression is the type of its left operand.
+    //!
+    //! The element access operators return proxies (see 
+    //! complex_reference). The storage order is C order.
+    //!
+    //! \tparam T element type of the real and imaginary parts
+    //!
+    template<typename T> class soa_complex_array
+    {
+        public:
+            //================public types=====================================
+            //! element type
+            typedef std::complex<T> value_type;
+            //! type of the real and imaginary planes
+            typedef mdarray<aligned_vector<T>,dynamic_cindex_map> plane_type;
+            //! index map type
+            typedef dynamic_cindex_map map_type;
+            //! inplace arithmetic type
+            typedef inplace_arithmetics inplace_arithmetic;
+            //! array type
+            typedef soa_complex_array<T> array_type;
+            //! reference type
+            typedef complex_reference<T> reference;
+            //! const reference type
+            typedef value_type const_reference;
+            //! iterator type
+            typedef proxy_iterator<array_type> iterator;
+            //! const iterator type
+            typedef proxy_iterator<const array_type> const_iterator;
+            //! reverse iterator type
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            //! const reverse iterator type
+            typedef std::reverse_iterator<const_iterator> 
+                const_reverse_iterator;
+        private:
+            //! the real parts
+            plane_type _real;
+            //! the imaginary parts
+            plane_type _imag;
+
+            //-----------------------------------------------------------------
+            //! split an interleaved contiguous array
+            template<typename ATYPE>
+            bool assign_interleaved(const ATYPE &a,std::true_type)
+            {
+                if(!contiguous_data<ATYPE>::is_contiguous(a)) return false;
+
+                simd_deinterleave(a.data(),size(),_real.data(),_imag.data());
+                return true;
+            }
+
+            //-----------------------------------------------------------------
+            //! the array does not hold interleaved numbers in memory
+            template<typename ATYPE>
+            bool assign_interleaved(const ATYPE &,std::false_type)
+            {
+                return false;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief assign the elements of an array
+            //!
+            //! Interleaved arrays are split with simd_deinterleave(), 
+            //! expressions are evaluated with soa_evaluate() if possible.
+            //!
+            template<typename ATYPE> void assign(const ATYPE &a)
+            {
+                typedef std::integral_constant<bool,
+                            contiguous_data<ATYPE>::value &&
+                            std::is_same<typename ATYPE::value_type,
+                                         value_type>::value> is_interleaved;
+
+                if(assign_interleaved(a,is_interleaved())) return;
+                if(soa_evaluate(*this,a)) return;
+
+                for(size_t i=0;i<size();++i) (*this)[i] = value_type(a[i]);
+            }
+
+        public:
+            //================constructors and destructor======================
+            //! default constructor
+            soa_complex_array():
+                _real(),
+                _imag()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! All elements are initialized to zero.
+            //!
+            //! \param map index map of the array
+            //!
+            explicit soa_complex_array(const map_type &map):
+                _real(map,aligned_vector<T>(map.max_elements(),T(0))),
+                _imag(map,aligned_vector<T>(map.max_elements(),T(0)))
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construction from an array
+            //!
+            //! Constructs the array from an array of complex (or real) 
+            //! numbers or an expression. The storage order of the source 
+            //! must be C order. 
+            //!
+            //! \tparam ATYPE array type
+            //! \param a reference to the source
+            //!
+            template<
+                     typename ATYPE,
+                     typename = typename std::enable_if<
+                         container_trait<ATYPE>::is_multidim>::type
+                    >
+            explicit soa_complex_array(const ATYPE &a):
+                soa_complex_array(map_utils<map_type>::create(
+                                  a.template shape<shape_t>()))
+            {
+                assign(a);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create an array
+            //!
+            /*!
+            \code
+            auto psi = soa_complex_array<float64>::create(shape_t{512,512});
+            \endcode
+            !*/
+            //! 
+            //! \tparam CTYPE container type for the shape
+            //! \param shape number of elements along each dimension
+            //! \return new array with all elements set to zero
+            //!
+            template<typename CTYPE> 
+            static soa_complex_array create(const CTYPE &shape)
+            {
+                return soa_complex_array(map_utils<map_type>::create(shape));
+            }
+
+            //==================assignment operators===========================
+            //!
+            //! \brief assign an array or expression
+            //!
+            //! \throws size_mismatch_error if the sizes do not match
+            //! \tparam ATYPE array type
+            //! \param a reference to the source
+            //! \return reference to this array
+            //!
+            template<
+                     typename ATYPE,
+                     typename = typename std::enable_if<
+                         container_trait<ATYPE>::is_multidim>::type
+                    >
+            soa_complex_array &operator=(const ATYPE &a)
+            {
+                check_equal_size(*this,a,EXCEPTION_RECORD);
+                assign(a);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! add an array, an expression, or a scalar 
+            template<typename OTYPE> soa_complex_array &operator+=(const OTYPE &o)
+            {
+                return *this = *this + o;
+            }
+
+            //-----------------------------------------------------------------
+            //! subtract an array, an expression, or a scalar 
+            template<typename OTYPE> soa_complex_array &operator-=(const OTYPE &o)
+            {
+                return *this = *this - o;
+            }
+
+            //-----------------------------------------------------------------
+            //! multiply with an array, an expression, or a scalar 
+            template<typename OTYPE> soa_complex_array &operator*=(const OTYPE &o)
+            {
+                return *this = *this * o;
+            }
+
+            //-----------------------------------------------------------------
+            //! divide by an array, an expression, or a scalar 
+            template<typename OTYPE> soa_complex_array &operator/=(const OTYPE &o)
+            {
+                return *this = *this / o;
+            }
+
+            //==================inquiry methods================================
+            //! number of elements
+            size_t size() const { return _real.size(); }
+
+            //-----------------------------------------------------------------
+            //! number of dimensions
+            size_t rank() const { return _real.rank(); }
+
+            //-----------------------------------------------------------------
+            //! reference to the index map
+            const map_type &map() const { return _real.map(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief shape of the array
+            //!
+            //! \tparam CTYPE container type for the shape
+            //! \return instance of CTYPE with the number of elements along
+            //!         each dimension
+            //!
+            template<typename CTYPE> CTYPE shape() const
+            {
+                return _real.template shape<CTYPE>();
+            }
+
+            //==================planes and lazy functions======================
+            //!
+            //! \brief real parts
+            //!
+            //! Returns a reference to the plane holding the real parts. 
+            //! Writing to the plane changes the elements of the array.
+            //!
+            plane_type &real() { return _real; }
+
+            //-----------------------------------------------------------------
+            //! const reference to the real parts
+            const plane_type &real() const { return _real; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief imaginary parts
+            //!
+            //! Returns a reference to the plane holding the imaginary parts.
+            //! Writing to the plane changes the elements of the array.
+            //!
+            plane_type &imag() { return _imag; }
+
+            //-----------------------------------------------------------------
+            //! const reference to the imaginary parts
+            const plane_type &imag() const { return _imag; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief magnitudes
+            //!
+            //! Returns an expression computing the magnitude of every 
+            //! element when it is accessed (see complex_abs_op). 
+            //!
+            mdarray<complex_plane_op<T,complex_abs_op>,map_type> abs() const
+            {
+                return plane_function<complex_abs_op>();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief phases
+            //!
+            //! Returns an expression computing the phase of every element 
+            //! when it is accessed (see complex_arg_op). 
+            //!
+            mdarray<complex_plane_op<T,complex_arg_op>,map_type> arg() const
+            {
+                return plane_function<complex_arg_op>();
+            }
+
+            //=============operators and methods to access data================
+            //! get reference to element i
+            reference operator[](size_t i)
+            {
+                return reference(&_real[i],&_imag[i]);
+            }
+
+            //-----------------------------------------------------------------
+            //! get value of element i
+            value_type operator[](size_t i) const
+            {
+                return value_type(_real[i],_imag[i]);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get reference to element i
+            //!
+            //! \throws index_error if i exceeds the size of the array
+            //! \param i linear index of the element
+            //! \return reference to the element
+            //!
+            reference at(size_t i)
+            {
+                check_index(i);
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get value of element i
+            //!
+            //! \throws index_error if i exceeds the size of the array
+            //! \param i linear index of the element
+            //! \return value of the element
+            //!
+            value_type at(size_t i) const
+            {
+                check_index(i);
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief multidimensional access
+            //!
+            //! \tparam ITYPES index types
+            //! \param i first index
+            //! \param indices remaining indices
+            //! \return reference to the element
+            //!
+            template<typename ...ITYPES>
+            reference operator()(size_t i,ITYPES ...indices)
+            {
+                return (*this)[offset(i,indices...)];
+            }
+
+            //-----------------------------------------------------------------
+            //! multidimensional read access
+            template<typename ...ITYPES>
+            value_type operator()(size_t i,ITYPES ...indices) const
+            {
+                return (*this)[offset(i,indices...)];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief multidimensional access
+            //!
+            //! \tparam CTYPE index container type
+            //! \param index container with the indices
+            //! \return reference to the element
+            //!
+            template<
+                     typename CTYPE,
+                     typename = typename std::enable_if<
+                         !std::is_integral<CTYPE>::value>::type
+                    >
+            reference operator()(const CTYPE &index)
+            {
+                return (*this)[map().offset(index)];
+            }
+
+            //-----------------------------------------------------------------
+            //! multidimensional read access
+            template<
+                     typename CTYPE,
+                     typename = typename std::enable_if<
+                         !std::is_integral<CTYPE>::value>::type
+                    >
+            value_type operator()(const CTYPE &index) const
+            {
+                return (*this)[map().offset(index)];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief linear offset of an element
+            //!
+            template<typename ...ITYPES>
+            size_t offset(size_t i,ITYPES ...indices) const
+            {
+                return map().offset(std::array<size_t,sizeof...(ITYPES)+1>{
+                                    {i,size_t(indices)...}});
+            }
+
+            //-----------------------------------------------------------------
+            //! set all elements to value
+            void fill(const value_type &value)
+            {
+                std::fill(_real.begin(),_real.end(),value.real());
+                std::fill(_imag.begin(),_imag.end(),value.imag());
+            }
+
+            //=====================iterators===================================
+            //! iterator to the first element
+            iterator begin() { return iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! iterator to the last+1 element
+            iterator end() { return iterator(this,size()); }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the first element
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! const iterator to the last+1 element
+            const_iterator end() const { return const_iterator(this,size()); }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the last element
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+            //-----------------------------------------------------------------
+            //! reverse iterator to the first-1 element
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the last element
+            const_reverse_iterator rbegin() const 
+            { 
+                return const_reverse_iterator(end()); 
+            }
+
+            //-----------------------------------------------------------------
+            //! const reverse iterator to the first-1 element
+            const_reverse_iterator rend() const 
+            { 
+                return const_reverse_iterator(begin()); 
+            }
+
+        private:
+            //! create the expression for a function of the elements
+            template<typename FUNC>
+            mdarray<complex_plane_op<T,FUNC>,map_type> plane_function() const
+            {
+                typedef complex_plane_op<T,FUNC> operator_type;
+                typedef mdarray<operator_type,map_type> result_type;
+
+                return result_type(map(),operator_type(_real.data(),
+                                                       _imag.data(),size()));
+            }
+
+            //! throw index_error if i is out of range
+            void check_index(size_t i) const
+            {
+                if(i<size()) return;
+
+                std::stringstream ss;
+                ss<<"Index "<<i<<" is out of range ("<<size()<<")!";
+                throw index_error(EXCEPTION_RECORD,ss.str());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief container trait for soa_complex_array
+    //!
+    //! The complex numbers are not stored in a single block of memory. 
+    //!
+    template<typename T> struct container_trait<soa_complex_array<T>>
+    {
+        //! random access to the elements
+        static const bool is_random_access = true;
+        //! the array is iterable
+        static const bool is_iterable = true;
+        //! the elements are split into two planes
+        static const bool is_contiguous = false;
+        //! the array is multidimensional
+        static const bool is_multidim = true;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief join planes into interleaved memory
+    //!
+    template<
+             typename T,
+             typename DTYPE
+            >
+    bool interleave(const soa_complex_array<T> &src,DTYPE &dest,
+                    std::true_type)
+    {
+        if(!contiguous_data<DTYPE>::is_contiguous(dest)) return false;
+
+        simd_interleave(src.real().data(),src.imag().data(),src.size(),
+                        dest.data());
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief destination is not interleaved memory
+    //!
+    template<
+             typename T,
+             typename DTYPE
+            >
+    bool interleave(const soa_complex_array<T> &,DTYPE &,std::false_type)
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief convert to interleaved layout
+    //!
+    //! Copies the elements of a split complex array to an array of 
+    //! std::complex<T>. If the destination is contiguous the planes are 
+    //! joined with simd_interleave(). The opposite direction is done by 
+    //! the constructor or the assignment operator of soa_complex_array.
+    /*!
+    \code
+    auto wave = dynamic_array<complex32>::create(shape_t{2048,2048});
+    soa_complex_array<float32> psi(wave);
+    ...
+    interleave(psi,wave);
+    \endcode
+    !*/
+    //!
+    //! \throws size_mismatch_error if the sizes do not match
+    //! \tparam T element type of the planes
+    //! \tparam DTYPE destination array type
+    //! \param src reference to the split complex array
+    //! \param dest reference to the destination
+    //!
+    template<
+             typename T,
+             typename DTYPE
+            >
+    void interleave(const soa_complex_array<T> &src,DTYPE &dest)
+    {
+        typedef std::integral_constant<bool,
+                    contiguous_data<DTYPE>::value &&
+                    std::is_same<typename DTYPE::value_type,
+                                 std::complex<T>>::value> is_interleaved;
+
+        check_equal_size(src,dest,EXCEPTION_RECORD);
+        if(interleave(src,dest,is_interleaved())) return;
+
+        for(size_t i=0;i<src.size();++i) dest[i] = src[i];
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,121 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <algorithm>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief convert a C-ordered array to tiled storage
+    //!
+    //! Copies the data of a C-ordered array to an array using a tiled index
+    //! map (see tiled_index_map_imp). The rows of every tile are copied as 
+    //! a block. Both arrays must provide their data in memory and must 
+    //! have the same shape.
+    /*!
+    \code
+    typedef dynamic_array<float32>     image_type;
+    typedef tiled_array<float32,32>    tiled_type; 
+
+    image_type image = ...;
+    auto tiled = tiled_type::create(image.shape<shape_t>());
+    to_tiled(image,tiled);
+    \endcode
+    !*/
+    //!
+    //! \throws size_mismatch_error if the sizes do not match
+    //! \throws shape_mismatch_error if the shapes do not match
+    //! \tparam CARRAY C-ordered array type
+    //! \tparam TARRAY tiled array type
+    //! \param src reference to the C-ordered source array
+    //! \param dest reference to the tiled destination array
+    //!
+    template<
+             typename CARRAY,
+             typename TARRAY
+            >
+    void to_tiled(const CARRAY &src,TARRAY &dest)
+    {
+        typedef typename CARRAY::map_type::implementation_type src_imp;
+        typedef typename TARRAY::map_type::implementation_type dest_imp;
+        static_assert(src_imp::c_order && src_imp::strided,
+                      "Source array must be C-ordered!");
+
+        check_equal_shape(src,dest,EXCEPTION_RECORD);
+
+        auto s = src.data();
+        auto d = dest.data();
+        dest_imp::for_each_run(dest.map(),
+                [s,d](size_t c_offset,size_t tiled_offset,size_t n)
+                {
+                    std::copy(s+c_offset,s+c_offset+n,d+tiled_offset);
+                });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief convert a tiled array to C order
+    //!
+    //! The inverse of to_tiled(). Copies the data of a tiled array to a 
+    //! C-ordered array of the same shape.
+    //!
+    //! \throws size_mismatch_error if the sizes do not match
+    //! \throws shape_mismatch_error if the shapes do not match
+    //! \tparam TARRAY tiled array type
+    //! \tparam CARRAY C-ordered array type
+    //! \param src reference to the tiled source array
+    //! \param dest reference to the C-ordered destination array
+    //!
+    template<
+             typename TARRAY,
+             typename CARRAY
+            >
+    void from_tiled(const TARRAY &src,CARRAY &dest)
+    {
+        typedef typename TARRAY::map_type::implementation_type src_imp;
+        typedef typename CARRAY::map_type::implementation_type dest_imp;
+        static_assert(dest_imp::c_order && dest_imp::strided,
+                      "Destination array must be C-ordered!");
+
+        check_equal_shape(src,dest,EXCEPTION_RECORD);
+
+        auto s = src.data();
+        auto d = dest.data();
+        src_imp::for_each_run(src.map(),
+                [s,d](size_t c_offset,size_t tiled_offset,size_t n)
+                {
+                    std::copy(s+tiled_offset,s+tiled_offset+n,d+c_offset);
+                });
+    }
+
+//end of namespace
+}
+}
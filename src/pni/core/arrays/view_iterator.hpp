@@ -0,0 +1,489 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/error/exception_utils.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief iterator for array views
+    //!
+    //! A random access iterator over the elements of an array_view. Unlike 
+    //! container_iterator, which calls the [] operator of the view for 
+    //! every element, this iterator keeps the multidimensional index and 
+    //! the offset of the current element in the original array. Incrementing
+    //! the iterator advances the fastest varying index (the last one for 
+    //! C-ordered and the first one for Fortran-ordered arrays) and carries 
+    //! over to the slower dimensions like an odometer. Thus no divisions 
+    //! are required when traversing a non-contiguous view sequentially.
+    //!
+    //! Contiguous runs of elements can be processed in one go. run_length()
+    //! returns the number of elements which follow the current one in 
+    //! memory (including the current one).
+    /*!
+    \code
+    auto view = data(slice(0,100),slice(0,1024),slice(0,512));
+    auto iter = view.begin();
+    while(iter != view.end())
+    {
+        size_t n = iter.run_length();
+        std::fill(iter.data(),iter.data()+n,0.);
+        iter += n;
+    }
+    \endcode
+    !*/
+    //!
+    //! Jumps (+=, -=, ...) recompute the index from the linear position. 
+    //! If the index map of the original array is not strided (see 
+    //! tiled_index_map_imp) the offset is recomputed for every element.
+    //!
+    //! \tparam VTYPE view type (const for a const iterator)
+    //!
+    template<typename VTYPE> class view_iterator
+    {
+        private:
+            //! view type without const
+            typedef typename std::remove_const<VTYPE>::type view_type;
+            //! array type of the view
+            typedef typename view_type::storage_type array_type;
+            //! index type 
+            typedef typename view_type::index_type index_type;
+            //! true if elements can only be read
+            static const bool is_const_access = std::is_const<VTYPE>::value ||
+                                               std::is_const<array_type>::value;
+
+            //! pointer to the view
+            VTYPE *_view;
+            //! linear index of the current element in the view
+            ssize_t _state;
+            //! number of elements in the view
+            ssize_t _maxsize;
+            //! offset of the current element in the original array
+            size_t _offset;
+            //! multidimensional index (only for non-contiguous strided views)
+            index_type _index;
+
+            //-----------------------------------------------------------------
+            //! recompute index and offset from the linear index
+            void sync()
+            {
+                if(!_view || _state<0) return;
+
+                size_t i = size_t(_state);
+                if(!view_type::strided)
+                {
+                    if(_state<_maxsize) _offset = _view->offset(i);
+                    return;
+                }
+
+                if(_view->_is_contiguous || _index.empty()) 
+                {
+                    _offset = _view->_start_offset + i;
+                    return;
+                }
+
+                auto shape = _view->_imap.begin();
+                for(size_t k=_index.size()-1;k>0;--k)
+                {
+                    size_t d = _view->dimension(k);
+                    size_t q = i/shape[d];
+                    _index[d] = i-q*shape[d];
+                    i = q;
+                }
+                _index[_view->dimension(0)] = i;
+
+                _offset = _view->_start_offset;
+                for(size_t d=0;d<_index.size();++d)
+                    _offset += _index[d]*_view->_strides[d];
+            }
+        public:
+            //====================public types=================================
+            //! value type of the view
+            typedef typename view_type::value_type value_type;
+            //! pointer type
+            typedef typename std::conditional<is_const_access,
+                                              const value_type*,
+                                              value_type*>::type pointer;
+            //! reference type
+            typedef typename std::conditional<std::is_const<VTYPE>::value,
+                                              const value_type&,
+                                              value_type&>::type reference;
+            //! difference type
+            typedef ssize_t difference_type;
+            //! iterator category
+            typedef std::random_access_iterator_tag iterator_category;
+            //! iterator type
+            typedef view_iterator<VTYPE> iterator_type;
+
+            //====================constructors=================================
+            //! default constructor
+            view_iterator():
+                _view(nullptr),
+                _state(0),
+                _maxsize(0),
+                _offset(0),
+                _index()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param view pointer to the view
+            //! \param state linear index of the initial element
+            //!
+            explicit view_iterator(VTYPE *view,size_t state=0):
+                _view(view),
+                _state(state),
+                _maxsize(view->size()),
+                _offset(0),
+                _index(view->_is_contiguous || !view_type::strided ? 0 : 
+                       view->_strides.size(),0)
+            {
+                sync();
+            }
+
+            //====================public methods===============================
+            //! check if the iterator points to an element
+            explicit operator bool() const
+            {
+                return _view && _state>=0 && _state<_maxsize;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief dereference 
+            //!
+            //! \throws iterator_error if the iterator is invalid
+            //! \return reference to the current element (a value for a 
+            //! const iterator)
+            //!
+            typename std::conditional<std::is_const<VTYPE>::value,
+                                      value_type,value_type&>::type
+            operator*() const
+            {
+                if(!(*this))
+                    throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
+
+                return _view->_parray.get()[_offset];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief member access
+            //!
+            //! \throws iterator_error if the iterator is invalid
+            //! \return pointer to the current element
+            //!
+            pointer operator->() const
+            {
+                if(!(*this))
+                    throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
+
+                return &_view->_parray.get()[_offset];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief pointer to the current element
+            //!
+            //! Returns a pointer to the current element in the memory of the
+            //! original array. Together with run_length() this allows 
+            //! processing contiguous runs with raw pointers. The original 
+            //! array must provide a data() method.
+            //!
+            //! \return pointer to the current element
+            //!
+            pointer data() const 
+            { 
+                return _view->_parray.get().data()+_offset; 
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief length of the current contiguous run
+            //!
+            //! Returns the number of elements, starting with the current 
+            //! one, which are stored contiguously in the original array. 
+            //! For strided views this is 1.
+            //!
+            //! \return number of contiguous elements
+            //!
+            size_t run_length() const
+            {
+                if(_view->_is_contiguous) return size_t(_maxsize-_state);
+
+                size_t block = _view->run_length();
+                return block - size_t(_state)%block;
+            }
+
+            //-----------------------------------------------------------------
+            //! offset of the current element in the original array
+            size_t offset() const noexcept { return _offset; }
+
+            //-----------------------------------------------------------------
+            //! multidimensional index of the current element
+            const index_type &index() const noexcept { return _index; }
+
+            //====================increment and decrement======================
+            //! prefix increment
+            iterator_type &operator++()
+            {
+                ++_state;
+                if(!view_type::strided)
+                {
+                    sync();
+                    return *this;
+                }
+
+                if(_index.empty()) 
+                {
+                    ++_offset;
+                    return *this;
+                }
+
+                auto shape = _view->_imap.begin();
+                const auto &strides = _view->_strides;
+                size_t k = _index.size()-1;
+                size_t d = _view->dimension(k);
+
+                ++_index[d];
+                _offset += strides[d];
+                while(k>0 && _index[d]==shape[d])
+                {
+                    _offset -= shape[d]*strides[d];
+                    _index[d] = 0;
+                    d = _view->dimension(--k);
+                    ++_index[d];
+                    _offset += strides[d];
+                }
+
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! postfix increment
+            iterator_type operator++(int)
+            {
+                iterator_type temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            //-----------------------------------------------------------------
+            //! prefix decrement
+            iterator_type &operator--()
+            {
+                --_state;
+                if(!view_type::strided)
+                {
+                    sync();
+                    return *this;
+                }
+
+                if(_index.empty()) 
+                {
+                    --_offset;
+                    return *this;
+                }
+
+                auto shape = _view->_imap.begin();
+                const auto &strides = _view->_strides;
+                size_t k = _index.size()-1;
+                size_t d = _view->dimension(k);
+
+                while(k>0 && _index[d]==0)
+                {
+                    _index[d] = shape[d]-1;
+                    _offset += _index[d]*strides[d];
+                    d = _view->dimension(--k);
+                }
+                --_index[d];
+                _offset -= strides[d];
+
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! postfix decrement
+            iterator_type operator--(int)
+            {
+                iterator_type temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            //-----------------------------------------------------------------
+            //! advance the iterator by i elements
+            iterator_type &operator+=(ssize_t i)
+            {
+                _state += i;
+                sync();
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! move the iterator back by i elements
+            iterator_type &operator-=(ssize_t i)
+            {
+                _state -= i;
+                sync();
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! element access relative to the current position
+            typename std::conditional<std::is_const<VTYPE>::value,
+                                      value_type,value_type&>::type
+            operator[](ssize_t i) const
+            {
+                return *(*this+i);
+            }
+
+            //====================comparison operators=========================
+            //! equality
+            bool operator==(const iterator_type &a) const 
+            {
+                return _view == a._view && _state == a._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! inequality
+            bool operator!=(const iterator_type &a) const
+            {
+                return !((*this)==a);
+            }
+
+            //-----------------------------------------------------------------
+            //! lesser than operator
+            bool operator<(const iterator_type &b) const
+            {
+                return _state < b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! lesser than equal operator
+            bool operator<=(const iterator_type &b) const
+            {
+                return _state <= b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! greater than operator
+            bool operator>(const iterator_type &b) const
+            {
+                return _state > b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! greater equal than operator
+            bool operator>=(const iterator_type &b) const
+            {
+                return _state >= b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! get state of the iterator
+            ssize_t state() const { return _state; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief add offset to iterator
+    //!
+    //! \tparam VTYPE view type
+    //! \param a original iterator
+    //! \param b offset to add
+    //! \return new iterator
+    //!
+    template<typename VTYPE> 
+    view_iterator<VTYPE> operator+(const view_iterator<VTYPE> &a,ssize_t b)
+    {
+        view_iterator<VTYPE> iter = a;
+        iter += b;
+        return iter;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief add offset to iterator
+    //!
+    //! \tparam VTYPE view type
+    //! \param a offset to add
+    //! \param b original iterator
+    //! \return new iterator
+    //!
+    template<typename VTYPE> 
+    view_iterator<VTYPE> operator+(ssize_t a,const view_iterator<VTYPE> &b)
+    {
+        return b+a;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief subtract offset from iterator
+    //!
+    //! \tparam VTYPE view type
+    //! \param a original iterator
+    //! \param b offset to subtract
+    //! \return new iterator
+    //!
+    template<typename VTYPE> 
+    view_iterator<VTYPE> operator-(const view_iterator<VTYPE> &a,ssize_t b)
+    {
+        view_iterator<VTYPE> iter = a;
+        iter -= b;
+        return iter;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief distance between iterators
+    //!
+    //! \tparam VTYPE view type
+    //! \param a first iterator
+    //! \param b second iterator
+    //! \return number of elements between b and a
+    //!
+    template<typename VTYPE> 
+    ssize_t operator-(const view_iterator<VTYPE> &a,
+                      const view_iterator<VTYPE> &b)
+    {
+        return a.state() - b.state();
+    }
+
+//end of namespace
+}
+}
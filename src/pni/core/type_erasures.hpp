@@ -29,6 +29,8 @@
 #include <pni/core/type_erasures/array_iterator.hpp>
 #include <pni/core/type_erasures/value_holder.hpp>
 #include <pni/core/type_erasures/value_holder_interface.hpp>
+#include <pni/core/type_erasures/value_holder_storage.hpp>
 #include <pni/core/type_erasures/value.hpp>
 #include <pni/core/type_erasures/value_ref.hpp>
 #include <pni/core/type_erasures/make_array.hpp>
+#include <pni/core/type_erasures/visit.hpp>
@@ -63,91 +63,131 @@ namespace core{
     //-------------------------------------------------------------------------
     type_id_t array::type_id() const
     { 
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->type_id(); 
     }
 
     //-------------------------------------------------------------------------
     size_t array::rank() const 
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->rank(); 
     }
         
     //-------------------------------------------------------------------------
     shape_t array::shape() const 
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->shape(); 
     }
 
     //-------------------------------------------------------------------------
     size_t array::size() const 
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->size(); 
     }
 
     //-------------------------------------------------------------------------
     value array::operator[](size_t i) const
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return ((const array_holder_interface&)(*_ptr))[i];
     }
 
     //-------------------------------------------------------------------------
     value array::at(size_t i) const
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return value(_ptr->at(i));
     }
 
     //-------------------------------------------------------------------------
     value_ref array::operator[](size_t i) 
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return (*_ptr)[i];
     }
 
     //-------------------------------------------------------------------------
     value_ref array::at(size_t i)
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->at(i);
     }
 
     //-------------------------------------------------------------------------
     value_ref array::operator()(const element_index &index)
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return (*_ptr)(index);
     }
 
     //-------------------------------------------------------------------------
     value array::operator()(const element_index &index) const
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return const_cast<const array_holder_interface &>((*_ptr))(index);
     }
 
+    //-------------------------------------------------------------------------
+    void array::_check_block(size_t offset,size_t count) const
+    {
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
+
+        if((offset>_ptr->size())||(count>_ptr->size()-offset))
+            throw index_error(EXCEPTION_RECORD,
+                              "Block exceeds the size of the array!");
+    }
+
+    //-------------------------------------------------------------------------
+    void array::read(size_t offset,size_t count,type_id_t tid,
+                     void *dst) const
+    {
+        _check_block(offset,count);
+        _ptr->read(offset,count,tid,dst);
+    }
+
+    //-------------------------------------------------------------------------
+    void array::write(size_t offset,size_t count,type_id_t tid,
+                      const void *src)
+    {
+        _check_block(offset,count);
+        _ptr->write(offset,count,tid,src);
+    }
+
+    //-------------------------------------------------------------------------
+    void array::read(size_t offset,size_t count,value *dst) const
+    {
+        _check_block(offset,count);
+        ((const array_holder_interface&)(*_ptr)).read(offset,count,dst);
+    }
+
+    //-------------------------------------------------------------------------
+    void array::read(size_t offset,size_t count,value_ref *dst)
+    {
+        _check_block(offset,count);
+        _ptr->read(offset,count,dst);
+    }
+
     //-------------------------------------------------------------------------
     string array::type_name() const
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->type_name();
     }
 
     //-------------------------------------------------------------------------
     const void *array::data() const
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->ptr();
     }
     
     //-------------------------------------------------------------------------
     void *array::data() 
     {
-        _check_pointer(_ptr,EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return const_cast<void*>(_ptr->ptr());
     }
    
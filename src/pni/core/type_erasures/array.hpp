@@ -28,6 +28,7 @@
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/error/exception_utils.hpp>
 #include <pni/core/types/types.hpp>
+#include <pni/core/types/traits.hpp>
 #include <pni/core/type_erasures/array_holder.hpp>
 #include <pni/core/type_erasures/array_iterator.hpp>
 #include <pni/core/windows.hpp>
@@ -82,7 +83,9 @@ namespace core{
             //!
             //! Static helper method that throws a MemoryNotAllcatedError if 
             //! the type erasure holds no data and data access is requested 
-            //! by the user.
+            //! by the user. The pointer is checked by the caller so that the
+            //! exception record (which allocates its strings) is only 
+            //! created in the case of an error.
             //! 
             //! \throw MemoryNotAllocatedError
             //! \param r exception record where the error occured.
@@ -95,27 +98,27 @@ namespace core{
 
             //----------------------------------------------------------------
             //!
-            //! \brief check pointer
-            //! 
-            //! Check the internal pointer for validity. If the pointer is not
-            //! valid an exception is thrown. 
-            //! 
-            //! \throws memory_not_allocated if pointer is not valid
-            //! \param ptr the pointer to check
-            //! \param r the exception record
-            //! 
-            static void _check_pointer(const pointer_type &ptr,
-                                  const exception_record &r)
-            {
-                if(!ptr)
-                    _throw_not_allocated_error(r);
-            }
+            //! \brief check a block
+            //!
+            //! Throws if the type erasure holds no data or if the block
+            //! of count elements starting at offset exceeds the array.
+            //!
+            //! \throw memory_not_allocated_error if the array is empty
+            //! \throw index_error if the block does not fit into the array
+            //! \param offset linear index of the first element
+            //! \param count number of elements in the block
+            //!
+            void _check_block(size_t offset,size_t count) const;
 
             //! pointer to an instance of array_holder
 #ifdef _MSC_VER
 #pragma warning(disable:4251)
 #endif
             pointer_type _ptr; 
+
+            //! visit() needs access to the holder
+            template<typename ATYPE,typename F,typename RESULT> 
+            friend struct array_visitor;
 #ifdef _MSC_VER
 #pragma warning(default:4251)
 #endif
@@ -346,6 +349,131 @@ namespace core{
             //! 
             value operator()(const element_index &index) const;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a block of elements
+            //!
+            //! Copies count elements starting at linear index offset to dst
+            //! converting them to the type determined by tid. The type 
+            //! dispatch and the virtual call happen once per block and not 
+            //! once per element. dst must point to count constructed 
+            //! elements of the type determined by tid.
+            //!
+            //! \throws memory_not_allocated_error if the array is empty
+            //! \throws index_error if the block exceeds the size of the array
+            //! \throws type_error if the elements cannot be converted to tid
+            //! \throws range_error if an element does not fit into tid
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param tid type ID of the elements referenced by dst
+            //! \param dst pointer to the target memory
+            //!
+            void read(size_t offset,size_t count,type_id_t tid,
+                      void *dst) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a typed block of elements
+            //!
+            //! Convenience wrapper around the untyped version which 
+            //! determines the type ID from the type of the target memory.
+            /*!
+            \code
+            std::vector<float64> buffer(a.size());
+            a.read(0,buffer.size(),buffer.data());
+            \endcode
+            !*/
+            //!
+            //! \tparam T primitive target type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param dst pointer to the target memory
+            //!
+            template<
+                     typename T,
+                     typename = typename std::enable_if<
+                                    is_primitive_type<T>::value>::type
+                    >
+            void read(size_t offset,size_t count,T *dst) const
+            {
+                read(offset,count,type_id_map<T>::type_id,dst);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write a block of elements
+            //!
+            //! Copies count elements of type tid from src to the array 
+            //! starting at linear index offset converting them to the 
+            //! element type of the array. 
+            //!
+            //! \throws memory_not_allocated_error if the array is empty
+            //! \throws index_error if the block exceeds the size of the array
+            //! \throws type_error if tid cannot be converted to the element
+            //!                    type
+            //! \throws range_error if a value does not fit into the element
+            //!                     type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param tid type ID of the elements referenced by src
+            //! \param src pointer to the source memory
+            //!
+            void write(size_t offset,size_t count,type_id_t tid,
+                       const void *src);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write a typed block of elements
+            //!
+            //! Convenience wrapper around the untyped version which 
+            //! determines the type ID from the type of the source memory.
+            //!
+            //! \tparam T primitive source type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param src pointer to the source memory
+            //!
+            template<
+                     typename T,
+                     typename = typename std::enable_if<
+                                    is_primitive_type<T>::value>::type
+                    >
+            void write(size_t offset,size_t count,const T *src)
+            {
+                write(offset,count,type_id_map<T>::type_id,src);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a block of values
+            //!
+            //! Stores copies of count elements starting at linear index 
+            //! offset in dst. The copies do not follow later changes of the 
+            //! array.
+            //!
+            //! \throws memory_not_allocated_error if the array is empty
+            //! \throws index_error if the block exceeds the size of the array
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param dst pointer to the first of count values
+            //!
+            void read(size_t offset,size_t count,value *dst) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get a block of references
+            //!
+            //! Stores references to count elements starting at linear index
+            //! offset in dst. This is used by the non-const iterator.
+            //!
+            //! \throws memory_not_allocated_error if the array is empty
+            //! \throws index_error if the block exceeds the size of the array
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param dst pointer to the first of count references
+            //!
+            void read(size_t offset,size_t count,value_ref *dst);
+
             //-----------------------------------------------------------------
             //! return the type name
             string type_name() const;
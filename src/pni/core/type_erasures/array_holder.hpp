@@ -23,8 +23,13 @@
 //
 #pragma once
 
+#include <type_traits>
 #include <pni/core/algorithms.hpp>
+#include <pni/core/algorithms/math/contiguous_data.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+#include <pni/core/types/type_dispatch.hpp>
 #include <pni/core/type_erasures/array_holder_interface.hpp>
+#include <pni/core/type_erasures/utils.hpp>
 
 namespace pni{
 namespace core{
@@ -44,6 +49,37 @@ namespace core{
         return (void *)(a.data());
     }
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief C ordered data trait
+    //!
+    //! \c value is true if the data of an array type is a single block of 
+    //! memory with the elements in C order. This is not the case for 
+    //! Fortran ordered and tiled arrays. For views is_c_ordered() checks 
+    //! the instance at runtime.
+    //!
+    //! \tparam ATYPE array type
+    //!
+    template<typename ATYPE> struct c_ordered_data
+    {
+        //! true if the data of ATYPE can be accessed in C order
+        static const bool value = contiguous_data<ATYPE>::value &&
+            std::is_same<typename ATYPE::map_type::implementation_type,
+                         c_index_map_imp>::value;
+
+        //!
+        //! \brief check instance
+        //!
+        //! \param a reference to the array
+        //! \return true if the data of the instance is C ordered
+        //!
+        static bool is_c_ordered(const ATYPE &a)
+        {
+            return value && contiguous_data<ATYPE>::is_contiguous(a);
+        }
+    };
+
 
     //-------------------------------------------------------------------------
     //!
@@ -58,6 +94,98 @@ namespace core{
     {
         private:
             OT _object; //!< the original object 
+
+            //! element type of the original object
+            typedef typename OT::value_type element_type;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a typed block
+            //!
+            //! Converts count elements starting at offset to T and stores
+            //! them in dst. The type dispatch is done once for the entire 
+            //! block by the caller.
+            //!
+            //! \tparam T target type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param dst pointer to the target memory
+            //!
+            template<typename T>
+            void _read(size_t offset,size_t count,T *dst) const
+            {
+                typedef strategy<T,element_type> strategy_type;
+
+                auto iter = _object.begin()+offset;
+                for(T *end = dst+count;dst!=end;++dst,++iter)
+                    *dst = strategy_type::convert(*iter);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write a typed block
+            //!
+            //! Converts count values of type T from src to the element type
+            //! and stores them starting at offset.
+            //!
+            //! \tparam T source type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param src pointer to the source memory
+            //!
+            template<typename T>
+            void _write(size_t offset,size_t count,const T *src)
+            {
+                typedef strategy<element_type,T> strategy_type;
+
+                auto iter = _object.begin()+offset;
+                for(const T *end = src+count;src!=end;++src,++iter)
+                    *iter = strategy_type::convert(*src);
+            }
+
+            //-----------------------------------------------------------------
+            //! type dispatch call for read()
+            struct read_call
+            {
+                //! result type of the call
+                typedef void result_type;
+                //! the holder to read from
+                const array_holder<OT> &_holder;
+                //! linear index of the first element
+                size_t _offset;
+                //! number of elements
+                size_t _count;
+                //! target memory
+                void *_dst;
+
+                //! read the block as T
+                template<typename T> void apply() const
+                {
+                    _holder._read(_offset,_count,static_cast<T*>(_dst));
+                }
+            };
+
+            //-----------------------------------------------------------------
+            //! type dispatch call for write()
+            struct write_call
+            {
+                //! result type of the call
+                typedef void result_type;
+                //! the holder to write to
+                array_holder<OT> &_holder;
+                //! linear index of the first element
+                size_t _offset;
+                //! number of elements
+                size_t _count;
+                //! source memory
+                const void *_src;
+
+                //! write the block from T
+                template<typename T> void apply() const
+                {
+                    _holder._write(_offset,_count,static_cast<const T*>(_src));
+                }
+            };
         public:
             //==================constructors and destructor====================
             //!construct by copying o
@@ -196,6 +324,69 @@ namespace core{
                 return value_ref(std::ref(_object(index)));
             }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a block of elements
+            //!
+            //! Converts count elements starting at linear index offset to 
+            //! the type determined by tid. No index checking is performed.
+            //!
+            //! \throws type_error if the elements cannot be converted
+            //! \throws range_error if an element does not fit into tid
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param tid type ID of the target memory
+            //! \param dst pointer to the target memory
+            //!
+            virtual void read(size_t offset,size_t count,type_id_t tid,
+                              void *dst) const
+            {
+                dispatch_type_id<primitive_types>(tid,
+                        read_call{*this,offset,count,dst});
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write a block of elements
+            //!
+            //! Converts count values of type tid to the element type and 
+            //! stores them starting at linear index offset. No index 
+            //! checking is performed.
+            //!
+            //! \throws type_error if tid cannot be converted to the element
+            //!                    type
+            //! \throws range_error if a value does not fit into the element
+            //!                     type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param tid type ID of the source memory
+            //! \param src pointer to the source memory
+            //!
+            virtual void write(size_t offset,size_t count,type_id_t tid,
+                               const void *src)
+            {
+                dispatch_type_id<primitive_types>(tid,
+                        write_call{*this,offset,count,src});
+            }
+
+            //-----------------------------------------------------------------
+            //! read a block of values
+            virtual void read(size_t offset,size_t count,value *dst) const
+            {
+                auto iter = _object.begin()+offset;
+                for(value *end = dst+count;dst!=end;++dst,++iter)
+                    *dst = value(*iter);
+            }
+
+            //-----------------------------------------------------------------
+            //! get a block of references
+            virtual void read(size_t offset,size_t count,value_ref *dst) 
+            {
+                auto iter = _object.begin()+offset;
+                for(value_ref *end = dst+count;dst!=end;++dst,++iter)
+                    *dst = value_ref(std::ref(*iter));
+            }
+
             //-----------------------------------------------------------------
             //! write data to output stream
             virtual std::ostream &write(std::ostream &os) const 
@@ -226,6 +417,13 @@ namespace core{
                 return get_pointer(_object);            
             }
 
+            //-----------------------------------------------------------------
+            //! true if the data of the array is C ordered
+            virtual bool is_c_ordered() const
+            {
+                return c_ordered_data<OT>::is_c_ordered(_object);
+            }
+
     };
 
 //end of namespace
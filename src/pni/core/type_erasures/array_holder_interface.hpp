@@ -43,6 +43,12 @@ namespace core{
             typedef std::vector<size_t> element_index; 
             //! view index type
             typedef std::vector<slice>  view_index;
+
+            //-----------------------------------------------------------------
+            //! destructor
+            virtual ~array_holder_interface() {}
+
+            //-----------------------------------------------------------------
             //!
             //! \brief return type id 
             //! 
@@ -151,6 +157,14 @@ namespace core{
             //! get pointer to data
             virtual const void *ptr() const = 0;
 
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief check data layout
+            //!
+            //! \return true if ptr() refers to all elements in C order
+            //!
+            virtual bool is_c_ordered() const = 0;
+
             //-----------------------------------------------------------------
             //! get element value
             virtual value operator()(const element_index &index) const = 0;
@@ -159,6 +173,71 @@ namespace core{
             //! get element reference
             virtual value_ref operator()(const element_index &index)  = 0;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a block of elements
+            //!
+            //! Copies count elements starting at linear index offset to the 
+            //! memory referenced by dst converting them to the type 
+            //! determined by tid. dst must point to count constructed 
+            //! elements of this type. No index checking is performed.
+            //!
+            //! \throws type_error if the elements cannot be converted to tid
+            //! \throws range_error if an element does not fit into tid
+            //! \param offset linear index of the first element
+            //! \param count number of elements 
+            //! \param tid type ID of the elements referenced by dst
+            //! \param dst pointer to the target memory
+            //!
+            virtual void read(size_t offset,size_t count,type_id_t tid,
+                              void *dst) const = 0;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write a block of elements
+            //!
+            //! Copies count elements of type tid from src to the elements 
+            //! starting at linear index offset converting them to the 
+            //! element type of the array. No index checking is performed.
+            //!
+            //! \throws type_error if tid cannot be converted to the element 
+            //!                    type
+            //! \throws range_error if a value does not fit into the element 
+            //!                     type
+            //! \param offset linear index of the first element
+            //! \param count number of elements
+            //! \param tid type ID of the elements referenced by src
+            //! \param src pointer to the source memory
+            //!
+            virtual void write(size_t offset,size_t count,type_id_t tid,
+                               const void *src) = 0;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a block of values
+            //!
+            //! Stores copies of count elements starting at linear index 
+            //! offset in dst. 
+            //!
+            //! \param offset linear index of the first element
+            //! \param count number of elements 
+            //! \param dst pointer to the first of count values
+            //!
+            virtual void read(size_t offset,size_t count,value *dst) const = 0;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get a block of references 
+            //!
+            //! Stores references to count elements starting at linear index
+            //! offset in dst.
+            //!
+            //! \param offset linear index of the first element
+            //! \param count number of elements 
+            //! \param dst pointer to the first of count value references
+            //!
+            virtual void read(size_t offset,size_t count,value_ref *dst) = 0;
+
     };
 
 
@@ -23,6 +23,9 @@
 //
 #pragma once
 
+#include <vector>
+#include <memory>
+#include <type_traits>
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/type_erasures/value.hpp>
 #include <pni/core/type_erasures/value_ref.hpp>
@@ -98,8 +101,8 @@ namespace core{
         typedef value return_type;    
         //! pointer type for -> operator
         typedef const value *ptr_type; 
-        //! reference type
-        typedef const value &ref_type;
+        //! reference type - the elements are returned by value
+        typedef value ref_type;
     };
    
 
@@ -118,6 +121,17 @@ namespace core{
     //! the array type it hides but rather creates new objects providing 
     //! access to this data.
     //!
+    //! To avoid a virtual call for every element a non-const iterator 
+    //! fetches references to the elements in blocks of block_size from the 
+    //! array. The block is shared by all copies of an iterator. Thus 
+    //! iterators which are copied for every element (as by 
+    //! std::reverse_iterator or by *iter++) read every block only once.
+    //! 
+    //! A const iterator reads every element from the array when it is 
+    //! dereferenced. Values cannot be buffered without missing changes 
+    //! made to the array by other iterators or references. Use 
+    //! array::read() to copy whole blocks of elements.
+    //!
     template<int const_flag> class array_iterator
     {
         private:
@@ -129,6 +143,67 @@ namespace core{
 
             //! actual position state of the iterator
             ssize_t _state;                    
+
+            //! number of elements fetched from the array at once
+            static const size_t block_size = 128;
+
+            //! block of element references read from the array
+            struct block_type
+            {
+                //! elements of the block
+                std::vector<typename iterator_types::value_type> data;
+                //! linear index of the first element in the block
+                ssize_t offset;
+            };
+
+            //! the actual block - shared with all copies of the iterator
+            std::shared_ptr<block_type> _block;
+
+            //! true for const iterators which do not use the block
+            typedef std::integral_constant<bool,const_flag==1> is_const_type;
+
+            //-----------------------------------------------------------------
+            //! true if the actual element is in the buffered block
+            bool _in_block() const
+            {
+                return _block && (_state>=_block->offset) &&
+                       (_state<_block->offset+ssize_t(_block->data.size()));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief fetch the actual block
+            //!
+            //! Reads the block holding the actual element from the array. 
+            //! Blocks start at multiples of block_size so that the iterator 
+            //! can be moved in both directions. The iterator must be valid.
+            //!
+            void _fetch_block() const
+            {
+                size_t start = (size_t(_state)/block_size)*block_size;
+                size_t count = _container->size()-start;
+                if(count>block_size) count = block_size;
+
+                _block->data.resize(count);
+                _container->read(start,count,_block->data.data());
+                _block->offset = start;
+            }
+
+            //-----------------------------------------------------------------
+            //! read the actual element of a const iterator
+            value _element(std::true_type) const
+            {
+                return (*_container)[_state];
+            }
+
+            //-----------------------------------------------------------------
+            //! return a reference to the actual element from the block
+            value_ref _element(std::false_type) const
+            {
+                if(!_in_block()) _fetch_block();
+
+                return _block->data[_state-_block->offset];
+            }
         public:
             //====================public types==================================
             //! value type of the container
@@ -147,7 +222,11 @@ namespace core{
             typedef array_iterator<const_flag> iterator_type;
             //================constructor and destructor========================
             //! default constructor
-            array_iterator():_container(nullptr),_state(0) {}
+            array_iterator():
+                _container(nullptr),
+                _state(0),
+                _block()
+            {}
 
             //------------------------------------------------------------------
             //!
@@ -161,21 +240,29 @@ namespace core{
             //!
             explicit array_iterator(cptr_type container,size_t state=0):
                 _container(container),
-                _state(state)
+                _state(state),
+                _block(is_const_type::value ? nullptr :
+                       std::make_shared<block_type>(block_type{{},0}))
             { }
 
             //------------------------------------------------------------------
-            //! copy constructor
+            //!
+            //! \brief copy constructor
+            //!
+            //! The copy shares the block buffer with the original iterator.
+            //!
             array_iterator(const iterator_type &i):
                 _container(i._container),
-                _state(i._state)
+                _state(i._state),
+                _block(i._block)
             { }
 
             //------------------------------------------------------------------
             //! move constructor
             array_iterator(iterator_type &&i):
                 _container(i._container),
-                _state(i._state)
+                _state(i._state),
+                _block(std::move(i._block))
             {
                 i._container = nullptr;
                 i._state = 0;
@@ -219,8 +306,8 @@ namespace core{
             {
                 if(!(*this))
                     throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
-            
-                return (*_container)[_state];
+
+                return _element(is_const_type());
             }
 
             //------------------------------------------------------------------
@@ -239,8 +326,8 @@ namespace core{
             {
                 if(!(*this))
                     throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
-            
-                return (*_container)[_state];
+
+                return _element(is_const_type());
             }
             //------------------------------------------------------------------
             //! increment iterator position
@@ -85,6 +85,10 @@ namespace core{
             return make_array<uint64>(shape);
         else if(tid == type_id_t::INT64)
             return make_array<int64>(shape);
+        else if(tid == type_id_t::FLOAT16)
+            return make_array<float16>(shape);
+        else if(tid == type_id_t::BFLOAT16)
+            return make_array<bfloat16>(shape);
         else if(tid == type_id_t::FLOAT32)
             return make_array<float32>(shape);
         else if(tid == type_id_t::FLOAT64)
@@ -108,6 +112,113 @@ namespace core{
 
         
     }
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief map a file as an array
+    //!
+    //! Map an existing file as an array of a particular type and shape. 
+    //! The type is determined by an argument and thus can be set at 
+    //! runtime. The underlying mdarray specialization is mapped_array. 
+    //! Only numeric types can be mapped.
+    /*!
+    \code
+    auto a = map_array(type_id_t::UINT16,"frames.raw",shape_t{100,2048,2048});
+    \endcode
+    !*/
+    //!
+    //! \throws type_error if the passed data type cannot be mapped
+    //! \throws file_error if the file cannot be opened or mapped
+    //! \throws size_mismatch_error if the file is too small
+    //! \tparam CTYPE container type for the shape
+    //! \param tid type id for the array
+    //! \param path path to the file
+    //! \param shape number of elements along each dimension
+    //! \param mode access mode
+    //! \param offset offset of the data in bytes
+    //! \return instance of array
+    //!
+    template<typename CTYPE>
+    array map_array(type_id_t tid,const string &path,const CTYPE &shape,
+                    map_mode mode = map_mode::READ_ONLY,size_t offset = 0)
+    {
+#define PNI_MAP_ARRAY(T)\
+        return array(array_factory<mapped_array<T>>::map(path,shape,mode,offset))
+
+        switch(tid)
+        {
+            case type_id_t::UINT8:      PNI_MAP_ARRAY(uint8);
+            case type_id_t::INT8:       PNI_MAP_ARRAY(int8);
+            case type_id_t::UINT16:     PNI_MAP_ARRAY(uint16);
+            case type_id_t::INT16:      PNI_MAP_ARRAY(int16);
+            case type_id_t::UINT32:     PNI_MAP_ARRAY(uint32);
+            case type_id_t::INT32:      PNI_MAP_ARRAY(int32);
+            case type_id_t::UINT64:     PNI_MAP_ARRAY(uint64);
+            case type_id_t::INT64:      PNI_MAP_ARRAY(int64);
+            case type_id_t::FLOAT16:    PNI_MAP_ARRAY(float16);
+            case type_id_t::BFLOAT16:   PNI_MAP_ARRAY(bfloat16);
+            case type_id_t::FLOAT32:    PNI_MAP_ARRAY(float32);
+            case type_id_t::FLOAT64:    PNI_MAP_ARRAY(float64);
+            case type_id_t::FLOAT128:   PNI_MAP_ARRAY(float128);
+            case type_id_t::COMPLEX32:  PNI_MAP_ARRAY(complex32);
+            case type_id_t::COMPLEX64:  PNI_MAP_ARRAY(complex64);
+            case type_id_t::COMPLEX128: PNI_MAP_ARRAY(complex128);
+            default:
+                throw type_error(EXCEPTION_RECORD,
+                                 "Type ID cannot be memory mapped!");
+        }
+#undef PNI_MAP_ARRAY
+    }
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief create a memory mapped array
+    //!
+    //! Create a new file for an array of a particular type and shape and 
+    //! map it read-write. An existing file will be truncated. 
+    //!
+    //! \throws type_error if the passed data type cannot be mapped
+    //! \throws file_error if the file cannot be created or mapped
+    //! \tparam CTYPE container type for the shape
+    //! \param tid type id for the array
+    //! \param path path to the new file
+    //! \param shape number of elements along each dimension
+    //! \return instance of array
+    //!
+    template<typename CTYPE>
+    array make_mapped_array(type_id_t tid,const string &path,
+                            const CTYPE &shape)
+    {
+#define PNI_CREATE_MAPPED_ARRAY(T)\
+        return array(array_factory<mapped_array<T>>::create_mapped(path,shape))
+
+        switch(tid)
+        {
+            case type_id_t::UINT8:      PNI_CREATE_MAPPED_ARRAY(uint8);
+            case type_id_t::INT8:       PNI_CREATE_MAPPED_ARRAY(int8);
+            case type_id_t::UINT16:     PNI_CREATE_MAPPED_ARRAY(uint16);
+            case type_id_t::INT16:      PNI_CREATE_MAPPED_ARRAY(int16);
+            case type_id_t::UINT32:     PNI_CREATE_MAPPED_ARRAY(uint32);
+            case type_id_t::INT32:      PNI_CREATE_MAPPED_ARRAY(int32);
+            case type_id_t::UINT64:     PNI_CREATE_MAPPED_ARRAY(uint64);
+            case type_id_t::INT64:      PNI_CREATE_MAPPED_ARRAY(int64);
+            case type_id_t::FLOAT16:    PNI_CREATE_MAPPED_ARRAY(float16);
+            case type_id_t::BFLOAT16:   PNI_CREATE_MAPPED_ARRAY(bfloat16);
+            case type_id_t::FLOAT32:    PNI_CREATE_MAPPED_ARRAY(float32);
+            case type_id_t::FLOAT64:    PNI_CREATE_MAPPED_ARRAY(float64);
+            case type_id_t::FLOAT128:   PNI_CREATE_MAPPED_ARRAY(float128);
+            case type_id_t::COMPLEX32:  PNI_CREATE_MAPPED_ARRAY(complex32);
+            case type_id_t::COMPLEX64:  PNI_CREATE_MAPPED_ARRAY(complex64);
+            case type_id_t::COMPLEX128: PNI_CREATE_MAPPED_ARRAY(complex128);
+            default:
+                throw type_error(EXCEPTION_RECORD,
+                                 "Type ID cannot be memory mapped!");
+        }
+#undef PNI_CREATE_MAPPED_ARRAY
+    }
+
 //end of namespace
 }
 }
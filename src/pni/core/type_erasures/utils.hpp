@@ -151,7 +151,8 @@ namespace core{
     //! However, to retrieve typed data the pointer to the particular
     //! holder instance is required. This template function performs the 
     //! cast based on the original data type T (which can be obtained 
-    //! from the type ID of the value. 
+    //! from the type ID of the value. The cast is not checked. The caller
+    //! must have determined T from the type ID of the holder.
     //! 
     //! \tparam T erased data type
     //! \tparam PTR interface pointer type
@@ -166,7 +167,7 @@ namespace core{
     {
         typedef value_holder<T> holder_type;
                 
-        return dynamic_cast<holder_type*>(ptr.get());
+        return static_cast<holder_type*>(ptr.get());
     }
 
     //------------------------------------------------------------------------
@@ -34,19 +34,23 @@ namespace core{
     // Implementation of constructors
     //-------------------------------------------------------------------------
     value::value():
-        _ptr(new value_holder<none>(none()))
-    {}
+        _ptr()
+    {
+        _ptr.emplace(none());
+    }
 
     //-------------------------------------------------------------------------
     value::value(const value &o)
-        :_ptr(o._ptr ? o._ptr->clone() : new value_holder<none>(none())) 
-    {}
+        :_ptr(o._ptr)
+    {
+        if(!_ptr) _ptr.emplace(none());
+    }
    
     //------------------------------------------------------------------------
     value::value(value &&o)
         :_ptr(std::move(o._ptr)) 
     {
-        o = value();
+        o._ptr.emplace(none());
     }
 
     //-------------------------------------------------------------------------
@@ -58,8 +62,7 @@ namespace core{
     {
         if(this == &o) return *this;
 
-        //we have to clone here as we cannot copy a unique pointer
-        _ptr = std::unique_ptr<value_holder_interface>(o._ptr->clone());
+        _ptr = o._ptr;
 
         return *this;
     }
@@ -68,7 +71,8 @@ namespace core{
     value &value::operator=(value &&o)
     {
         if(this == &o) return *this;
-        std::swap(_ptr,o._ptr);
+        _ptr = std::move(o._ptr);
+        o._ptr.emplace(none());
         return *this;
     }
 
@@ -104,6 +108,8 @@ namespace core{
             case type_id_t::INT32:      return make_value<int32>();
             case type_id_t::UINT64:     return make_value<uint64>();
             case type_id_t::INT64:      return make_value<int64>();
+            case type_id_t::FLOAT16:    return make_value<float16>();
+            case type_id_t::BFLOAT16:   return make_value<bfloat16>();
             case type_id_t::FLOAT32:    return make_value<float32>();
             case type_id_t::FLOAT64:    return make_value<float64>();
             case type_id_t::FLOAT128:   return make_value<float128>();
@@ -28,8 +28,10 @@
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/types/types.hpp>
 #include <pni/core/type_erasures/value_holder.hpp>
+#include <pni/core/type_erasures/value_holder_storage.hpp>
 #include <pni/core/type_erasures/utils.hpp>
 #include <pni/core/types/traits.hpp>
+#include <pni/core/types/type_dispatch.hpp>
 #include <pni/core/windows.hpp>
 
 namespace pni{
@@ -38,6 +40,7 @@ namespace core{
 
     //forward declaration
     class value_ref;
+    template<typename F,typename RESULT> struct value_visitor;
 
     //!
     //! \ingroup type_erasure_classes
@@ -46,8 +49,12 @@ namespace core{
     class PNICORE_EXPORT value
     {
         private:
-            //! internal pointer type 
-            using pointer_type = std::unique_ptr<value_holder_interface>;
+            //! 
+            //! internal pointer type - all numeric types are stored in 
+            //! the buffer of the holder storage (complex128 is the largest)
+            //!
+            using pointer_type = 
+                  value_holder_storage<value_holder<complex128>>;
 
             template<typename T>
             using enable_primitive = std::enable_if<is_primitive_type<T>::value>;
@@ -96,6 +103,56 @@ namespace core{
                 return set_value<S,T>(get_holder_ptr<S>(_ptr),v);
             }
 
+            //----------------------------------------------------------------
+            //!
+            //! \brief call object for as()
+            //!
+            //! Type dispatch call reading the value as T. 
+            //!
+            //! \tparam T target type
+            //!
+            template<typename T> struct get_call
+            {
+                //! result type of the call
+                typedef T result_type;
+                //! the value to read from
+                const value &_value;
+
+                //! read the value stored as S
+                template<typename S> T apply() const 
+                { 
+                    return _value._get<T,S>(); 
+                }
+            };
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief call object for assignment
+            //!
+            //! Type dispatch call storing data of type T.
+            //!
+            //! \tparam T type of the data to store
+            //!
+            template<typename T> struct set_call
+            {
+                //! result type of the call
+                typedef void result_type;
+                //! the value to write to 
+                const value &_value;
+                //! data to store
+                const T &_data;
+
+                //! store the data as S
+                template<typename S> void apply() const 
+                { 
+                    _value._set<S>(_data); 
+                }
+            };
+
+            //! visit() needs access to the holder
+            template<typename F,typename RESULT> 
+            friend struct value_visitor;
+
             //! pointer holding the value stored
 #ifdef _MSC_VER
 #pragma warning(disable:4251)
@@ -122,7 +179,7 @@ namespace core{
                      typename T,
                      typename = typename enable_primitive<T>::type 
                     > 
-            explicit value(T v):_ptr(new value_holder<T>(v)){}
+            explicit value(T v):_ptr() { _ptr.emplace(v); }
 
             //-----------------------------------------------------------------
             //!
@@ -190,62 +247,14 @@ namespace core{
     //=====================implementation of template member functions=========
     template<typename T> T value::as() const
     {
-        type_id_t tid = type_id();
-
-        switch(tid)
-        {
-            case type_id_t::UINT8:      return _get<T,uint8>();
-            case type_id_t::INT8:       return _get<T,int8>();
-            case type_id_t::UINT16:     return _get<T,uint16>();
-            case type_id_t::INT16:      return _get<T,int16>();
-            case type_id_t::UINT32:     return _get<T,uint32>();
-            case type_id_t::INT32:      return _get<T,int32>();
-            case type_id_t::UINT64:     return _get<T,uint64>();
-            case type_id_t::INT64:      return _get<T,int64>();
-            case type_id_t::FLOAT32:    return _get<T,float32>();
-            case type_id_t::FLOAT64:    return _get<T,float64>();
-            case type_id_t::FLOAT128:   return _get<T,float128>();
-            case type_id_t::COMPLEX32:  return _get<T,complex32>();
-            case type_id_t::COMPLEX64:  return _get<T,complex64>();
-            case type_id_t::COMPLEX128: return _get<T,complex128>(); 
-            case type_id_t::STRING:     return _get<T,string>();
-            case type_id_t::BINARY:     return _get<T,binary>();
-            case type_id_t::BOOL:       return _get<T,bool_t>();
-            default:
-                throw type_error(EXCEPTION_RECORD,"Uknown type!");
-        }
-
+        return dispatch_type_id<primitive_types>(type_id(),
+                                                 get_call<T>{*this});
     }
 
     //-------------------------------------------------------------------------
     template<typename VT> value &value::operator=(const VT &v)
     {
-        type_id_t tid = type_id();
-
-        switch(tid)
-        {
-            case type_id_t::UINT8:      _set<uint8>(v);      break;
-            case type_id_t::INT8:       _set<int8>(v);       break;
-            case type_id_t::UINT16:     _set<uint16>(v);     break;
-            case type_id_t::INT16:      _set<int16>(v);      break;
-            case type_id_t::UINT32:     _set<uint32>(v);     break;
-            case type_id_t::INT32:      _set<int32>(v);      break;
-            case type_id_t::UINT64:     _set<uint64>(v);     break;
-            case type_id_t::INT64:      _set<int64>(v);      break;
-            case type_id_t::FLOAT32:    _set<float32>(v);    break;
-            case type_id_t::FLOAT64:    _set<float64>(v);    break;
-            case type_id_t::FLOAT128:   _set<float128>(v);   break;
-            case type_id_t::COMPLEX32:  _set<complex32>(v);  break;
-            case type_id_t::COMPLEX64:  _set<complex64>(v);  break;
-            case type_id_t::COMPLEX128: _set<complex128>(v); break;
-            case type_id_t::BINARY:     _set<binary>(v);     break;
-            case type_id_t::BOOL:       _set<bool_t>(v);     break;
-            case type_id_t::STRING:     _set<string>(v);     break;
-            default:
-                throw type_error(EXCEPTION_RECORD,
-                        "Value is of unkonw type!");
-        }
-
+        dispatch_type_id<primitive_types>(type_id(),set_call<VT>{*this,v});
         return *this;
     }
 
@@ -23,6 +23,7 @@
 //
 #pragma once
 
+#include <new>
 #include <pni/core/types/type_id_map.hpp>
 #include <pni/core/type_erasures/value_holder_interface.hpp>
 
@@ -218,6 +219,18 @@ namespace core{
                 return new value_holder<T>(_value);
             }
 
+            //----------------------------------------------------------------
+            //!
+            //! \brief clone holder instance into a buffer
+            //!
+            //! \param buffer memory for the new instance
+            //! \return pointer to the new instance of value holder 
+            //! 
+            virtual value_holder_interface *clone(void *buffer) const
+            {
+                return new (buffer) value_holder<T>(_value);
+            }
+
             //----------------------------------------------------------------
             //!
             //! \brief return value
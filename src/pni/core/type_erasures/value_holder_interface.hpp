@@ -39,6 +39,10 @@ namespace core{
     class value_holder_interface
     {
         public:
+            //-----------------------------------------------------------------
+            //! destructor
+            virtual ~value_holder_interface() {}
+
             //-----------------------------------------------------------------
             //!
             //! \brief get type id
@@ -56,6 +60,19 @@ namespace core{
             //!
             virtual value_holder_interface *clone() const = 0;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief clone into a buffer
+            //!
+            //! Construct a copy of the holder object in the memory provided 
+            //! by the caller. The buffer must be large enough and suitably 
+            //! aligned for the concrete holder type.
+            //!
+            //! \param buffer pointer to the memory for the new instance
+            //! \return pointer to the new holder instance
+            //!
+            virtual value_holder_interface *clone(void *buffer) const = 0;
+
             //-----------------------------------------------------------------
             //!
             //! \brief check for reference
@@ -0,0 +1,260 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <pni/core/type_erasures/value_holder.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief owner of a value holder
+    //!
+    //! Owns the value holder of a value or value_ref type erasure. Holders 
+    //! whose size does not exceed the size of HOLDER and whose data type is 
+    //! trivially copyable are constructed in an internal buffer. All 
+    //! other holders (string and binary) are allocated on the heap. 
+    //! Constructing, copying and destroying a type erasure for a numeric 
+    //! type thus requires no memory allocation.
+    //! 
+    //! The class provides the pointer interface of std::unique_ptr used 
+    //! by the type erasures.
+    /*!
+    \code
+    value_holder_storage<value_holder<complex128>> storage;
+    storage.emplace(float32(1.2));
+    std::cout<<storage->type_id()<<std::endl;
+    \endcode
+    !*/
+    //!
+    //! \tparam HOLDER largest holder type stored in the internal buffer
+    //!
+    template<typename HOLDER>
+    class value_holder_storage
+    {
+        private:
+            //! buffer type for the holders stored inline
+            typedef typename std::aligned_storage<sizeof(HOLDER),
+                                                  alignof(HOLDER)>::type 
+                    buffer_type;
+
+            //! buffer for the holder instance 
+            buffer_type _buffer;
+            //! pointer to the holder instance 
+            value_holder_interface *_ptr;
+            //! true if the holder is stored in the buffer
+            bool _inline;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check for inline storage
+            //!
+            //! \tparam T data type of the holder
+            //!
+            template<typename T> struct is_inline
+            {
+                //! true if value_holder<T> is stored in the buffer
+                static const bool value = 
+                    sizeof(value_holder<T>) <= sizeof(buffer_type) && 
+                    alignof(value_holder<T>) <= alignof(buffer_type) &&
+                    std::is_trivially_copyable<T>::value;
+            };
+
+            //-----------------------------------------------------------------
+            //! construct a holder in the buffer
+            template<typename T> void _create(const T &v,std::true_type)
+            {
+                _ptr = new (&_buffer) value_holder<T>(v);
+                _inline = true;
+            }
+
+            //-----------------------------------------------------------------
+            //! construct a holder on the heap
+            template<typename T> void _create(const T &v,std::false_type)
+            {
+                _ptr = new value_holder<T>(v);
+                _inline = false;
+            }
+
+            //-----------------------------------------------------------------
+            //! copy the holder of another instance
+            void _copy(const value_holder_storage<HOLDER> &o)
+            {
+                if(!o._ptr) return;
+
+                if(o._inline)
+                    _ptr = o._ptr->clone(&_buffer);
+                else
+                    _ptr = o._ptr->clone();
+
+                _inline = o._inline;
+            }
+
+            //-----------------------------------------------------------------
+            //! take the holder from another instance 
+            void _move(value_holder_storage<HOLDER> &o) noexcept
+            {
+                if(o._inline)
+                {
+                    //holders in the buffer contain only trivially copyable
+                    //data - the copy cannot throw
+                    _ptr = o._ptr->clone(&_buffer);
+                    _inline = true;
+                    o.reset();
+                }
+                else
+                {
+                    _ptr = o._ptr;
+                    _inline = false;
+                    o._ptr = nullptr;
+                }
+            }
+
+        public:
+            //================constructors and destructor======================
+            //! default constructor - no holder
+            value_holder_storage() noexcept:
+                _buffer(),
+                _ptr(nullptr),
+                _inline(false)
+            {}
+
+            //-----------------------------------------------------------------
+            //! copy constructor
+            value_holder_storage(const value_holder_storage<HOLDER> &o):
+                _buffer(),
+                _ptr(nullptr),
+                _inline(false)
+            {
+                _copy(o);
+            }
+
+            //-----------------------------------------------------------------
+            //! move constructor
+            value_holder_storage(value_holder_storage<HOLDER> &&o) noexcept:
+                _buffer(),
+                _ptr(nullptr),
+                _inline(false)
+            {
+                _move(o);
+            }
+
+            //-----------------------------------------------------------------
+            //! destructor
+            ~value_holder_storage() { reset(); }
+
+            //==================assignment operators===========================
+            //!
+            //! \brief copy assignment
+            //!
+            //! Copying a holder stored in the buffer cannot fail and is done
+            //! in place. Holders on the heap are copied to a temporary 
+            //! first to leave this instance unchanged if the allocation 
+            //! fails.
+            //!
+            value_holder_storage<HOLDER> &
+            operator=(const value_holder_storage<HOLDER> &o)
+            {
+                if(this == &o) return *this;
+
+                if(!o._ptr || o._inline)
+                {
+                    reset();
+                    _copy(o);
+                    return *this;
+                }
+
+                value_holder_storage<HOLDER> temp(o);
+                reset();
+                _move(temp);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! move assignment
+            value_holder_storage<HOLDER> &
+            operator=(value_holder_storage<HOLDER> &&o) noexcept
+            {
+                if(this == &o) return *this;
+
+                reset();
+                _move(o);
+                return *this;
+            }
+
+            //=====================public member functions=====================
+            //!
+            //! \brief create a new holder
+            //!
+            //! Destroys the current holder and creates a new one storing v.
+            //!
+            //! \tparam T data type of the holder
+            //! \param v value to store in the holder
+            //!
+            template<typename T> void emplace(const T &v)
+            {
+                reset();
+                _create(v,std::integral_constant<bool,is_inline<T>::value>());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief destroy the current holder
+            //!
+            //! Only holders of trivially copyable types are stored in the
+            //! buffer. Their destructors have no effect and are not called
+            //! which saves a virtual call whenever a value is replaced.
+            //!
+            void reset() noexcept
+            {
+                if(!_ptr) return;
+
+                if(!_inline) delete _ptr;
+
+                _ptr = nullptr;
+                _inline = false;
+            }
+
+            //-----------------------------------------------------------------
+            //! get pointer to the holder
+            value_holder_interface *get() const noexcept { return _ptr; }
+
+            //-----------------------------------------------------------------
+            //! access the holder
+            value_holder_interface *operator->() const noexcept 
+            { 
+                return _ptr; 
+            }
+
+            //-----------------------------------------------------------------
+            //! true if a holder is stored
+            explicit operator bool() const noexcept { return _ptr!=nullptr; }
+    };
+
+//end of namespace
+}
+}
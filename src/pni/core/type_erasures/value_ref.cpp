@@ -31,11 +31,10 @@ namespace core{
     //-------------------------------------------------------------------------
     // Implementation of private member functions
     //-------------------------------------------------------------------------
-    void value_ref::_check_pointer(const exception_record &r) const
+    void value_ref::_throw_not_allocated_error(const exception_record &r)
     {
-        if(!_ptr)
-            throw memory_not_allocated_error(r,
-                    "Instance of value_ref holds no data!");
+        throw memory_not_allocated_error(r,
+                "Instance of value_ref holds no data!");
     }
 
     //------------------------------------------------------------------------
@@ -48,15 +47,13 @@ namespace core{
     //-------------------------------------------------------------------------
     // Implementation of constructors
     //-------------------------------------------------------------------------
-    value_ref::value_ref():_ptr(nullptr)
+    value_ref::value_ref():_ptr()
     {}
 
     //-------------------------------------------------------------------------
     value_ref::value_ref(const value_ref &o)
-        :_ptr(nullptr)
-    {
-        if(o._ptr) _ptr = pointer_type(o._ptr->clone());
-    }
+        :_ptr(o._ptr)
+    {}
 
     //-------------------------------------------------------------------------
     // Implementation of assignment operators
@@ -64,7 +61,7 @@ namespace core{
     value_ref &value_ref::operator=(const value_ref &o)
     {
         if(this == &o) return *this;
-        _ptr = pointer_type(o._ptr->clone());
+        _ptr = o._ptr;
 
         return *this;
     }
@@ -73,7 +70,7 @@ namespace core{
     //-------------------------------------------------------------------------
     value_ref &value_ref::operator=(const value &v)
     {
-        _check_pointer(EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
 
         type_id_t tid = type_id(); //obtain the type id of the value_ref
 
@@ -87,6 +84,8 @@ namespace core{
             case type_id_t::INT32:      *this = v.as<int32>();      break;
             case type_id_t::UINT64:     *this = v.as<uint64>();     break;
             case type_id_t::INT64:      *this = v.as<int64>();      break; 
+            case type_id_t::FLOAT16:    *this = v.as<float16>();    break;
+            case type_id_t::BFLOAT16:   *this = v.as<bfloat16>();   break;
             case type_id_t::FLOAT32:    *this = v.as<float32>();    break;
             case type_id_t::FLOAT64:    *this = v.as<float64>();    break;
             case type_id_t::FLOAT128:   *this = v.as<float128>();   break;
@@ -114,7 +113,7 @@ namespace core{
     //-------------------------------------------------------------------------
     type_id_t value_ref::type_id() const
     {
-        _check_pointer(EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         return _ptr->type_id();
 
     }
@@ -134,6 +133,8 @@ namespace core{
             case type_id_t::INT32:      return value(v.as<int32>());
             case type_id_t::UINT64:     return value(v.as<uint64>());
             case type_id_t::INT64:      return value(v.as<int64>());
+            case type_id_t::FLOAT16:    return value(v.as<float16>());
+            case type_id_t::BFLOAT16:   return value(v.as<bfloat16>());
             case type_id_t::FLOAT32:    return value(v.as<float32>());
             case type_id_t::FLOAT64:    return value(v.as<float64>());
             case type_id_t::FLOAT128:   return value(v.as<float128>());
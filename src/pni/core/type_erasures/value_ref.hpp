@@ -27,7 +27,9 @@
 
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/types/types.hpp>
+#include <pni/core/types/type_dispatch.hpp>
 #include <pni/core/type_erasures/value_holder.hpp>
+#include <pni/core/type_erasures/value_holder_storage.hpp>
 #include <pni/core/type_erasures/utils.hpp>
 
 #include <pni/core/windows.hpp>
@@ -46,7 +48,8 @@ namespace core{
     {
         private:
             //! internal pointer type used to hold the reference instance
-            typedef std::unique_ptr<value_holder_interface> pointer_type;
+            typedef value_holder_storage<value_holder<ref_type<complex128>>> 
+                    pointer_type;
 
             //----------------------------------------------------------------
             //!
@@ -54,12 +57,13 @@ namespace core{
             //!
             //! Static helper method that throws a memory_not_allocated_error 
             //! if the type erasure holds no data and data access is 
-            //! requested by the user.
+            //! requested by the user. Callers test the pointer first and 
+            //! build the exception record only if it is not set.
             //! 
             //! \throw memory_not_allocated_error
             //! \param r exception record where the error occurred.
             //!
-            void _check_pointer(const exception_record &r) const;
+            static void _throw_not_allocated_error(const exception_record &r);
 
             //----------------------------------------------------------------
             //!
@@ -119,6 +123,53 @@ namespace core{
                 return set_value<S,T>(get_holder_ptr<ref_type<S>>(_ptr),v);
             }
 
+            //----------------------------------------------------------------
+            //!
+            //! \brief call object for as()
+            //!
+            //! Type dispatch call reading the referenced variable as T. 
+            //!
+            //! \tparam T target type
+            //!
+            template<typename T> struct get_call
+            {
+                //! result type of the call
+                typedef T result_type;
+                //! the reference to read from
+                const value_ref &_ref;
+
+                //! read the variable of type S
+                template<typename S> T apply() const 
+                { 
+                    return _ref._get<T,S>(); 
+                }
+            };
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief call object for assignment
+            //!
+            //! Type dispatch call storing data of type T in the referenced
+            //! variable.
+            //!
+            //! \tparam T type of the data to store
+            //!
+            template<typename T> struct set_call
+            {
+                //! result type of the call
+                typedef void result_type;
+                //! the reference to write to
+                const value_ref &_ref;
+                //! data to store
+                const T &_data;
+
+                //! store the data in the variable of type S
+                template<typename S> void apply() const 
+                { 
+                    _ref._set<S>(_data); 
+                }
+            };
+
             //! pointer holding the value stored
 #ifdef _MSC_VER
 #pragma warning(disable:4251)
@@ -150,8 +201,10 @@ namespace core{
             //!
             template<typename T>
             explicit value_ref(std::reference_wrapper<T> v):
-                _ptr(new value_holder<std::reference_wrapper<T> >(v))
-            {}
+                _ptr()
+            { 
+                _ptr.emplace(v);
+            }
 
             //-----------------------------------------------------------------
             //!
@@ -249,66 +302,18 @@ namespace core{
     template<typename T> T value_ref::as() const
     {
         //check if the reference points to something
-        _check_pointer(EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
 
-        type_id_t tid = type_id();
-        switch(tid)
-        {
-            case type_id_t::UINT8:      return _get<T,uint8>();
-            case type_id_t::INT8:       return _get<T,int8>();
-            case type_id_t::UINT16:     return _get<T,uint16>();
-            case type_id_t::INT16:      return _get<T,int16>();
-            case type_id_t::UINT32:     return _get<T,uint32>();
-            case type_id_t::INT32:      return _get<T,int32>();
-            case type_id_t::UINT64:     return _get<T,uint64>();
-            case type_id_t::INT64:      return _get<T,int64>();
-            case type_id_t::FLOAT32:    return _get<T,float32>();
-            case type_id_t::FLOAT64:    return _get<T,float64>();
-            case type_id_t::FLOAT128:   return _get<T,float128>();
-            case type_id_t::COMPLEX32:  return _get<T,complex32>();
-            case type_id_t::COMPLEX64:  return _get<T,complex64>();
-            case type_id_t::COMPLEX128: return _get<T,complex128>();
-            case type_id_t::BINARY:     return _get<T,binary>();
-            case type_id_t::STRING:     return _get<T,string>();
-            case type_id_t::BOOL:       return _get<T,bool_t>();
-            default:
-                throw type_error(EXCEPTION_RECORD,
-                        "The reference points to an object of unkown type!");
-        }
-        
+        return dispatch_type_id<primitive_types>(type_id(),
+                                                 get_call<T>{*this});
     }
            
     //-------------------------------------------------------------------------
     template<typename T> value_ref &value_ref::operator=(const T &v)
     {
-        _check_pointer(EXCEPTION_RECORD);
+        if(!_ptr) _throw_not_allocated_error(EXCEPTION_RECORD);
         
-        type_id_t tid = type_id();
-
-        switch(tid)
-        {
-            case type_id_t::UINT8:      _set<uint8>(v);      break;
-            case type_id_t::INT8:       _set<int8>(v);       break;
-            case type_id_t::UINT16:     _set<uint16>(v);     break;
-            case type_id_t::INT16:      _set<int16>(v);      break;
-            case type_id_t::UINT32:     _set<uint32>(v);     break;
-            case type_id_t::INT32:      _set<int32>(v);      break;
-            case type_id_t::UINT64:     _set<uint64>(v);     break;
-            case type_id_t::INT64:      _set<int64>(v);      break;
-            case type_id_t::FLOAT32:    _set<float32>(v);    break;
-            case type_id_t::FLOAT64:    _set<float64>(v);    break;
-            case type_id_t::FLOAT128:   _set<float128>(v);   break;
-            case type_id_t::COMPLEX32:  _set<complex32>(v);  break;
-            case type_id_t::COMPLEX64:  _set<complex64>(v);  break;
-            case type_id_t::COMPLEX128: _set<complex128>(v); break;
-            case type_id_t::BINARY:     _set<binary>(v);     break;
-            case type_id_t::STRING:     _set<string>(v);     break;
-            case type_id_t::BOOL:       _set<bool_t>(v);     break;
-            default:
-                throw type_error(EXCEPTION_RECORD,
-                        "The reference points to an object of unknown type!");
-        }
-
+        dispatch_type_id<primitive_types>(type_id(),set_call<T>{*this,v});
         return *this;
     }
 
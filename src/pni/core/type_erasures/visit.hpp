@@ -0,0 +1,271 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/type_dispatch.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures/array.hpp>
+#include <pni/core/type_erasures/value.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief first type of a type list
+    //!
+    //! The result type of a visitor is determined by calling it with the 
+    //! first type of the type list.
+    //!
+    //! \tparam TYPES MPL sequence of types
+    //!
+    template<typename TYPES> struct first_type
+    {
+        //! the first type in TYPES
+        typedef typename boost::mpl::deref<
+                    typename boost::mpl::begin<TYPES>::type>::type type;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief type dispatch call for array visitors
+    //!
+    //! Wraps the data of an array type erasure in an external_array of the
+    //! concrete element type and passes it to the visitor. If ATYPE is 
+    //! const the visitor gets a const array. The data of the array must be
+    //! C ordered.
+    //!
+    //! \tparam ATYPE array or const array
+    //! \tparam F visitor type
+    //! \tparam RESULT result type of the visitor
+    //!
+    template<
+             typename ATYPE,
+             typename F,
+             typename RESULT
+            >
+    struct array_visitor
+    {
+        //! result type of the call
+        typedef RESULT result_type;
+        //! the array type erasure
+        ATYPE &_array;
+        //! the visitor
+        F &_f;
+
+        //! call the visitor with the array data as T
+        template<typename T> result_type apply() const
+        {
+            typedef external_array<T> array_type;
+            typedef typename std::conditional<std::is_const<ATYPE>::value,
+                                              const array_type,
+                                              array_type>::type argument_type;
+
+            if(_array._ptr && !_array._ptr->is_c_ordered())
+                throw type_error(EXCEPTION_RECORD,
+                        "Only arrays with C ordered data can be visited!");
+
+            T *data = static_cast<T*>(const_cast<void*>(
+                          static_cast<const void*>(_array.data())));
+            argument_type a = array_factory<array_type>::wrap(data,
+                                                              _array.shape());
+            return _f(a);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief type dispatch call for value visitors
+    //!
+    //! Passes the data stored in a value to the visitor as its original 
+    //! type.
+    //!
+    //! \tparam F visitor type
+    //! \tparam RESULT result type of the visitor
+    //!
+    template<
+             typename F,
+             typename RESULT
+            >
+    struct value_visitor
+    {
+        //! result type of the call
+        typedef RESULT result_type;
+        //! the value type erasure
+        const value &_value;
+        //! the visitor
+        F &_f;
+
+        //! call the visitor with the stored data of type T
+        template<typename T> result_type apply() const
+        {
+            const T &data = get_holder_ptr<T>(_value._ptr)->as();
+            return _f(data);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief visit an array with its element type
+    //!
+    //! Determines the element type of the array once from its type ID and
+    //! calls f with an external_array of this type referring to the data
+    //! of the array. No data is copied. f can thus be written as a generic
+    //! kernel which runs at the speed of the typed code. 
+    /*!
+    \code
+    struct sum_visitor
+    {
+        template<typename ATYPE> float64 operator()(const ATYPE &a) const
+        {
+            float64 s = 0;
+            for(auto x: a) s += x;
+            return s;
+        }
+    };
+
+    array a = ...;
+    float64 s = visit(a,sum_visitor());
+    \endcode
+    !*/
+    //! By default the numeric types are dispatched. Other type lists (like
+    //! non_numeric_types or primitive_types) can be passed explicitly.
+    //! f must be callable for each type in the list and return the same 
+    //! type.
+    //!
+    //! Only arrays whose data is stored in C order can be visited. Fortran 
+    //! ordered and tiled arrays must be converted first.
+    //!
+    //! \throws memory_not_allocated_error if the array holds no data
+    //! \throws type_error if the element type is not in TYPES or the data 
+    //! of the array is not C ordered
+    //! \tparam TYPES MPL sequence of the dispatched types
+    //! \tparam F visitor type
+    //! \param a the array to visit
+    //! \param f the visitor
+    //! \return the result of f
+    //!
+    template<
+             typename TYPES = numeric_types,
+             typename F
+            >
+    auto visit(array &a,F &&f)
+        -> decltype(f(std::declval<
+                external_array<typename first_type<TYPES>::type>&>()))
+    {
+        typedef decltype(f(std::declval<
+                external_array<typename first_type<TYPES>::type>&>())) 
+                result_type;
+        typedef array_visitor<array,F,result_type> call_type;
+
+        return dispatch_type_id<TYPES>(a.type_id(),call_type{a,f});
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief visit a const array with its element type
+    //!
+    //! Like the non-const version but f is called with a const 
+    //! external_array.
+    //!
+    //! \throws memory_not_allocated_error if the array holds no data
+    //! \throws type_error if the element type is not in TYPES or the data 
+    //! of the array is not C ordered
+    //! \tparam TYPES MPL sequence of the dispatched types
+    //! \tparam F visitor type
+    //! \param a the array to visit
+    //! \param f the visitor
+    //! \return the result of f
+    //!
+    template<
+             typename TYPES = numeric_types,
+             typename F
+            >
+    auto visit(const array &a,F &&f)
+        -> decltype(f(std::declval<
+                const external_array<typename first_type<TYPES>::type>&>()))
+    {
+        typedef decltype(f(std::declval<
+                const external_array<typename first_type<TYPES>::type>&>())) 
+                result_type;
+        typedef array_visitor<const array,F,result_type> call_type;
+
+        return dispatch_type_id<TYPES>(a.type_id(),call_type{a,f});
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief visit a value with its original type
+    //!
+    //! Determines the type of the data stored in the value once and calls
+    //! f with a const reference to the data.
+    /*!
+    \code
+    struct print_visitor
+    {
+        template<typename T> void operator()(const T &x) const
+        {
+            std::cout<<x<<std::endl;
+        }
+    };
+
+    visit<primitive_types>(value(float32(1.2)),print_visitor());
+    \endcode
+    !*/
+    //!
+    //! \throws type_error if the type of the value is not in TYPES
+    //! \tparam TYPES MPL sequence of the dispatched types
+    //! \tparam F visitor type
+    //! \param v the value to visit
+    //! \param f the visitor
+    //! \return the result of f
+    //!
+    template<
+             typename TYPES = numeric_types,
+             typename F
+            >
+    auto visit(const value &v,F &&f)
+        -> decltype(f(std::declval<
+                const typename first_type<TYPES>::type&>()))
+    {
+        typedef decltype(f(std::declval<
+                const typename first_type<TYPES>::type&>())) result_type;
+        typedef value_visitor<F,result_type> call_type;
+
+        return dispatch_type_id<TYPES>(v.type_id(),call_type{v,f});
+    }
+
+//end of namespace
+}
+}
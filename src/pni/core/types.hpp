@@ -35,6 +35,7 @@
 #include <pni/core/types/none.hpp>
 #include <pni/core/types/type_class_map.hpp>
 #include <pni/core/types/type_conversion.hpp>
+#include <pni/core/types/type_dispatch.hpp>
 #include <pni/core/types/type_id_map.hpp>
 #include <pni/core/types/type_info.hpp>
 #include <pni/core/types/types.hpp>
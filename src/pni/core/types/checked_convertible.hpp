@@ -47,21 +47,21 @@ namespace core{
         //----------------source type uint16----------------------------------
         boost::mpl::pair<
                          uint16,
-                         boost::mpl::vector<uint8,int8,int16>
+                         boost::mpl::vector<uint8,int8,int16,float16>
                        >,
 
         //----------------------source type uint32----------------------------
         boost::mpl::pair<
                          uint32,
                          boost::mpl::vector<uint8,uint16,
-                                            int8,int16,int32>
+                                            int8,int16,int32,float16>
                        >,
 
         //--------------------------source type uint64------------------------
         boost::mpl::pair<
                          uint64,
                          boost::mpl::vector<uint8,uint16,uint32,
-                                            int8,int16,int32,int64>
+                                            int8,int16,int32,int64,float16>
                        >,
 
         //------------------------source type int8 ---------------------------
@@ -80,23 +80,28 @@ namespace core{
         boost::mpl::pair<
                          int32,
                          boost::mpl::vector<uint8,uint16,uint32,uint64,
-                                            int8,int16>
+                                            int8,int16,float16>
                        >,
 
         //------------------------source type int64----------------------------
         boost::mpl::pair<
                          int64,
                          boost::mpl::vector<uint8,uint16,uint32,uint64,
-                                            int8,int16,int32>
+                                            int8,int16,int32,float16>
                        >,
 
+        //-------------------source type float16 and bfloat16-----------------
+        boost::mpl::pair<float16,boost::mpl::vector<bfloat16>>,
+        boost::mpl::pair<bfloat16,boost::mpl::vector<float16>>,
+
         //-------------------------source type float64------------------------
-        boost::mpl::pair<float32,boost::mpl::vector<>>,
-        boost::mpl::pair<float64,boost::mpl::vector<float32,complex32> >,
+        boost::mpl::pair<float32,boost::mpl::vector<float16,bfloat16>>,
+        boost::mpl::pair<float64,boost::mpl::vector<float16,bfloat16,
+                                 float32,complex32> >,
 
         //-------------------source type float128-----------------------------
-        boost::mpl::pair<float128,boost::mpl::vector<float32,float64,
-                                  complex32,complex64>>,
+        boost::mpl::pair<float128,boost::mpl::vector<float16,bfloat16,
+                                  float32,float64,complex32,complex64>>,
 
         //-------------------source type complex64----------------------------
         boost::mpl::pair<complex32,boost::mpl::vector<>>,
@@ -110,7 +115,8 @@ namespace core{
 
         boost::mpl::pair<string,boost::mpl::vector<>>,
         boost::mpl::pair<binary,boost::mpl::vector<>>,
-        boost::mpl::pair<bool_t,boost::mpl::vector<>>
+        boost::mpl::pair<bool_t,boost::mpl::vector<>>,
+        boost::mpl::pair<none,boost::mpl::vector<>>
 
         > checked_type_vectors;
 
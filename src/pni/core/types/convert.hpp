@@ -25,6 +25,7 @@
 //
 #pragma once
 
+#include <cmath>
 #include <pni/core/types/type_id_map.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/numeric/conversion/cast.hpp>
@@ -161,6 +162,69 @@ namespace core{
         }
     };
 
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief conversion to a 16Bit floating point type
+    //!
+    //! The source value is converted to float32 first. A finite value
+    //! which becomes infinite when rounded to the 16Bit type exceeds the
+    //! range of the target type. Infinity and NaN are passed through.
+    //!
+    //! \tparam FORMAT encoding of the target type
+    //! \tparam ST source type
+    //!
+    template<
+             typename FORMAT,
+             typename ST
+            >
+    struct converter<half_t<FORMAT>,ST>
+    {
+        //!
+        //! \brief perform conversion
+        //!
+        //! \param value instance of the source type
+        //! \return new instance of the target type
+        //!
+        static half_t<FORMAT> convert(const ST &value)
+        {
+            float32 v = converter<float32,ST>::convert(value);
+            half_t<FORMAT> result(v);
+
+            if(std::isinf(float32(result)) && !std::isinf(v))
+            {
+                if(v>0) throw boost::numeric::positive_overflow();
+                else    throw boost::numeric::negative_overflow();
+            }
+
+            return result;
+        }
+    };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief conversion from a 16Bit floating point type to float32
+    //!
+    //! Every 16Bit floating point value can be represented by float32.
+    //!
+    //! \tparam FORMAT encoding of the source type
+    //!
+    template<typename FORMAT>
+    struct converter<float32,half_t<FORMAT>>
+    {
+        //!
+        //! \brief perform conversion
+        //!
+        //! \param value instance of the source type
+        //! \return value as float32
+        //!
+        static float32 convert(const half_t<FORMAT> &value)
+        {
+            return value;
+        }
+    };
+
     //------------------------------------------------------------------------
     //!
     //! \ingroup type_classes_internal
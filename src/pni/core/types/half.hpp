@@ -0,0 +1,440 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <iostream>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace pni{
+namespace core{
+
+    //! \cond no_doc
+    inline std::uint32_t half_float_bits(float v)
+    {
+        std::uint32_t b;
+        std::memcpy(&b,&v,sizeof(b));
+        return b;
+    }
+
+    inline float half_bits_float(std::uint32_t b)
+    {
+        float v;
+        std::memcpy(&v,&b,sizeof(v));
+        return v;
+    }
+    //! \endcond
+
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief IEEE 754 binary16 format
+    //!
+    //! 1 sign bit, 5 exponent bits, and 10 mantissa bits. The format covers
+    //! the range up to 65504 with about 3 decimal digits. Values are
+    //! rounded to the nearest even value. Values beyond the range become
+    //! infinite and small values become subnormal numbers.
+    //!
+    //! If the compiler targets a CPU with the F16C extension the hardware
+    //! conversion instructions are used.
+    //!
+    struct binary16_format
+    {
+        //! largest finite value
+        static const std::uint16_t max_bits = 0x7bff;
+        //! smallest positive normal value
+        static const std::uint16_t min_bits = 0x0400;
+        //! difference between 1 and the next larger value
+        static const std::uint16_t epsilon_bits = 0x1400;
+        //! maximum rounding error (0.5)
+        static const std::uint16_t round_error_bits = 0x3800;
+        //! positive infinity
+        static const std::uint16_t infinity_bits = 0x7c00;
+        //! quiet NaN
+        static const std::uint16_t nan_bits = 0x7e00;
+        //! bits of the mantissa including the implicit one
+        static const int digits = 11;
+        //! decimal digits which can be represented without change
+        static const int digits10 = 3;
+        //! decimal digits required to represent all values
+        static const int max_digits10 = 5;
+        //! smallest binary exponent of a normal number
+        static const int min_exponent = -13;
+        //! smallest decimal exponent of a normal number
+        static const int min_exponent10 = -4;
+        //! largest binary exponent
+        static const int max_exponent = 16;
+        //! largest decimal exponent
+        static const int max_exponent10 = 4;
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief convert from single precision
+        //!
+        //! \param v single precision value
+        //! \return bit pattern of the half precision value
+        //!
+        static std::uint16_t from_float32(float v)
+        {
+#if defined(__F16C__)
+            return std::uint16_t(_cvtss_sh(v,_MM_FROUND_TO_NEAREST_INT));
+#else
+            std::uint32_t x = half_float_bits(v);
+            std::uint32_t sign = (x>>16)&0x8000;
+            std::uint32_t a = x&0x7fffffff;
+
+            //infinity and NaN (the NaN payload is kept as far as possible)
+            if(a>=0x7f800000)
+                return std::uint16_t(sign|0x7c00|(a>0x7f800000 ?
+                                     0x200|((a>>13)&0x3ff) : 0));
+
+            //values from 65520 upwards round to infinity
+            if(a>=0x477ff000) return std::uint16_t(sign|0x7c00);
+
+            //subnormal results - the addition aligns the mantissa bits at
+            //the bottom and rounds to nearest even
+            if(a<0x38800000)
+                return std::uint16_t(sign|(half_float_bits(
+                            half_bits_float(a)+0.5f)-0x3f000000));
+
+            //normal numbers - rebias the exponent and round to nearest even
+            a += 0xc8000fff+((a>>13)&1);
+            return std::uint16_t(sign|(a>>13));
+#endif
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief convert to single precision
+        //!
+        //! The conversion is exact.
+        //!
+        //! \param h bit pattern of the half precision value
+        //! \return single precision value
+        //!
+        static float to_float32(std::uint16_t h)
+        {
+#if defined(__F16C__)
+            return _cvtsh_ss(h);
+#else
+            std::uint32_t o = std::uint32_t(h&0x7fff)<<13;
+            std::uint32_t exp = o&0x0f800000;
+
+            o += 0x38000000;   //rebias the exponent
+            if(exp==0x0f800000)
+                o += 0x38000000;  //infinity and NaN
+            else if(exp==0)
+                o = half_float_bits(half_bits_float(o+0x00800000)-
+                                    half_bits_float(0x38800000));
+
+            return half_bits_float(o|(std::uint32_t(h&0x8000)<<16));
+#endif
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief bfloat16 format
+    //!
+    //! 1 sign bit, 8 exponent bits, and 7 mantissa bits. The format has the
+    //! same range as single precision with about 2 decimal digits. A
+    //! bfloat16 value is the upper half of a single precision value.
+    //! Values are rounded to the nearest even value.
+    //!
+    struct bfloat16_format
+    {
+        //! largest finite value
+        static const std::uint16_t max_bits = 0x7f7f;
+        //! smallest positive normal value
+        static const std::uint16_t min_bits = 0x0080;
+        //! difference between 1 and the next larger value
+        static const std::uint16_t epsilon_bits = 0x3c00;
+        //! maximum rounding error (0.5)
+        static const std::uint16_t round_error_bits = 0x3f00;
+        //! positive infinity
+        static const std::uint16_t infinity_bits = 0x7f80;
+        //! quiet NaN
+        static const std::uint16_t nan_bits = 0x7fc0;
+        //! bits of the mantissa including the implicit one
+        static const int digits = 8;
+        //! decimal digits which can be represented without change
+        static const int digits10 = 2;
+        //! decimal digits required to represent all values
+        static const int max_digits10 = 4;
+        //! smallest binary exponent of a normal number
+        static const int min_exponent = -125;
+        //! smallest decimal exponent of a normal number
+        static const int min_exponent10 = -37;
+        //! largest binary exponent
+        static const int max_exponent = 128;
+        //! largest decimal exponent
+        static const int max_exponent10 = 38;
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief convert from single precision
+        //!
+        //! \param v single precision value
+        //! \return bit pattern of the bfloat16 value
+        //!
+        static std::uint16_t from_float32(float v)
+        {
+            std::uint32_t x = half_float_bits(v);
+
+            //NaN must not be rounded to infinity
+            if((x&0x7fffffff)>0x7f800000)
+                return std::uint16_t((x>>16)|0x0040);
+
+            return std::uint16_t((x+0x7fff+((x>>16)&1))>>16);
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief convert to single precision
+        //!
+        //! The conversion is exact.
+        //!
+        //! \param h bit pattern of the bfloat16 value
+        //! \return single precision value
+        //!
+        static float to_float32(std::uint16_t h)
+        {
+            return half_bits_float(std::uint32_t(h)<<16);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief 16Bit floating point type
+    //!
+    //! Storage type for 16Bit floating point numbers. Such numbers are
+    //! typically used to keep large amounts of data in memory which do
+    //! not require the precision of float32. The encoding of the value
+    //! is determined by the FORMAT parameter (see binary16_format and
+    //! bfloat16_format).
+    //!
+    //! The type does not provide arithmetics by itself. An instance
+    //! converts implicitly to float32 and can be constructed from a
+    //! float32 value. Thus, all computations are done in single precision
+    //! and rounded when the result is stored.
+    /*!
+    \code
+    float16 a = 1.5f;
+    float16 b = a*2;   // computed as float32
+    float32 c = b;      // exact
+    \endcode
+    !*/
+    //!
+    //! As for the built-in floating point types the default constructor
+    //! leaves the value uninitialized.
+    //!
+    //! \tparam FORMAT encoding of the value
+    //!
+    template<typename FORMAT> class half_t
+    {
+        public:
+            //=================public data types===============================
+            //! encoding of the value
+            typedef FORMAT format_type;
+        private:
+            //! tag for the construction from the bit pattern
+            struct bits_tag {};
+
+            //! bit pattern of the value
+            std::uint16_t _bits;
+
+            //! construction from the bit pattern
+            constexpr half_t(std::uint16_t b,bits_tag):_bits(b) {}
+        public:
+            //=================constructors====================================
+            //! default constructor
+            half_t() = default;
+
+            //-----------------------------------------------------------------
+            //! conversion constructor
+            half_t(float v):_bits(format_type::from_float32(v)) {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construction from a bit pattern
+            //!
+            //! \param b bit pattern of the value
+            //! \return new instance
+            //!
+            static constexpr half_t from_bits(std::uint16_t b)
+            {
+                return half_t(b,bits_tag());
+            }
+
+            //=================conversion and access===========================
+            //! conversion operator
+            operator float() const
+            {
+                return format_type::to_float32(_bits);
+            }
+
+            //-----------------------------------------------------------------
+            //! get the bit pattern
+            constexpr std::uint16_t bits() const
+            {
+                return _bits;
+            }
+
+            //=================compound assignment=============================
+            //! add a value
+            half_t &operator+=(float v) { return *this = float(*this)+v; }
+
+            //! subtract a value
+            half_t &operator-=(float v) { return *this = float(*this)-v; }
+
+            //! multiply by a value
+            half_t &operator*=(float v) { return *this = float(*this)*v; }
+
+            //! divide by a value
+            half_t &operator/=(float v) { return *this = float(*this)/v; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief output operator for half_t
+    //!
+    //! \param stream output stream
+    //! \param h value to write
+    //! \return reference to the stream
+    //!
+    template<typename FORMAT>
+    std::ostream &operator<<(std::ostream &stream,const half_t<FORMAT> &h)
+    {
+        return stream<<float(h);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief input operator for half_t
+    //!
+    //! \param stream input stream
+    //! \param h value to read
+    //! \return reference to the stream
+    //!
+    template<typename FORMAT>
+    std::istream &operator>>(std::istream &stream,half_t<FORMAT> &h)
+    {
+        float v;
+        if(stream>>v) h = v;
+
+        return stream;
+    }
+
+//end of namespace
+}
+}
+
+namespace std{
+
+    //! \cond no_doc
+    template<typename FORMAT>
+    class numeric_limits<pni::core::half_t<FORMAT>>
+    {
+        private:
+            typedef pni::core::half_t<FORMAT> type;
+        public:
+            static constexpr bool is_specialized = true;
+            static constexpr bool is_signed = true;
+            static constexpr bool is_integer = false;
+            static constexpr bool is_exact = false;
+            static constexpr bool has_infinity = true;
+            static constexpr bool has_quiet_NaN = true;
+            static constexpr bool has_signaling_NaN = true;
+            static constexpr float_denorm_style has_denorm = denorm_present;
+            static constexpr bool has_denorm_loss = false;
+            static constexpr float_round_style round_style = round_to_nearest;
+            static constexpr bool is_iec559 = false;
+            static constexpr bool is_bounded = true;
+            static constexpr bool is_modulo = false;
+            static constexpr int digits = FORMAT::digits;
+            static constexpr int digits10 = FORMAT::digits10;
+            static constexpr int max_digits10 = FORMAT::max_digits10;
+            static constexpr int radix = 2;
+            static constexpr int min_exponent = FORMAT::min_exponent;
+            static constexpr int min_exponent10 = FORMAT::min_exponent10;
+            static constexpr int max_exponent = FORMAT::max_exponent;
+            static constexpr int max_exponent10 = FORMAT::max_exponent10;
+            static constexpr bool traps = false;
+            static constexpr bool tinyness_before = false;
+
+            static constexpr type min() noexcept
+            {
+                return type::from_bits(FORMAT::min_bits);
+            }
+
+            static constexpr type lowest() noexcept
+            {
+                return type::from_bits(FORMAT::max_bits|0x8000);
+            }
+
+            static constexpr type max() noexcept
+            {
+                return type::from_bits(FORMAT::max_bits);
+            }
+
+            static constexpr type epsilon() noexcept
+            {
+                return type::from_bits(FORMAT::epsilon_bits);
+            }
+
+            static constexpr type round_error() noexcept
+            {
+                return type::from_bits(FORMAT::round_error_bits);
+            }
+
+            static constexpr type infinity() noexcept
+            {
+                return type::from_bits(FORMAT::infinity_bits);
+            }
+
+            static constexpr type quiet_NaN() noexcept
+            {
+                return type::from_bits(FORMAT::nan_bits);
+            }
+
+            static constexpr type signaling_NaN() noexcept
+            {
+                return type::from_bits(FORMAT::infinity_bits|1);
+            }
+
+            static constexpr type denorm_min() noexcept
+            {
+                return type::from_bits(1);
+            }
+    };
+    //! \endcond
+}
@@ -72,6 +72,8 @@ namespace core{
     CREATE_ID_TYPE_MAP(type_id_t::INT32,int32);
     CREATE_ID_TYPE_MAP(type_id_t::UINT64,uint64);
     CREATE_ID_TYPE_MAP(type_id_t::INT64,int64);
+    CREATE_ID_TYPE_MAP(type_id_t::FLOAT16,float16);
+    CREATE_ID_TYPE_MAP(type_id_t::BFLOAT16,bfloat16);
     CREATE_ID_TYPE_MAP(type_id_t::FLOAT32,float32);
     CREATE_ID_TYPE_MAP(type_id_t::FLOAT64,float64);
     CREATE_ID_TYPE_MAP(type_id_t::FLOAT128,float128);
@@ -41,6 +41,8 @@ namespace core{
         generate_map_element<int16,checked_type_vectors>(),
         generate_map_element<int32,checked_type_vectors>(),
         generate_map_element<int64,checked_type_vectors>(),
+        generate_map_element<float16,checked_type_vectors>(),
+        generate_map_element<bfloat16,checked_type_vectors>(),
         generate_map_element<float32,checked_type_vectors>(),
         generate_map_element<float64,checked_type_vectors>(),
         generate_map_element<float128,checked_type_vectors>(),
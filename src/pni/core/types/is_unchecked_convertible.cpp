@@ -43,6 +43,8 @@ namespace core{
         generate_map_element<int16,unchecked_type_vectors>(),
         generate_map_element<int32,unchecked_type_vectors>(),
         generate_map_element<int64,unchecked_type_vectors>(),
+        generate_map_element<float16,unchecked_type_vectors>(),
+        generate_map_element<bfloat16,unchecked_type_vectors>(),
         generate_map_element<float32,unchecked_type_vectors>(),
         generate_map_element<float64,unchecked_type_vectors>(),
         generate_map_element<float128,unchecked_type_vectors>(),
@@ -64,6 +64,8 @@ namespace core{
     CREATE_TYPE_CLASS_MAP(uint64,type_class_t::INTEGER);
     CREATE_TYPE_CLASS_MAP(int64,type_class_t::INTEGER);
     
+    CREATE_TYPE_CLASS_MAP(float16,type_class_t::FLOAT);
+    CREATE_TYPE_CLASS_MAP(bfloat16,type_class_t::FLOAT);
     CREATE_TYPE_CLASS_MAP(float32,type_class_t::FLOAT);
     CREATE_TYPE_CLASS_MAP(float64,type_class_t::FLOAT);
     CREATE_TYPE_CLASS_MAP(float128,type_class_t::FLOAT);
@@ -0,0 +1,148 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/next.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/type_id_map.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief type dispatch over an MPL sequence
+    //!
+    //! Walks the MPL sequence from ITER to END and calls the apply() 
+    //! member template of the call object with the first type whose type 
+    //! ID matches the requested one. The comparisons are unrolled at 
+    //! compile time and inlined into the caller.
+    //!
+    //! \tparam ITER iterator to the actual type of the sequence
+    //! \tparam END iterator to the end of the sequence
+    //!
+    template<
+             typename ITER,
+             typename END
+            >
+    struct type_dispatcher
+    {
+        //! the actual type
+        typedef typename boost::mpl::deref<ITER>::type type;
+        //! dispatcher for the remaining types
+        typedef type_dispatcher<typename boost::mpl::next<ITER>::type,END> 
+                next_type;
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief dispatch the call
+        //!
+        //! \tparam CALL call object type
+        //! \param tid type ID to dispatch on
+        //! \param call the call object
+        //! \return the result of the call
+        //!
+        template<typename CALL>
+        static typename CALL::result_type 
+        apply(type_id_t tid,const CALL &call)
+        {
+            if(tid == type_id_map<type>::type_id)
+                return call.template apply<type>();
+
+            return next_type::apply(tid,call);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief end of the type dispatch
+    //!
+    //! The type ID was not found in the sequence.
+    //!
+    //! \tparam END iterator to the end of the sequence
+    //!
+    template<typename END> struct type_dispatcher<END,END>
+    {
+        //! 
+        //! \brief throw type_error
+        //!
+        //! \throws type_error as the type ID is not in the sequence
+        //!
+        template<typename CALL>
+        static typename CALL::result_type apply(type_id_t,const CALL &)
+        {
+            throw type_error(EXCEPTION_RECORD,
+                             "Type ID is not in the list of dispatched types!");
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief dispatch on a type ID
+    //!
+    //! Calls the apply() member template of call with the type from TYPES 
+    //! whose type ID is tid. This replaces a switch statement over all 
+    //! type IDs. The call object must provide a result_type and an apply() 
+    //! member template for every type in TYPES.
+    /*!
+    \code
+    struct size_call
+    {
+        typedef size_t result_type;
+        template<typename T> size_t apply() const { return sizeof(T); }
+    };
+
+    size_t s = dispatch_type_id<numeric_types>(type_id_t::INT16,size_call());
+    \endcode
+    !*/
+    //!
+    //! \throws type_error if tid does not belong to a type in TYPES
+    //! \tparam TYPES MPL sequence of types (like numeric_types)
+    //! \tparam CALL call object type
+    //! \param tid type ID to dispatch on
+    //! \param call call object 
+    //! \return result of the call
+    //!
+    template<
+             typename TYPES,
+             typename CALL
+            >
+    typename CALL::result_type dispatch_type_id(type_id_t tid,
+                                                const CALL &call)
+    {
+        typedef type_dispatcher<typename boost::mpl::begin<TYPES>::type,
+                                typename boost::mpl::end<TYPES>::type> 
+                dispatcher_type;
+
+        return dispatcher_type::apply(tid,call);
+    }
+
+//end of namespace
+}
+}
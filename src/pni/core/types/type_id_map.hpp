@@ -63,6 +63,8 @@ namespace core{
     CREATE_TYPE_ID_MAP(int32,type_id_t::INT32);
     CREATE_TYPE_ID_MAP(uint64,type_id_t::UINT64);
     CREATE_TYPE_ID_MAP(int64,type_id_t::INT64);
+    CREATE_TYPE_ID_MAP(float16,type_id_t::FLOAT16);
+    CREATE_TYPE_ID_MAP(bfloat16,type_id_t::BFLOAT16);
     CREATE_TYPE_ID_MAP(float32,type_id_t::FLOAT32);
     CREATE_TYPE_ID_MAP(float64,type_id_t::FLOAT64);
     CREATE_TYPE_ID_MAP(float128,type_id_t::FLOAT128);
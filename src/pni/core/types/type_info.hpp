@@ -223,6 +223,31 @@ namespace core{
 
     };
 
+    template<typename FORMAT>
+    struct type_info<half_t<FORMAT>>
+    {
+        typedef half_t<FORMAT> type;
+        typedef half_t<FORMAT> base_type;
+
+        static const size_t size = sizeof(type);
+        static const bool is_integer = false;
+        static const bool is_signed = true;
+        static const bool is_complex = false;
+
+        static bool is_negative(type value) { return value<0; }
+
+        static constexpr type min()
+        {
+            return std::numeric_limits<type>::lowest();
+        }
+
+        static constexpr type max()
+        {
+            return std::numeric_limits<type>::max();
+        }
+
+    };
+
     template<> struct type_info<binary>
     {
         typedef binary type;
@@ -47,6 +47,8 @@ namespace core{
      {"int32",type_id_t::INT32},{"i32",type_id_t::INT32},
      {"uint64",type_id_t::UINT64},{"ui64",type_id_t::UINT64},
      {"int64",type_id_t::INT64},{"i64",type_id_t::INT64},
+     {"float16",type_id_t::FLOAT16},{"f16",type_id_t::FLOAT16},
+     {"bfloat16",type_id_t::BFLOAT16},{"bf16",type_id_t::BFLOAT16},
      {"float32",type_id_t::FLOAT32},{"f32",type_id_t::FLOAT32},
      {"float64",type_id_t::FLOAT64},{"f64",type_id_t::FLOAT64},
      {"float128",type_id_t::FLOAT128},{"f128",type_id_t::FLOAT128},
@@ -71,6 +73,8 @@ namespace core{
      {type_id_t::UINT16,"uint16"}, {type_id_t::INT16,"int16"},
      {type_id_t::UINT32,"uint32"}, {type_id_t::INT32,"int32"},
      {type_id_t::UINT64,"uint64"}, {type_id_t::INT64,"int64"},
+     {type_id_t::FLOAT16,"float16"},
+     {type_id_t::BFLOAT16,"bfloat16"},
      {type_id_t::FLOAT32,"float32"},
      {type_id_t::FLOAT64,"float64"},
      {type_id_t::FLOAT128,"float128"},
@@ -39,6 +39,8 @@ namespace core{
 		if(tid==type_id_t::UINT32) {o<<"UINT32"; return o;}
 		if(tid==type_id_t::INT64) {o<<"INT64"; return o;}
 		if(tid==type_id_t::UINT64) {o<<"UINT64"; return o;}
+	    if(tid==type_id_t::FLOAT16) {o<<"FLOAT16"; return o;}
+	    if(tid==type_id_t::BFLOAT16) {o<<"BFLOAT16"; return o;}
 	    if(tid==type_id_t::FLOAT32) {o<<"FLOAT32"; return o;}
 	    if(tid==type_id_t::FLOAT64) {o<<"FLOAT64"; return o;}
 	    if(tid==type_id_t::FLOAT128) {o<<"FLOAT128"; return o;}
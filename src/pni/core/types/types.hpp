@@ -38,6 +38,7 @@ typedef SSIZE_T ssize_t;
 
 #include <pni/core/types/binary.hpp>
 #include <pni/core/types/bool.hpp>
+#include <pni/core/types/half.hpp>
 #include <pni/core/types/none.hpp>
 
 namespace pni{
@@ -61,6 +62,10 @@ namespace core{
     typedef double      float64;   //!< 64Bit IEEE floating point type
     typedef float       float32;   //!< 32Bit IEEE floating point type
     typedef long double float128;  //!< 128Bit IEEE floating point type
+    //! 16Bit IEEE floating point type
+    typedef half_t<binary16_format> float16;
+    //! 16Bit brain floating point type (upper half of a float32)
+    typedef half_t<bfloat16_format> bfloat16;
 
     //-----------------------complex types--------------------------------------
     //! 32Bit complex floating point type
@@ -96,7 +101,9 @@ namespace core{
     //!
     //! An MPL vector with all floating point types supported by libpnicore
     //!
-    typedef boost::mpl::vector<float32,
+    typedef boost::mpl::vector<float16,
+                               bfloat16,
+                               float32,
                                float64,
                                float128> float_types;
 
@@ -167,7 +174,9 @@ namespace core{
                           COMPLEX128, //!< 128Bit IEEE floating point complex
                           STRING,     //!< String type
                           BINARY,     //!< binary data
-                          BOOL        //!< boolean data
+                          BOOL,       //!< boolean data
+                          FLOAT16,    //!< 16Bit IEEE floating point
+                          BFLOAT16    //!< 16Bit brain floating point
                       };
 
     //! 
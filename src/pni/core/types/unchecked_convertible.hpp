@@ -45,6 +45,7 @@ namespace core{
                          uint8,
                          boost::mpl::vector<uint8,uint16,uint32,uint64,
                                             int16,int32,int64,
+                                            float16,bfloat16,
                                             float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
@@ -54,7 +55,7 @@ namespace core{
                          uint16,
                          boost::mpl::vector<uint16,uint32,uint64, 
                                             int32,int64,
-                                            float32,float64,float128,
+                                            bfloat16,float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
 
@@ -63,7 +64,7 @@ namespace core{
                          uint32,
                          boost::mpl::vector<uint32,uint64,
                                             int64,
-                                            float32,float64,float128,
+                                            bfloat16,float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
 
@@ -71,7 +72,7 @@ namespace core{
         boost::mpl::pair<
                          uint64,
                          boost::mpl::vector<uint64,
-                                            float32,float64,float128,
+                                            bfloat16,float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
 
@@ -79,6 +80,7 @@ namespace core{
         boost::mpl::pair<
                          int8,
                          boost::mpl::vector<int8,int16,int32,int64,
+                                            float16,bfloat16,
                                             float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
@@ -87,6 +89,7 @@ namespace core{
         boost::mpl::pair<
                          int16,
                          boost::mpl::vector<int16,int32,int64,
+                                            float16,bfloat16,
                                             float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
@@ -95,7 +98,7 @@ namespace core{
         boost::mpl::pair<
                          int32,
                          boost::mpl::vector<int32,int64,
-                                            float32,float64,float128,
+                                            bfloat16,float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
 
@@ -103,7 +106,20 @@ namespace core{
         boost::mpl::pair<
                          int64,
                          boost::mpl::vector<int64,
-                                            float32,float64,float128,
+                                            bfloat16,float32,float64,float128,
+                                            complex32,complex64,complex128>
+                       >,
+
+        //-------------------source type float16 and bfloat16-----------------
+        boost::mpl::pair<
+                         float16,
+                         boost::mpl::vector<float16,float32,float64,float128,
+                                            complex32,complex64,complex128>
+                       >,
+
+        boost::mpl::pair<
+                         bfloat16,
+                         boost::mpl::vector<bfloat16,float32,float64,float128,
                                             complex32,complex64,complex128>
                        >,
 
@@ -144,7 +160,10 @@ namespace core{
 
         boost::mpl::pair<bool_t,boost::mpl::vector<bool_t>>,
 
-        boost::mpl::pair<binary,boost::mpl::vector<binary>>
+        boost::mpl::pair<binary,boost::mpl::vector<binary>>,
+
+        //-------------------none cannot be converted-------------------------
+        boost::mpl::pair<none,boost::mpl::vector<>>
         > unchecked_type_vectors;
 
     //------------------------------------------------------------------------
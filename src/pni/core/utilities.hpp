@@ -25,5 +25,7 @@
 
 
 #include <pni/core/utilities/container_iterator.hpp>
+#include <pni/core/utilities/proxy_iterator.hpp>
 #include <pni/core/utilities/container_utils.hpp>
 #include <pni/core/utilities/service.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
@@ -0,0 +1,175 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <pni/core/types/types.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief iterator for containers with proxy references
+    //!
+    //! Random access iterator for containers whose [] operator returns a 
+    //! proxy object instead of a reference (for instance bitmask_array).
+    //! Dereferencing the iterator returns whatever the [] operator of the
+    //! container returns. The container must provide the \c value_type, 
+    //! \c reference, and \c const_reference types.
+    //!
+    //! \tparam ATYPE container type (const for read only access)
+    //!
+    template<typename ATYPE> class proxy_iterator
+    {
+        private:
+            typedef typename std::remove_const<ATYPE>::type container_type;
+            //! the container
+            ATYPE *_container;
+            //! the current linear index
+            ssize_t _index;
+        public:
+            //================public types=====================================
+            //! value type
+            typedef typename container_type::value_type value_type;
+            //! reference type 
+            typedef typename std::conditional<std::is_const<ATYPE>::value,
+                        typename container_type::const_reference,
+                        typename container_type::reference>::type reference;
+            //! pointer type - not supported
+            typedef void pointer;
+            //! difference type
+            typedef ssize_t difference_type;
+            //! iterator category
+            typedef std::random_access_iterator_tag iterator_category;
+            //! iterator type
+            typedef proxy_iterator<ATYPE> iterator_type;
+
+            //!
+            //! \brief constructor
+            //!
+            //! \param container pointer to the container
+            //! \param index linear index 
+            //!
+            proxy_iterator(ATYPE *container=nullptr,size_t index=0):
+                _container(container),
+                _index(index)
+            {}
+
+            //! dereference
+            reference operator*() const { return (*_container)[_index]; }
+
+            //! random access
+            reference operator[](ssize_t n) const 
+            { 
+                return (*_container)[_index+n]; 
+            }
+
+            //! increment
+            iterator_type &operator++() { ++_index; return *this; }
+
+            //! post increment
+            iterator_type operator++(int) 
+            { 
+                iterator_type t(*this); 
+                ++_index; 
+                return t; 
+            }
+
+            //! decrement
+            iterator_type &operator--() { --_index; return *this; }
+
+            //! post decrement
+            iterator_type operator--(int) 
+            { 
+                iterator_type t(*this); 
+                --_index; 
+                return t; 
+            }
+
+            //! advance
+            iterator_type &operator+=(ssize_t n) { _index += n; return *this; }
+
+            //! move back
+            iterator_type &operator-=(ssize_t n) { _index -= n; return *this; }
+
+            //! advanced copy
+            iterator_type operator+(ssize_t n) const 
+            { 
+                return iterator_type(_container,_index+n); 
+            }
+
+            //! moved back copy
+            iterator_type operator-(ssize_t n) const 
+            { 
+                return iterator_type(_container,_index-n); 
+            }
+
+            //! distance
+            ssize_t operator-(const iterator_type &i) const 
+            { 
+                return _index-i._index; 
+            }
+
+            //! equality
+            bool operator==(const iterator_type &i) const 
+            { 
+                return _container==i._container && _index==i._index; 
+            }
+
+            //! inequality
+            bool operator!=(const iterator_type &i) const 
+            { 
+                return !(*this==i);
+            }
+
+            //! less than
+            bool operator<(const iterator_type &i) const 
+            { 
+                return _index<i._index; 
+            }
+
+            //! greater than
+            bool operator>(const iterator_type &i) const 
+            { 
+                return _index>i._index; 
+            }
+
+            //! less than or equal
+            bool operator<=(const iterator_type &i) const 
+            { 
+                return _index<=i._index; 
+            }
+
+            //! greater than or equal
+            bool operator>=(const iterator_type &i) const 
+            { 
+                return _index>=i._index; 
+            }
+    };
+
+//end of namespace
+}
+}
@@ -0,0 +1,228 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <cstdlib>
+#include <pni/core/utilities/thread_pool.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! true for threads currently executing a task - used to run nested
+    //! jobs in the calling thread
+    //!
+    static thread_local bool in_pool_task = false;
+
+    //-------------------------------------------------------------------------
+    thread_pool::thread_pool(size_t nthreads):
+        _workers(),
+        _run_mutex(),
+        _mutex(),
+        _wakeup(),
+        _finished(),
+        _task(nullptr),
+        _ntasks(0),
+        _next(0),
+        _active(0),
+        _generation(0),
+        _stop(false),
+        _error()
+    {
+        start(nthreads);
+    }
+
+    //-------------------------------------------------------------------------
+    thread_pool::~thread_pool()
+    {
+        stop();
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::start(size_t nthreads)
+    {
+        _stop = false;
+        for(size_t i=1;i<nthreads;++i)
+            _workers.push_back(std::thread(&thread_pool::worker_loop,this,i,
+                                           _generation));
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wakeup.notify_all();
+
+        for(auto &worker: _workers) worker.join();
+        _workers.clear();
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::execute(size_t thread_index)
+    {
+        bool nested = in_pool_task;
+        in_pool_task = true;
+
+        auto call = [this](size_t index)
+        {
+            try
+            {
+                (*_task)(index);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if(!_error) _error = std::current_exception();
+            }
+        };
+
+        //with one task per thread every thread executes the task with its 
+        //own index - this keeps the assignment of data to threads stable
+        //across jobs
+        if(_ntasks == size())
+            call(thread_index);
+        else
+        {
+            size_t index;
+            while((index = _next++) < _ntasks) call(index);
+        }
+
+        in_pool_task = nested;
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::worker_loop(size_t index,size_t generation)
+    {
+
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeup.wait(lock,[this,generation]()
+                         { return _stop || _generation!=generation; });
+            if(_stop) return;
+            generation = _generation;
+            lock.unlock();
+
+            execute(index);
+
+            lock.lock();
+            if(--_active == 0) _finished.notify_one();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    size_t thread_pool::size() const
+    {
+        return _workers.size()+1;
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::resize(size_t nthreads)
+    {
+        std::lock_guard<std::mutex> lock(_run_mutex);
+        stop();
+        start(nthreads);
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::run(size_t ntasks,const task_type &task)
+    {
+        if(ntasks==0) return;
+
+        //run the tasks in the current thread if parallel execution would 
+        //not make sense or could dead-lock the pool
+        if(ntasks==1 || in_pool_task)
+        {
+            for(size_t i=0;i<ntasks;++i) task(i);
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(_run_mutex);
+        if(_workers.empty())
+        {
+            for(size_t i=0;i<ntasks;++i) task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _task   = &task;
+            _ntasks = ntasks;
+            _next   = 0;
+            _active = _workers.size();
+            _error  = std::exception_ptr();
+            ++_generation;
+        }
+        _wakeup.notify_all();
+
+        execute(0);
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _finished.wait(lock,[this](){ return _active==0; });
+        _task = nullptr;
+
+        if(_error)
+        {
+            std::exception_ptr error = _error;
+            _error = std::exception_ptr();
+            std::rethrow_exception(error);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    thread_pool &default_thread_pool()
+    {
+        static thread_pool pool([]() -> size_t
+        {
+            const char *env = std::getenv("PNICORE_NTHREADS");
+            if(env && std::atol(env)>0) return std::atol(env);
+
+            size_t n = std::thread::hardware_concurrency();
+            return n ? n : 1;
+        }());
+
+        return pool;
+    }
+
+    //-------------------------------------------------------------------------
+    //! threshold for parallel execution
+    static std::atomic<size_t> threshold(size_t(1)<<18);
+
+    //-------------------------------------------------------------------------
+    size_t parallel_threshold()
+    {
+        return threshold.load();
+    }
+
+    //-------------------------------------------------------------------------
+    void set_parallel_threshold(size_t n)
+    {
+        threshold.store(n);
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,215 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief simple thread pool
+    //!
+    //! The pool executes a number of independent tasks, identified by their
+    //! index, on a fixed set of worker threads. The thread calling run()
+    //! takes part in the work and returns only after all tasks have been
+    //! finished. 
+    /*!
+    \code
+    thread_pool pool(4);
+    std::vector<float64> data(1000000);
+
+    pool.run(4,[&data](size_t task)
+    {
+        size_t n = data.size()/4;
+        std::fill(data.begin()+task*n,data.begin()+(task+1)*n,1.);
+    });
+    \endcode
+    !*/
+    //!
+    //! Calls to run() from different threads are serialized. If run() is 
+    //! called from within a task the nested tasks are executed by the 
+    //! calling thread. Thus nested parallel algorithms cannot dead-lock the 
+    //! pool. If a task throws an exception the remaining tasks are still 
+    //! executed and the first exception is rethrown by run(). 
+    //!
+    //! If the number of tasks equals the number of threads, task i is 
+    //! always executed by thread i (the caller of run() being thread 0). 
+    //! Thus data initialized by a particular task (first touch) will be 
+    //! processed by the same thread in subsequent jobs with the same 
+    //! partitioning. Otherwise tasks are distributed dynamically.
+    //!
+    class PNICORE_EXPORT thread_pool
+    {
+        public:
+            //! task function type - the argument is the task index
+            typedef std::function<void(size_t)> task_type;
+
+        private:
+            //! worker threads 
+            std::vector<std::thread> _workers;
+            //! serializes calls to run() and resize()
+            std::mutex _run_mutex;
+            //! protects the job state
+            std::mutex _mutex;
+            //! wakes up the workers when a new job is available
+            std::condition_variable _wakeup;
+            //! notifies run() when all workers are done
+            std::condition_variable _finished;
+            //! task function of the current job
+            const task_type *_task;
+            //! number of tasks of the current job
+            size_t _ntasks;
+            //! index of the next task to execute
+            std::atomic<size_t> _next;
+            //! number of workers still working on the current job
+            size_t _active;
+            //! job counter
+            size_t _generation;
+            //! true if the workers should terminate
+            bool _stop;
+            //! first exception thrown by a task
+            std::exception_ptr _error;
+
+            //-----------------------------------------------------------------
+            //! start nthreads-1 worker threads
+            void start(size_t nthreads);
+
+            //-----------------------------------------------------------------
+            //! terminate and join all worker threads
+            void stop();
+
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief main loop of a worker thread
+            //!
+            //! \param index index of the thread
+            //! \param generation the last job the thread must not execute
+            //!
+            void worker_loop(size_t index,size_t generation);
+
+            //-----------------------------------------------------------------
+            //! execute tasks of the current job for thread index
+            void execute(size_t index);
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param nthreads total number of threads used to execute a job
+            //!                 (including the caller of run())
+            //!
+            explicit thread_pool(size_t nthreads);
+
+            //-----------------------------------------------------------------
+            //! destructor - joins all worker threads
+            ~thread_pool();
+
+            //-----------------------------------------------------------------
+            //! copy construction is not allowed
+            thread_pool(const thread_pool &) = delete;
+
+            //-----------------------------------------------------------------
+            //! copy assignment is not allowed
+            thread_pool &operator=(const thread_pool &) = delete;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief number of threads 
+            //!
+            //! \return total number of threads executing a job
+            //!
+            size_t size() const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief change the number of threads
+            //!
+            //! Waits until a running job has finished and restarts the pool
+            //! with the new number of threads. A value of 0 is treated as 1.
+            //!
+            //! \param nthreads new total number of threads
+            //!
+            void resize(size_t nthreads);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief run tasks
+            //!
+            //! Calls task(i) for every i in [0,ntasks) and blocks until all 
+            //! of them have finished. 
+            //!
+            //! \param ntasks number of tasks
+            //! \param task the task function
+            //!
+            void run(size_t ntasks,const task_type &task);
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief library wide thread pool
+    //!
+    //! Returns a reference to the thread pool used by the parallel 
+    //! algorithms of the library. The initial number of threads is taken 
+    //! from the environment variable PNICORE_NTHREADS. If it is not set 
+    //! the number of hardware threads is used. Use thread_pool::resize() to 
+    //! change the number of threads at runtime.
+    //!
+    //! \return reference to the thread pool
+    //!
+    PNICORE_EXPORT thread_pool &default_thread_pool();
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief get parallel threshold
+    //!
+    //! Parallel algorithms are only executed in parallel if the number of 
+    //! elements they work on is at least equal to this threshold. 
+    //!
+    //! \return current threshold in number of elements
+    //!
+    PNICORE_EXPORT size_t parallel_threshold();
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief set parallel threshold
+    //!
+    //! \param n new threshold in number of elements
+    //!
+    PNICORE_EXPORT void set_parallel_threshold(size_t n);
+
+//end of namespace
+}
+}
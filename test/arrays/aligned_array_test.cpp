@@ -0,0 +1,149 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<uint8,int16,int32,int64,float32,float64,float128,
+                         complex32,complex64,complex128> aligned_types;
+
+template<typename T> bool is_aligned(const T *ptr,size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr)%alignment == 0;
+}
+
+BOOST_AUTO_TEST_SUITE(aligned_array_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_alignment,T,aligned_types)
+    {
+        typedef aligned_dynamic_array<T> array_type;
+
+        for(auto s: {shape_t{1},shape_t{3,7},shape_t{17,31,5},shape_t{1000}})
+        {
+            auto a = array_type::create(s);
+            BOOST_CHECK(is_aligned(a.data(),64));
+            BOOST_CHECK_EQUAL(a.size(),
+                              std::accumulate(s.begin(),s.end(),size_t(1),
+                                              std::multiplies<size_t>()));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_value_initialization,T,aligned_types)
+    {
+        //like std::vector the elements are value initialized
+        aligned_vector<T> v(1000);
+        BOOST_CHECK(std::all_of(v.begin(),v.end(),[](T x){ return x==T(); }));
+
+        v.resize(5000);
+        BOOST_CHECK(std::all_of(v.begin(),v.end(),[](T x){ return x==T(); }));
+
+        default_init_vector<T> d(1000);
+        BOOST_CHECK_EQUAL(d.size(),1000u);
+        BOOST_CHECK(is_aligned(d.data(),64));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_custom_alignment)
+    {
+        typedef aligned_fixed_dim_array<float64,2,4096> array_type;
+
+        auto a = array_type::create(shape_t{10,10});
+        BOOST_CHECK(is_aligned(a.data(),4096));
+        BOOST_CHECK_EQUAL(a.rank(),2u);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_factory)
+    {
+        typedef aligned_dynamic_array<int32> array_type;
+        typedef array_type::storage_type storage_type;
+
+        auto a = array_factory<array_type>::create(shape_t{4,5},int32(7));
+        BOOST_CHECK(is_aligned(a.data(),64));
+        for(auto v: a) BOOST_CHECK_EQUAL(v,7);
+
+        auto b = array_factory<array_type>::create({2,2},{1,2,3,4});
+        BOOST_CHECK(is_aligned(b.data(),64));
+        BOOST_CHECK_EQUAL(b(1,1),4);
+
+        auto c = container_utils<storage_type>::create(100,int32(3));
+        BOOST_CHECK_EQUAL(c.size(),100u);
+        BOOST_CHECK(is_aligned(c.data(),64));
+        for(auto v: c) BOOST_CHECK_EQUAL(v,3);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_arithmetics)
+    {
+        typedef aligned_dynamic_array<float64> array_type;
+        shape_t s{13,17};
+
+        auto a = array_factory<array_type>::create(s,1.5);
+        auto b = array_factory<array_type>::create(s,2.0);
+        auto c = array_type::create(s);
+
+        c = a*b+a;
+        for(auto v: c) BOOST_CHECK_CLOSE(v,4.5,1.e-12);
+
+        c += b;
+        for(auto v: c) BOOST_CHECK_CLOSE(v,6.5,1.e-12);
+
+        //copies preserve the alignment
+        array_type d(c);
+        BOOST_CHECK(is_aligned(d.data(),64));
+        BOOST_CHECK(std::equal(c.begin(),c.end(),d.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_huge_pages)
+    {
+        typedef hugepage_dynamic_array<float32> array_type;
+
+        //small arrays only need the default alignment
+        auto a = array_type::create(shape_t{10});
+        BOOST_CHECK(is_aligned(a.data(),64));
+
+        //large arrays are aligned to the huge page size
+        auto b = array_factory<array_type>::create(shape_t{1024,1024},1.f);
+        BOOST_CHECK(is_aligned(b.data(),huge_page_size));
+        BOOST_CHECK_EQUAL(b.size(),1024u*1024u);
+        BOOST_CHECK_EQUAL(b[b.size()-1],1.f);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
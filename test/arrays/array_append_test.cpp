@@ -0,0 +1,159 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<dynamic_array<int32>,
+                         dynamic_array<float64>,
+                         fixed_dim_array<uint16,3>,
+                         aligned_dynamic_array<float32>
+                        > growable_arrays;
+
+template<typename AT> 
+dynamic_array<typename AT::value_type> create_frame(size_t index)
+{
+    typedef typename AT::value_type value_type;
+    auto frame = dynamic_array<value_type>::create(shape_t{3,5});
+    std::iota(frame.begin(),frame.end(),value_type(index*100));
+    return frame;
+}
+
+BOOST_AUTO_TEST_SUITE(array_append_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_append,AT,growable_arrays)
+    {
+        typedef typename AT::value_type value_type;
+        auto stack = AT::create(shape_t{0,3,5});
+        BOOST_CHECK_EQUAL(stack.size(),0u);
+
+        for(size_t n=0;n<20;++n)
+        {
+            stack.append(create_frame<AT>(n));
+            auto shape = stack.template shape<shape_t>();
+            BOOST_CHECK(shape==shape_t({n+1,3,5}));
+            BOOST_CHECK_EQUAL(stack.size(),(n+1)*15);
+            BOOST_CHECK(stack.capacity()>n);
+        }
+
+        for(size_t n=0;n<20;++n)
+            for(size_t i=0;i<3;++i)
+                for(size_t j=0;j<5;++j)
+                    BOOST_CHECK_EQUAL(stack(n,i,j),value_type(n*100+i*5+j));
+
+        //append a view
+        auto view = stack(3,slice(0,3),slice(0,5));
+        stack.append(view);
+        BOOST_CHECK_EQUAL(stack(20,2,4),value_type(314));
+
+        BOOST_CHECK_THROW(stack.append(std::vector<value_type>(14)),
+                          size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_capacity,AT,growable_arrays)
+    {
+        auto stack = AT::create(shape_t{0,3,5});
+        stack.reserve(10);
+        BOOST_CHECK(stack.capacity()>=10);
+        BOOST_CHECK_EQUAL(stack.size(),0u);
+
+        //no reallocation within the reserved capacity
+        stack.append(create_frame<AT>(0));
+        auto ptr = stack.data();
+        for(size_t n=1;n<10;++n) stack.append(create_frame<AT>(n));
+        BOOST_CHECK_EQUAL(stack.data(),ptr);
+
+        //geometric growth 
+        size_t reallocations = 0;
+        size_t capacity = stack.capacity();
+        for(size_t n=10;n<1000;++n) 
+        {
+            stack.append(create_frame<AT>(n));
+            if(stack.capacity()!=capacity) 
+            {
+                BOOST_CHECK(stack.capacity()>=2*capacity);
+                capacity = stack.capacity();
+                ++reallocations;
+            }
+        }
+        BOOST_CHECK(reallocations<=7);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_resize,AT,growable_arrays)
+    {
+        typedef typename AT::value_type value_type;
+        auto stack = AT::create(shape_t{2,3,5});
+        std::iota(stack.begin(),stack.end(),value_type(0));
+
+        stack.resize(4);
+        BOOST_CHECK(stack.template shape<shape_t>()==shape_t({4,3,5}));
+        BOOST_CHECK_EQUAL(stack(1,2,4),value_type(29));
+        BOOST_CHECK_EQUAL(stack(3,2,4),value_type(0));
+
+        stack.resize(1);
+        BOOST_CHECK_EQUAL(stack.size(),15u);
+        BOOST_CHECK_EQUAL(stack(0,2,4),value_type(14));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        auto stack = dynamic_array<int32>::create(shape_t{1,3,5});
+        std::fill(stack.begin(),stack.end(),-1);
+        auto first = stack(0,slice(0,3),slice(0,5));
+
+        //views survive reallocation and keep their shape 
+        for(size_t n=1;n<100;++n) 
+            stack.append(create_frame<dynamic_array<int32>>(n));
+        BOOST_CHECK_EQUAL(first.size(),15u);
+        for(auto v: first) BOOST_CHECK_EQUAL(v,-1);
+
+        auto last = stack(99,slice(0,3),slice(0,5));
+        BOOST_CHECK_EQUAL(last(2,4),9914);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        dynamic_array<int32> empty;
+        BOOST_CHECK_THROW(empty.append(std::vector<int32>(1)),
+                          shape_mismatch_error);
+        BOOST_CHECK_THROW(empty.resize(2),shape_mismatch_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
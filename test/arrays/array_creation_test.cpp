@@ -0,0 +1,120 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <thread>
+#include <mutex>
+#include <set>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<dynamic_array<int32>,
+                         dynamic_array<float64>,
+                         fixed_dim_array<uint16,2>,
+                         aligned_dynamic_array<float32>,
+                         aligned_fixed_dim_array<int64,2>,
+                         default_init_dynamic_array<float64>
+                        > creation_arrays;
+
+struct array_creation_fixture
+{
+    size_t nthreads;
+    size_t threshold;
+
+    array_creation_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold())
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+    }
+
+    ~array_creation_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(array_creation_test,array_creation_fixture)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_uninitialized,AT,creation_arrays)
+    {
+        typedef array_factory<AT> factory_type;
+
+        auto a = factory_type::create(shape_t{37,41},uninitialized_creation());
+        BOOST_CHECK_EQUAL(a.size(),37u*41u);
+        BOOST_CHECK_EQUAL(a.rank(),2u);
+
+        auto b = AT::create(shape_t{3,4},uninitialized_creation());
+        BOOST_CHECK_EQUAL(b.size(),12u);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_first_touch,AT,creation_arrays)
+    {
+        typedef array_factory<AT> factory_type;
+        typedef typename AT::value_type value_type;
+
+        auto a = factory_type::create(shape_t{37,41},first_touch_creation(),
+                                      value_type(3));
+        BOOST_CHECK_EQUAL(a.size(),37u*41u);
+        for(auto v: a) BOOST_CHECK_EQUAL(v,value_type(3));
+
+        auto b = factory_type::create(shape_t{5,7},first_touch_creation());
+        for(auto v: b) BOOST_CHECK_EQUAL(v,value_type(0));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_first_touch_threads)
+    {
+        typedef default_init_dynamic_array<float64> array_type;
+        typedef array_factory<array_type> factory_type;
+
+        auto a = factory_type::create(shape_t{256,1024},first_touch_creation());
+
+        //the chunks used for initialization are the ones used by the 
+        //parallel algorithms - each is processed by its own thread
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+        parallel_for_chunks(a,[&](size_t,size_t)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        });
+        BOOST_CHECK_EQUAL(threads.size(),4u);
+        BOOST_CHECK(std::all_of(a.begin(),a.end(),
+                                [](float64 v){ return v==0.; }));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
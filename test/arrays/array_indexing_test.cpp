@@ -0,0 +1,184 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<dynamic_array<int32>,
+                         dynamic_array<uint16>,
+                         dynamic_array<float32>,
+                         dynamic_array<float64>,
+                         fixed_dim_array<uint64,2>
+                        > indexing_array_types;
+
+struct array_indexing_fixture
+{
+    size_t nthreads;
+    size_t threshold;
+
+    array_indexing_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold())
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+    }
+
+    ~array_indexing_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+};
+
+template<typename AT> AT create_array(const shape_t &shape)
+{
+    auto a = AT::create(shape);
+    for(size_t i=0;i<a.size();++i) a[i] = i%1000;
+    return a;
+}
+
+BOOST_FIXTURE_TEST_SUITE(array_indexing_test,array_indexing_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_take,AT,indexing_array_types)
+    {
+        auto a = create_array<AT>(shape_t{37,45});
+
+        std::vector<size_t> indices{0,44,45,1664,3,3};
+        auto values = take(a,indices);
+        BOOST_CHECK_EQUAL(values.rank(),1u);
+        BOOST_REQUIRE_EQUAL(values.size(),indices.size());
+        for(size_t i=0;i<indices.size();++i)
+            BOOST_CHECK_EQUAL(values[i],a[indices[i]]);
+
+        //a lookup table keeps its shape - here the image is transposed
+        auto lut = dynamic_array<uint32>::create(shape_t{45,37});
+        for(size_t i=0;i<45;++i)
+            for(size_t j=0;j<37;++j) lut(i,j) = j*45+i;
+
+        auto t = take(a,lut);
+        BOOST_CHECK(t.template shape<shape_t>()==shape_t({45,37}));
+        for(size_t i=0;i<45;++i)
+            for(size_t j=0;j<37;++j) 
+                BOOST_CHECK_EQUAL(t(i,j),a(j,i));
+
+        //reuse an existing result
+        auto r = AT::create(shape_t{45,37});
+        take(a,lut,r);
+        BOOST_CHECK(std::equal(r.begin(),r.end(),t.begin()));
+
+        indices.push_back(a.size());
+        BOOST_CHECK_THROW(take(a,indices),index_error);
+        BOOST_CHECK_THROW(take(a,lut,values),size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_take_view)
+    {
+        auto a = create_array<dynamic_array<float64>>(shape_t{4,37,45});
+        auto view = a(slice(0,4),5,slice(0,45,2));
+
+        std::vector<int32> indices{0,22,23,91};
+        auto values = take(view,indices);
+        for(size_t i=0;i<indices.size();++i)
+            BOOST_CHECK_EQUAL(values[i],view[indices[i]]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_put,AT,indexing_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        auto a = create_array<AT>(shape_t{37,45});
+        auto orig = a;
+
+        std::vector<size_t> indices{1,17,900,1664,17};
+        std::vector<value_type> values{10,11,12,13,14};
+        put(a,indices,values);
+
+        BOOST_CHECK_EQUAL(a[1],value_type(10));
+        BOOST_CHECK_EQUAL(a[900],value_type(12));
+        BOOST_CHECK_EQUAL(a[1664],value_type(13));
+        //the last value for an index wins
+        BOOST_CHECK_EQUAL(a[17],value_type(14));
+        BOOST_CHECK_EQUAL(a[2],orig[2]);
+
+        put(a,indices,value_type(3));
+        for(auto i: indices) BOOST_CHECK_EQUAL(a[i],value_type(3));
+
+        //put to a view
+        auto view = a(slice(0,37),slice(1,3));
+        put(view,std::vector<size_t>{0,73},value_type(99));
+        BOOST_CHECK_EQUAL(a(0,1),value_type(99));
+        BOOST_CHECK_EQUAL(a(36,2),value_type(99));
+
+        values.pop_back();
+        BOOST_CHECK_THROW(put(a,indices,values),size_mismatch_error);
+        indices = {a.size()};
+        BOOST_CHECK_THROW(put(a,indices,value_type(1)),index_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_compress,AT,indexing_array_types)
+    {
+        auto a = create_array<AT>(shape_t{37,45});
+        auto mask = dynamic_array<bool_t>::create(shape_t{37,45});
+        for(size_t i=0;i<mask.size();++i) mask[i] = (i%3==0) || (i%7==1);
+
+        auto values = compress(a,mask);
+        BOOST_CHECK_EQUAL(values.size(),mask_count(mask));
+
+        size_t k = 0;
+        for(size_t i=0;i<a.size();++i)
+            if(mask[i]) BOOST_CHECK_EQUAL(values[k++],a[i]);
+
+        //compress and masked assignment are inverse operations
+        auto b = AT::create(shape_t{37,45});
+        std::fill(b.begin(),b.end(),0);
+        b[mask] = values;
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(b[i],mask[i] ? a[i] : 0);
+
+        //non-contiguous view and mask 
+        auto view = a(slice(0,37,2),slice(0,45));
+        auto vmask = mask(slice(0,37,2),slice(0,45));
+        auto vvalues = compress(view,vmask);
+        k = 0;
+        for(size_t i=0;i<view.size();++i)
+            if(vmask[i]) BOOST_CHECK_EQUAL(vvalues[k++],view[i]);
+        BOOST_CHECK_EQUAL(k,vvalues.size());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,209 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef dynamic_array<int32> array_type;
+
+struct array_segment_fixture
+{
+    array_type data;
+
+    array_segment_fixture():
+        data(array_type::create(shape_t{6,7,8}))
+    {
+        std::iota(data.begin(),data.end(),0);
+    }
+};
+
+//
+// the segments must enumerate the elements of a view in order
+//
+template<typename VTYPE> void check_segments(const VTYPE &view)
+{
+    size_t index = 0;
+    const int32 *ptr = view.array().data();
+    for(auto s: view.segments())
+        for(size_t i=0;i<s.size;++i,++index)
+            BOOST_CHECK_EQUAL(ptr[s.offset+i*s.stride],view[index]);
+
+    BOOST_CHECK_EQUAL(index,view.size());
+}
+
+BOOST_AUTO_TEST_SUITE(array_segment_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_make_segments)
+    {
+        auto segs = make_segments(22,shape_t{3,4},shape_t{10,1});
+        BOOST_CHECK_EQUAL(segs.size(),3u);
+        for(size_t i=0;i<segs.size();++i)
+        {
+            BOOST_CHECK_EQUAL(segs[i].offset,22+10*i);
+            BOOST_CHECK_EQUAL(segs[i].size,4u);
+            BOOST_CHECK_EQUAL(segs[i].stride,1u);
+        }
+
+        //chained strides are merged to a single segment
+        segs = make_segments(5,shape_t{3,4},shape_t{8,2});
+        BOOST_CHECK_EQUAL(segs.size(),1u);
+        BOOST_CHECK_EQUAL(segs[0].offset,5u);
+        BOOST_CHECK_EQUAL(segs[0].size,12u);
+        BOOST_CHECK_EQUAL(segs[0].stride,2u);
+
+        //dimensions with a single element are ignored
+        segs = make_segments(0,shape_t{3,1},shape_t{5,1});
+        BOOST_CHECK_EQUAL(segs.size(),1u);
+        BOOST_CHECK_EQUAL(segs[0].size,3u);
+        BOOST_CHECK_EQUAL(segs[0].stride,5u);
+
+        //empty and scalar layouts
+        BOOST_CHECK(make_segments(0,shape_t{3,0},shape_t{1,1}).empty());
+        segs = make_segments(7,shape_t(),shape_t());
+        BOOST_CHECK_EQUAL(segs.size(),1u);
+        BOOST_CHECK_EQUAL(segs[0].offset,7u);
+        BOOST_CHECK_EQUAL(segs[0].size,1u);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_segments)
+    {
+        array_segment_fixture f;
+
+        auto contiguous = f.data(2,slice(0,7),slice(0,8));
+        BOOST_CHECK_EQUAL(contiguous.segments().size(),1u);
+        check_segments(contiguous);
+
+        auto roi = f.data(slice(1,5),slice(2,6),slice(1,7));
+        auto segs = roi.segments();
+        BOOST_CHECK_EQUAL(segs.size(),16u);
+        BOOST_CHECK_EQUAL(segs[0].offset,f.data.map().offset(shape_t{1,2,1}));
+        BOOST_CHECK_EQUAL(segs[0].size,6u);
+        check_segments(roi);
+
+        //full rows are merged
+        auto rows = f.data(slice(0,6),slice(1,4),slice(0,8));
+        BOOST_CHECK_EQUAL(rows.segments().size(),6u);
+        BOOST_CHECK_EQUAL(rows.segments()[0].size,24u);
+        check_segments(rows);
+
+        auto strided = f.data(slice(0,6,2),3,slice(1,8,3));
+        BOOST_CHECK_EQUAL(strided.segments()[0].stride,3u);
+        check_segments(strided);
+
+        auto scalar = f.data(slice(4,5),2,slice(3,4));
+        BOOST_CHECK_EQUAL(scalar.segments().size(),1u);
+        check_segments(scalar);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_selection_segments)
+    {
+        array_segment_fixture f;
+        auto view = f.data(slice(1,5),slice(2,6,2),slice(1,7));
+
+        auto s1 = view.segments();
+        auto s2 = segments(f.data.map(),
+                           array_selection::create(
+                               std::vector<slice>{slice(1,5),slice(2,6,2),
+                                                  slice(1,7)}));
+        BOOST_REQUIRE_EQUAL(s1.size(),s2.size());
+        for(size_t i=0;i<s1.size();++i)
+        {
+            BOOST_CHECK_EQUAL(s1[i].offset,s2[i].offset);
+            BOOST_CHECK_EQUAL(s1[i].size,s2[i].size);
+            BOOST_CHECK_EQUAL(s1[i].stride,s2[i].stride);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_to_array)
+    {
+        array_segment_fixture f;
+        auto view = f.data(slice(1,5),slice(2,6),slice(1,7,2));
+
+        array_type roi(view);
+        BOOST_CHECK_EQUAL(roi.size(),view.size());
+        for(size_t i=0;i<view.size();++i)
+            BOOST_CHECK_EQUAL(roi[i],view[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_array_to_view)
+    {
+        array_segment_fixture f;
+        auto orig = array_type(f.data);
+        auto view = f.data(slice(1,5),3,slice(2,6));
+        auto a = array_type::create(shape_t{4,4});
+        std::iota(a.begin(),a.end(),-100);
+
+        view = a;
+        for(size_t i=0;i<6;++i)
+            for(size_t j=0;j<7;++j)
+                for(size_t k=0;k<8;++k)
+                {
+                    if(i>=1 && i<5 && j==3 && k>=2 && k<6)
+                        BOOST_CHECK_EQUAL(f.data(i,j,k),a(i-1,k-2));
+                    else
+                        BOOST_CHECK_EQUAL(f.data(i,j,k),orig(i,j,k));
+                }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_to_view)
+    {
+        array_segment_fixture f;
+        const array_type &data = f.data;
+        auto b = array_type::create(shape_t{4,12});
+        std::fill(b.begin(),b.end(),-1);
+
+        //source and destination are partitioned differently
+        const auto src = data(slice(0,6,2),slice(1,5),slice(2,6));
+        auto dest = b(slice(0,4),slice(0,12));
+        dest = src;
+        for(size_t i=0;i<src.size();++i)
+            BOOST_CHECK_EQUAL(b[i],src[i]);
+
+        //strided destination
+        std::fill(b.begin(),b.end(),-1);
+        auto sdest = b(slice(0,4),slice(0,12,3));
+        sdest = data(1,slice(0,4),slice(1,5));
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<12;++j)
+                BOOST_CHECK_EQUAL(b(i,j),j%3 ? -1 : f.data(1,i,1+j/3));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
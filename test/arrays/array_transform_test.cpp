@@ -0,0 +1,227 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef dynamic_array<int32> array_type;
+typedef mdarray<std::vector<int32>,dynamic_findex_map> farray_type;
+
+struct array_transform_fixture
+{
+    array_type data;
+
+    array_transform_fixture():
+        data(array_type::create(shape_t{4,5,6}))
+    {
+        std::iota(data.begin(),data.end(),0);
+    }
+
+    array_view<array_type> full()
+    {
+        return data(slice(0,4),slice(0,5),slice(0,6));
+    }
+};
+
+//
+// the iterators, the segments, and the linear index must agree
+//
+template<typename VTYPE> void check_view(const VTYPE &view)
+{
+    size_t index = 0;
+    for(auto iter = view.begin();iter!=view.end();++iter,++index)
+        BOOST_CHECK_EQUAL(*iter,view[index]);
+    BOOST_CHECK_EQUAL(index,view.size());
+
+    auto iter = view.end();
+    while(iter!=view.begin())
+        BOOST_CHECK_EQUAL(*(--iter),view[--index]);
+
+    const int32 *ptr = view.array().data();
+    for(auto seg: view.segments())
+        for(size_t i=0;i<seg.size;++i,++index)
+            BOOST_CHECK_EQUAL(ptr[seg.offset+ssize_t(i)*seg.stride],view[index]);
+    BOOST_CHECK_EQUAL(index,view.size());
+
+    //copy to a new array
+    typedef typename std::remove_const<typename VTYPE::storage_type>::type 
+            result_type;
+    result_type copy(view);
+    BOOST_CHECK(std::equal(copy.begin(),copy.end(),view.begin()));
+}
+
+BOOST_FIXTURE_TEST_SUITE(array_transform_test,array_transform_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_permute)
+    {
+        auto p = full().permute(shape_t{2,0,1});
+        auto s = p.shape<shape_t>();
+        BOOST_CHECK_EQUAL(p.rank(),3u);
+        BOOST_CHECK(s == (shape_t{6,4,5}));
+        BOOST_CHECK(!p.is_contiguous());
+        BOOST_CHECK_EQUAL(p.run_length(),1u);
+
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<6;++k)
+                    BOOST_CHECK_EQUAL(p(k,i,j),data(i,j,k));
+        check_view(p);
+
+        //the identity is still contiguous 
+        BOOST_CHECK(full().permute(shape_t{0,1,2}).is_contiguous());
+
+        //permuting a region of interest
+        auto roi = data(slice(1,3),2,slice(1,6,2)).permute(shape_t{1,0});
+        BOOST_CHECK(roi.shape<shape_t>() == (shape_t{3,2}));
+        for(size_t i=0;i<2;++i)
+            for(size_t k=0;k<3;++k)
+                BOOST_CHECK_EQUAL(roi(k,i),data(1+i,2,1+2*k));
+        check_view(roi);
+
+        BOOST_CHECK_THROW(full().permute(shape_t{1,0}),shape_mismatch_error);
+        BOOST_CHECK_THROW(full().permute(shape_t{0,1,1}),shape_mismatch_error);
+        BOOST_CHECK_THROW(full().permute(shape_t{0,1,3}),index_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_transpose)
+    {
+        auto image = data(2,slice(0,5),slice(0,6));
+        auto t = image.transpose();
+        BOOST_CHECK(t.shape<shape_t>() == (shape_t{6,5}));
+        for(size_t i=0;i<5;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(t(j,i),image(i,j));
+        check_view(t);
+
+        //transposing twice gives the original layout
+        auto tt = t.transpose();
+        BOOST_CHECK(tt.is_contiguous());
+        BOOST_CHECK(std::equal(tt.begin(),tt.end(),image.begin()));
+
+        //a large transpose is copied in blocks
+        auto a = array_type::create(shape_t{70,100});
+        std::iota(a.begin(),a.end(),0);
+        array_type b(a(slice(0,70),slice(0,100)).transpose());
+        for(size_t i=0;i<70;++i)
+            for(size_t j=0;j<100;++j)
+                BOOST_CHECK_EQUAL(b(j,i),a(i,j));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_flip)
+    {
+        auto f = full().flip(0);
+        BOOST_CHECK_EQUAL(f.strides()[0],-30);
+        BOOST_CHECK(!f.is_contiguous());
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<6;++k)
+                    BOOST_CHECK_EQUAL(f(i,j,k),data(3-i,j,k));
+        check_view(f);
+
+        //the fastest dimension runs backwards through memory
+        auto r = full().flip(2);
+        BOOST_CHECK_EQUAL(r.segments()[0].stride,-1);
+        BOOST_CHECK_EQUAL(r[0],data(0,0,5));
+        check_view(r);
+
+        //flip and transpose 
+        auto rot = data(1,slice(0,5),slice(0,6)).transpose().flip(1);
+        for(size_t i=0;i<5;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(rot(j,4-i),data(1,i,j));
+        check_view(rot);
+
+        BOOST_CHECK_THROW(full().flip(3),index_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_reshape)
+    {
+        auto frames = data(slice(1,3),slice(0,5),slice(0,6));
+        auto r = frames.reshape(shape_t{10,6});
+        BOOST_CHECK(r.is_contiguous());
+        BOOST_CHECK_EQUAL(r.data(),frames.data());
+        BOOST_CHECK_EQUAL(r.rank(),2u);
+        for(size_t i=0;i<10;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(r(i,j),data(1+i/5,i%5,j));
+        check_view(r);
+
+        auto flat = full().reshape(shape_t{120});
+        BOOST_CHECK(std::equal(flat.begin(),flat.end(),data.begin()));
+
+        BOOST_CHECK_THROW(frames.reshape(shape_t{10,5}),size_mismatch_error);
+        BOOST_CHECK_THROW(data(slice(0,4),slice(0,5),slice(0,3)).reshape(
+                          shape_t{60}),shape_mismatch_error);
+        BOOST_CHECK_THROW(full().transpose().reshape(shape_t{120}),
+                          shape_mismatch_error);
+
+        //reshape of a Fortran ordered array keeps the first index fastest
+        auto fa = farray_type::create(shape_t{4,6});
+        std::iota(fa.begin(),fa.end(),0);
+        auto fr = fa(slice(0,4),slice(0,6)).reshape(shape_t{2,12});
+        BOOST_CHECK(fr.is_contiguous());
+        for(size_t i=0;i<2;++i)
+            for(size_t j=0;j<12;++j)
+                BOOST_CHECK_EQUAL(fr(i,j),int32(i+2*j));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_assignment)
+    {
+        auto b = array_type::create(shape_t{6,4,5});
+        std::iota(b.begin(),b.end(),-200);
+
+        //write through a permuted view
+        auto p = full().permute(shape_t{2,0,1});
+        p = b;
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<6;++k)
+                    BOOST_CHECK_EQUAL(data(i,j,k),b(k,i,j));
+
+        //write through a flipped view 
+        auto f = data(0,slice(0,5),slice(0,6)).flip(1);
+        auto c = array_type::create(shape_t{5,6});
+        std::iota(c.begin(),c.end(),0);
+        f = c;
+        for(size_t i=0;i<5;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(data(0,i,5-j),c(i,j));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
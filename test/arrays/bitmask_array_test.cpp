@@ -0,0 +1,355 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<int8,uint8,int16,uint16,int32,uint32,int64,uint64,
+                         float32,float64> threshold_types;
+
+//
+// the shape (37,45) does not fill the last mask word. The algorithms run 
+// with 4 threads.
+//
+struct bitmask_array_fixture
+{
+    size_t nthreads;
+    size_t threshold;
+    dynamic_array<bool_t> bytes;
+    bitmask_array mask;
+
+    bitmask_array_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold()),
+        bytes(dynamic_array<bool_t>::create(shape_t{37,45})),
+        mask(bitmask_array::create(shape_t{37,45}))
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+
+        for(size_t i=0;i<bytes.size();++i) 
+            mask[i] = bytes[i] = (i*7)%5<2;
+    }
+
+    ~bitmask_array_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+
+    size_t count() const
+    {
+        return std::count_if(bytes.begin(),bytes.end(),
+                             [](bool_t v) { return bool(v); });
+    }
+};
+
+//
+// the bits beyond the last element must be zero
+//
+void check_padding(const bitmask_array &m)
+{
+    size_t n = m.size()%64;
+    if(n) BOOST_CHECK_EQUAL(m.words()[m.nwords()-1]>>n,0u);
+}
+
+template<typename T> 
+dynamic_array<T> create_data(const shape_t &shape)
+{
+    auto a = dynamic_array<T>::create(shape);
+    for(size_t i=0;i<a.size();++i) a[i] = T((i*13)%97);
+    return a;
+}
+
+template<
+         typename ATYPE,
+         typename COMP
+        >
+void check_threshold(const ATYPE &a,const typename ATYPE::value_type &t,
+                     COMP comp)
+{
+    auto m = threshold_mask(a,t,comp);
+    BOOST_REQUIRE_EQUAL(m.size(),a.size());
+    check_padding(m);
+    for(size_t i=0;i<a.size();++i)
+        BOOST_CHECK_EQUAL(m[i],comp(a[i],t));
+}
+
+BOOST_FIXTURE_TEST_SUITE(bitmask_array_test,bitmask_array_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_creation)
+    {
+        auto m = bitmask_array::create(shape_t{5,13});
+        BOOST_CHECK_EQUAL(m.size(),65u);
+        BOOST_CHECK_EQUAL(m.rank(),2u);
+        BOOST_CHECK_EQUAL(m.nwords(),2u);
+        BOOST_CHECK(m.shape<shape_t>()==(shape_t{5,13}));
+        BOOST_CHECK_EQUAL(m.count(),0u);
+        BOOST_CHECK(!m.any());
+
+        m = bitmask_array::create(shape_t{5,13},true);
+        BOOST_CHECK_EQUAL(m.count(),65u);
+        BOOST_CHECK(m.all());
+        check_padding(m);
+
+        m.fill(false);
+        BOOST_CHECK(!m.any());
+        m.flip();
+        BOOST_CHECK(m.all());
+        check_padding(m);
+
+        bitmask_array empty;
+        BOOST_CHECK_EQUAL(empty.size(),0u);
+        BOOST_CHECK_EQUAL(empty.count(),0u);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_access)
+    {
+        BOOST_CHECK_EQUAL(mask.count(),count());
+        BOOST_CHECK_EQUAL(mask_count(mask),count());
+
+        for(size_t i=0;i<37;++i)
+            for(size_t j=0;j<45;++j)
+            {
+                BOOST_CHECK_EQUAL(mask(i,j),bool(bytes(i,j)));
+                BOOST_CHECK_EQUAL(mask(shape_t{i,j}),bool(bytes(i,j)));
+            }
+
+        mask(3,4) = true;
+        BOOST_CHECK(mask[3*45+4]);
+        mask[3*45+4] = false;
+        BOOST_CHECK(!mask(3,4));
+        mask[0] = mask[1];
+        BOOST_CHECK_EQUAL(mask[0],mask[1]);
+        mask.at(10).flip();
+        BOOST_CHECK_EQUAL(mask[10],!bool(bytes[10]));
+        BOOST_CHECK_THROW(mask.at(mask.size()),index_error);
+
+        //iterators
+        const bitmask_array &cmask = mask;
+        BOOST_CHECK_EQUAL(std::count(cmask.begin(),cmask.end(),true),
+                          ssize_t(mask.count()));
+        BOOST_CHECK_EQUAL(cmask.end()-cmask.begin(),ssize_t(mask.size()));
+        std::fill(mask.begin(),mask.begin()+100,true);
+        for(size_t i=0;i<100;++i) BOOST_CHECK(mask[i]);
+        BOOST_CHECK_EQUAL(*mask.rbegin(),mask[mask.size()-1]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_logical)
+    {
+        auto other = bitmask_array::create(shape_t{37,45});
+        for(size_t i=0;i<other.size();++i) other[i] = i%3==0;
+
+        auto m_and = mask & other;
+        auto m_or  = mask | other;
+        auto m_xor = mask ^ other;
+        auto m_not = ~mask;
+        for(size_t i=0;i<mask.size();++i)
+        {
+            BOOST_CHECK_EQUAL(m_and[i],mask[i] && other[i]);
+            BOOST_CHECK_EQUAL(m_or[i],mask[i] || other[i]);
+            BOOST_CHECK_EQUAL(m_xor[i],mask[i] != other[i]);
+            BOOST_CHECK_EQUAL(m_not[i],!mask[i]);
+        }
+        check_padding(m_not);
+        BOOST_CHECK_EQUAL(m_not.count(),mask.size()-mask.count());
+        BOOST_CHECK((m_and | (mask ^ other)) == m_or);
+        BOOST_CHECK(m_and != m_or);
+
+        m_and = mask;
+        m_and &= other;
+        BOOST_CHECK(m_and == (mask & other));
+
+        auto wrong = bitmask_array::create(shape_t{10,10});
+        BOOST_CHECK_THROW(mask &= wrong,size_mismatch_error);
+        BOOST_CHECK_THROW(mask | wrong,size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_threshold,T,threshold_types)
+    {
+        auto a = create_data<T>(shape_t{37,45});
+        T t(50);
+
+        check_threshold(a,t,std::greater<T>());
+        check_threshold(a,t,std::greater_equal<T>());
+        check_threshold(a,t,std::less<T>());
+        check_threshold(a,t,std::less_equal<T>());
+        check_threshold(a,t,std::equal_to<T>());
+        check_threshold(a,t,std::not_equal_to<T>());
+        check_threshold(a,t,[](T x,T y) { return x>y && x<T(80); });
+
+        auto m = threshold_mask(a,t);
+        BOOST_CHECK(m == threshold_mask(a,t,std::greater<T>()));
+
+        //non-contiguous view
+        auto view = a(slice(0,37,2),slice(1,40));
+        check_threshold(view,t,std::less<T>());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_threshold_float)
+    {
+        auto a = create_data<float32>(shape_t{3,100});
+        a[5] = std::numeric_limits<float32>::quiet_NaN();
+        a[70] = -std::numeric_limits<float32>::infinity();
+        
+        check_threshold(a,40.f,std::greater<float32>());
+        check_threshold(a,40.f,std::less_equal<float32>());
+        check_threshold(a,40.f,std::equal_to<float32>());
+        check_threshold(a,40.f,std::not_equal_to<float32>());
+        BOOST_CHECK(threshold_mask(a,40.f,std::not_equal_to<float32>())[5]);
+    }
+
+    //========================================================================
+    // the SIMD kernels derive all predicates from greater-than and equality
+    // and flip the sign bit of unsigned values - check the limits of each
+    // type on the path the build compiles
+    //
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_threshold_limits,T,threshold_types)
+    {
+        bool vectorized = simd_compare_kernel<T,std::greater<T>>::is_vectorized;
+#if defined(PNI_SIMD_AVX512) || defined(PNI_SIMD_AVX2)
+        BOOST_CHECK(vectorized);
+#elif defined(PNI_SIMD_SSE2)
+        BOOST_CHECK_EQUAL(vectorized,
+                          sizeof(T)!=8 || std::is_floating_point<T>::value);
+#else
+        BOOST_CHECK(!vectorized);
+#endif
+        typedef std::numeric_limits<T> limits;
+        const T values[] = {limits::lowest(),T(limits::lowest()+1),T(0),T(1),
+                            T(limits::max()/2),T(limits::max()/2+1),
+                            T(limits::max()-1),limits::max()};
+        const size_t nvalues = sizeof(values)/sizeof(T);
+
+        auto a = dynamic_array<T>::create(shape_t{3,67});
+        for(size_t i=0;i<a.size();++i) a[i] = values[(i*5)%nvalues];
+
+        for(size_t i=0;i<nvalues;++i)
+        {
+            check_threshold(a,values[i],std::greater<T>());
+            check_threshold(a,values[i],std::greater_equal<T>());
+            check_threshold(a,values[i],std::less<T>());
+            check_threshold(a,values[i],std::less_equal<T>());
+            check_threshold(a,values[i],std::equal_to<T>());
+            check_threshold(a,values[i],std::not_equal_to<T>());
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_conversion)
+    {
+        BOOST_CHECK(to_bitmask(bytes) == mask);
+
+        auto u8 = dynamic_array<uint8>::create(shape_t{37,45});
+        unpack_mask(mask,u8);
+        for(size_t i=0;i<u8.size();++i) 
+            BOOST_CHECK_EQUAL(u8[i],mask[i] ? 1 : 0);
+        BOOST_CHECK(to_bitmask(u8) == mask);
+
+        auto f = dynamic_array<float32>::create(shape_t{37,45});
+        unpack_mask(mask,f,2.5f,-1.f);
+        for(size_t i=0;i<f.size();++i) 
+            BOOST_CHECK_EQUAL(f[i],mask[i] ? 2.5f : -1.f);
+        BOOST_CHECK(threshold_mask(f,0.f) == mask);
+
+        auto u16 = dynamic_array<uint16>::create(shape_t{37,45});
+        unpack_mask(mask,u16);
+        BOOST_CHECK(threshold_mask(u16,uint16(0)) == mask);
+
+        auto d = dynamic_array<float64>::create(shape_t{37,45});
+        unpack_mask(mask,d);
+        BOOST_CHECK(threshold_mask(d,0.5) == mask);
+
+        auto b = dynamic_array<bool_t>::create(shape_t{37,45});
+        unpack_mask(mask,b);
+        BOOST_CHECK(std::equal(b.begin(),b.end(),bytes.begin()));
+
+        //a view of the byte mask
+        auto view = bytes(slice(0,37),slice(0,45,5));
+        auto packed = to_bitmask(view);
+        for(size_t i=0;i<view.size();++i) 
+            BOOST_CHECK_EQUAL(packed[i],bool(view[i]));
+
+        //unpack to a view
+        auto v = dynamic_array<int32>::create(shape_t{37,90});
+        std::fill(v.begin(),v.end(),7);
+        auto roi = v(slice(0,37),slice(0,90,2));
+        unpack_mask(mask,roi);
+        for(size_t i=0;i<37;++i)
+            for(size_t j=0;j<90;++j)
+                BOOST_CHECK_EQUAL(v(i,j),j%2 ? 7 : int32(mask(i,j/2)));
+
+        auto wrong = dynamic_array<int32>::create(shape_t{10});
+        BOOST_CHECK_THROW(unpack_mask(mask,wrong),size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_masked_operations)
+    {
+        auto a = create_data<float32>(shape_t{37,45});
+        auto b = a;
+
+        a[mask] = -1.f;
+        b[bytes] = -1.f;
+        BOOST_CHECK(std::equal(a.begin(),a.end(),b.begin()));
+
+        a = create_data<float32>(shape_t{37,45});
+        auto c1 = compress(a,mask);
+        auto c2 = compress(a,bytes);
+        BOOST_REQUIRE_EQUAL(c1.size(),count());
+        BOOST_CHECK(std::equal(c1.begin(),c1.end(),c2.begin()));
+        BOOST_CHECK_EQUAL(masked_sum(a,mask),masked_sum(a,bytes));
+
+        //non-contiguous view
+        auto volume = create_data<float32>(shape_t{4,37,45});
+        auto orig = volume;
+        auto roi = volume(slice(0,4),3,slice(0,45));
+        auto roi_mask = to_bitmask(bytes(slice(0,4),slice(0,45)));
+        roi[roi_mask] = -2.f;
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<37;++j)
+                for(size_t k=0;k<45;++k)
+                    BOOST_CHECK_EQUAL(volume(i,j,k),
+                            j==3 && mask(i,k) ? -2.f : orig(i,j,k));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,252 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+using namespace pni::core;
+
+typedef chunked_array<int32> array_type;
+typedef array_factory<array_type> factory_type;
+typedef dynamic_array<int32> reference_type;
+
+//
+// a (10,7,9) volume in chunks of 3 frames - the last chunk holds a single
+// frame. The algorithms run with 4 threads.
+//
+struct chunked_array_fixture
+{
+    size_t nthreads;
+    size_t threshold;
+    array_type data;
+    reference_type ref;
+
+    chunked_array_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold()),
+        data(factory_type::create_chunked(shape_t{10,7,9},shape_t{3,7,9})),
+        ref(reference_type::create(shape_t{10,7,9}))
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+
+        for(size_t i=0;i<ref.size();++i) ref[i] = int32((i*37)%101)-50;
+        std::copy(ref.begin(),ref.end(),data.begin());
+    }
+
+    ~chunked_array_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(chunked_array_test,chunked_array_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_storage)
+    {
+        const auto &storage = data.storage();
+        BOOST_CHECK_EQUAL(storage.size(),630u);
+        BOOST_CHECK_EQUAL(storage.nchunks(),4u);
+        BOOST_CHECK_EQUAL(storage.chunk_size(),189u);
+        BOOST_CHECK_EQUAL(storage.chunk_offset(3),567u);
+        BOOST_CHECK_EQUAL(storage.chunk_elements(0),189u);
+        BOOST_CHECK_EQUAL(storage.chunk_elements(3),63u);
+
+        //every chunk is a separate allocation
+        for(size_t c=0;c<storage.nchunks();++c)
+        {
+            BOOST_CHECK_EQUAL(storage.chunk(c),&data[storage.chunk_offset(c)]);
+            BOOST_CHECK_EQUAL(reinterpret_cast<size_t>(storage.chunk(c))%64,
+                              0u);
+        }
+
+        BOOST_CHECK(!contiguous_data<array_type>::value);
+        BOOST_CHECK_THROW(chunked_storage<int32>(10,0),value_error);
+
+        //the default chunk size
+        auto a = array_type::create(shape_t{10,20});
+        BOOST_CHECK_EQUAL(a.storage().nchunks(),1u);
+        BOOST_CHECK_EQUAL(a.storage().chunk_size(),
+                          default_chunk_bytes/sizeof(int32));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_initialization)
+    {
+        //like all other arrays a new chunked array is zero
+        auto a = factory_type::create_chunked(shape_t{10,7,9},shape_t{3,7,9});
+        BOOST_CHECK(std::all_of(a.begin(),a.end(),
+                                [](int32 v){ return v==0; }));
+
+        auto b = array_type::create(shape_t{10,20},int32(4));
+        BOOST_CHECK(std::all_of(b.begin(),b.end(),
+                                [](int32 v){ return v==4; }));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_creation_errors)
+    {
+        BOOST_CHECK_THROW(factory_type::create_chunked(shape_t{10,7,9},
+                                                       shape_t{3,7,8}),
+                          shape_mismatch_error);
+        BOOST_CHECK_THROW(factory_type::create_chunked(shape_t{10,7,9},
+                                                       shape_t{3,63}),
+                          shape_mismatch_error);
+        BOOST_CHECK_THROW(factory_type::create_chunked(shape_t{10,7,9},
+                                                       shape_t{0,7,9}),
+                          shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_access)
+    {
+        for(size_t i=0;i<10;++i)
+            for(size_t j=0;j<7;++j)
+                for(size_t k=0;k<9;++k)
+                    BOOST_CHECK_EQUAL(data(i,j,k),ref(i,j,k));
+
+        BOOST_CHECK(std::equal(data.begin(),data.end(),ref.begin()));
+        BOOST_CHECK_THROW(data.at(630),index_error);
+
+        //views spanning several chunks
+        auto view = data(slice(1,9,2),3,slice(0,9));
+        auto ref_view = ref(slice(1,9,2),3,slice(0,9));
+        BOOST_CHECK(std::equal(view.begin(),view.end(),ref_view.begin()));
+
+        std::fill(view.begin(),view.end(),1000);
+        std::fill(ref_view.begin(),ref_view.end(),1000);
+        BOOST_CHECK(std::equal(data.begin(),data.end(),ref.begin()));
+
+        //copies do not share data
+        array_type copy(data);
+        copy[0] = -1000;
+        BOOST_CHECK_EQUAL(data[0],ref[0]);
+        BOOST_CHECK_EQUAL(copy.storage().nchunks(),4u);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_for_each_chunk)
+    {
+        std::vector<size_t> begins;
+        for_each_chunk(data,[&begins](int32 *ptr,size_t begin,size_t end)
+        {
+            begins.push_back(begin);
+            std::fill(ptr,ptr+(end-begin),int32(begin));
+        },sequential_execution());
+        BOOST_CHECK((begins==std::vector<size_t>{0,189,378,567}));
+
+        for(size_t i=0;i<data.size();++i)
+            BOOST_CHECK_EQUAL(data[i],int32((i/189)*189));
+
+        std::atomic<size_t> total(0);
+        const array_type &cdata = data;
+        for_each_chunk(cdata,[&total](const int32 *,size_t begin,size_t end)
+        {
+            total += end-begin;
+        },parallel_execution());
+        BOOST_CHECK_EQUAL(total,data.size());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expressions)
+    {
+        auto b = factory_type::create_chunked(shape_t{10,7,9},shape_t{2,7,9});
+        std::iota(b.begin(),b.end(),0);
+        auto c = reference_type::create(shape_t{10,7,9});
+        std::iota(c.begin(),c.end(),100);
+
+        //chunked destination and chunked leaves with a different chunk 
+        //layout
+        auto r = array_type::create(shape_t{10,7,9});
+        r = data*2+b-c;
+        for(size_t i=0;i<r.size();++i)
+            BOOST_CHECK_EQUAL(r[i],ref[i]*2+b[i]-c[i]);
+
+        auto p = factory_type::create_chunked(shape_t{10,7,9},shape_t{1,7,9});
+        assign(p,data-c,parallel_execution());
+        for(size_t i=0;i<p.size();++i) BOOST_CHECK_EQUAL(p[i],ref[i]-c[i]);
+
+        //chunked arrays as leaves of an expression for a contiguous array
+        auto d = reference_type::create(shape_t{10,7,9});
+        assign(d,data+b,parallel_execution());
+        for(size_t i=0;i<d.size();++i) BOOST_CHECK_EQUAL(d[i],ref[i]+b[i]);
+
+        //construction from an expression
+        array_type e(data*b);
+        for(size_t i=0;i<e.size();++i) BOOST_CHECK_EQUAL(e[i],ref[i]*b[i]);
+
+        BOOST_CHECK_THROW(assign(p,c(slice(0,2),slice(0,7),slice(0,9)),
+                                 parallel_execution()),
+                          size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_operations)
+    {
+        auto min_iter = std::min_element(ref.begin(),ref.end());
+        auto max_iter = std::max_element(ref.begin(),ref.end());
+        BOOST_CHECK_EQUAL(min(data),*min_iter);
+        BOOST_CHECK_EQUAL(max(data),*max_iter);
+        BOOST_CHECK_EQUAL(min_offset(data),size_t(min_iter-ref.begin()));
+        BOOST_CHECK_EQUAL(max_offset(data),size_t(max_iter-ref.begin()));
+
+        auto apply = [this](std::function<int32(int32)> f)
+        {
+            for(auto &v: ref) v = f(v);
+            BOOST_CHECK(std::equal(data.begin(),data.end(),ref.begin()));
+        };
+
+        clip(data,-10,10);
+        apply([](int32 v) { return v<=-10 ? -10 : (v>=10 ? 10 : v); });
+
+        clip(data,-5,5,-100,100);
+        apply([](int32 v) { return v<=-5 ? -100 : (v>=5 ? 100 : v); });
+
+        min_clip(data,0);
+        apply([](int32 v) { return v<=0 ? 0 : v; });
+
+        min_clip(data,0,7);
+        apply([](int32 v) { return v<=0 ? 7 : v; });
+
+        max_clip(data,50);
+        apply([](int32 v) { return v>=50 ? 50 : v; });
+
+        max_clip(data,50,3);
+        apply([](int32 v) { return v>=50 ? 3 : v; });
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
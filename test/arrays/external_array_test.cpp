@@ -0,0 +1,129 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef external_array<float64> array_type;
+typedef array_factory<array_type> factory_type;
+
+struct external_array_fixture
+{
+    std::vector<float64> buffer;
+    shape_t shape;
+
+    external_array_fixture():
+        buffer(60),
+        shape(shape_t{3,4,5})
+    {
+        std::iota(buffer.begin(),buffer.end(),0.);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(external_array_test,external_array_fixture)
+
+    BOOST_AUTO_TEST_CASE(test_wrap)
+    {
+        auto a = factory_type::wrap(buffer.data(),shape);
+        BOOST_CHECK_EQUAL(a.size(),60u);
+        BOOST_CHECK_EQUAL(a.rank(),3u);
+        BOOST_CHECK_EQUAL(a.data(),buffer.data());
+        BOOST_CHECK_EQUAL(a(1,2,3),float64(1*20+2*5+3));
+        BOOST_CHECK_THROW(a.at(60),index_error);
+
+        auto b = factory_type::wrap(buffer.data(),{6,10});
+        BOOST_CHECK_EQUAL(b.rank(),2u);
+        BOOST_CHECK_EQUAL(b(5,9),59.);
+
+        //copies refer to the same buffer
+        auto c = a;
+        c[0] = 100.;
+        BOOST_CHECK_EQUAL(buffer[0],100.);
+        BOOST_CHECK_EQUAL(a[0],100.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view)
+    {
+        auto a = factory_type::wrap(buffer.data(),shape);
+
+        auto v = a(1,slice(0,4),slice(0,5,2));
+        std::fill(v.begin(),v.end(),-1.);
+
+        for(size_t i=0;i<buffer.size();++i)
+        {
+            bool selected = i>=20 && i<40 && (i%5)%2==0;
+            BOOST_CHECK_EQUAL(buffer[i],selected ? -1. : float64(i));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_inplace_arithmetics)
+    {
+        auto a = factory_type::wrap(buffer.data(),shape);
+        a *= 2.;
+        a += 1.;
+        for(size_t i=0;i<buffer.size();++i)
+            BOOST_CHECK_EQUAL(buffer[i],2.*i+1.);
+
+        typedef mdarray<external_storage<float64>,dynamic_cindex_map,
+                        simd_inplace_arithmetics> simd_array_type;
+        auto b = array_factory<simd_array_type>::wrap(buffer.data(),shape);
+        b -= 1.;
+        b /= 2.;
+        for(size_t i=0;i<buffer.size();++i)
+            BOOST_CHECK_EQUAL(buffer[i],float64(i));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expressions)
+    {
+        std::vector<float64> result(60);
+        auto a = factory_type::wrap(buffer.data(),shape);
+        auto b = dynamic_array<float64>::create(shape);
+        std::fill(b.begin(),b.end(),2.);
+        auto c = factory_type::wrap(result.data(),shape);
+
+        c = a*b+a;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],3.*i);
+
+        //copy the data of an external array into an owning one
+        dynamic_array<float64> d = dynamic_array<float64>::create(shape);
+        d = c;
+        BOOST_CHECK(std::equal(d.begin(),d.end(),result.begin()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,192 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef mdarray<std::vector<int32>,dynamic_findex_map> farray_type;
+typedef mdarray<std::vector<int32>,fixed_dim_findex_map<2>> fimage_type;
+typedef mdarray<std::array<int32,6>,static_findex_map<2,3>> fmatrix_type;
+typedef dynamic_array<int32> carray_type;
+
+struct fortran_array_fixture
+{
+    farray_type f;
+    carray_type c;
+
+    fortran_array_fixture():
+        f(farray_type::create(shape_t{4,5,6})),
+        c(carray_type::create(shape_t{4,5,6}))
+    {
+        std::iota(f.begin(),f.end(),0);
+        std::iota(c.begin(),c.end(),0);
+    }
+};
+
+//
+// the elements of a view must be traversed in Fortran order
+//
+template<typename VTYPE> void check_fortran_order(const VTYPE &view)
+{
+    auto s = view.template shape<shape_t>();
+    size_t index = 0;
+    for(size_t k=0;k<s[2];++k)
+        for(size_t j=0;j<s[1];++j)
+            for(size_t i=0;i<s[0];++i,++index)
+                BOOST_CHECK_EQUAL(view[index],view(i,j,k));
+
+    index = 0;
+    for(auto iter = view.begin();iter!=view.end();++iter,++index)
+        BOOST_CHECK_EQUAL(*iter,view[index]);
+
+    auto iter = view.end();
+    while(iter!=view.begin())
+        BOOST_CHECK_EQUAL(*(--iter),view[--index]);
+
+    for(size_t i=0;i<view.size();i+=7)
+        BOOST_CHECK_EQUAL(*(view.begin()+i),view[i]);
+
+    index = 0;
+    const int32 *ptr = view.array().data();
+    for(auto seg: view.segments())
+        for(size_t i=0;i<seg.size;++i,++index)
+            BOOST_CHECK_EQUAL(ptr[seg.offset+i*seg.stride],view[index]);
+    BOOST_CHECK_EQUAL(index,view.size());
+}
+
+BOOST_AUTO_TEST_SUITE(fortran_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_layout)
+    {
+        fortran_array_fixture f;
+
+        //the first index varies fastest
+        BOOST_CHECK_EQUAL(f.f(1,0,0),1);
+        BOOST_CHECK_EQUAL(f.f(0,1,0),4);
+        BOOST_CHECK_EQUAL(f.f(0,0,1),20);
+        BOOST_CHECK_EQUAL(f.f(3,2,5),3+2*4+5*20);
+
+        auto image = fimage_type::create(shape_t{3,2});
+        std::iota(image.begin(),image.end(),0);
+        BOOST_CHECK_EQUAL(image(2,1),5);
+        BOOST_CHECK_EQUAL(image(1,1),4);
+
+        fmatrix_type m;
+        std::iota(m.begin(),m.end(),0);
+        BOOST_CHECK_EQUAL(m(1,2),5);
+        BOOST_CHECK_EQUAL(m(0,1),2);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        fortran_array_fixture f;
+
+        //a set of full columns is contiguous 
+        auto columns = f.f(slice(0,4),slice(0,5),slice(2,4));
+        BOOST_CHECK(columns.is_contiguous());
+        BOOST_CHECK_EQUAL(columns.data(),f.f.data()+40);
+        BOOST_CHECK_EQUAL(columns.segments().size(),1u);
+        check_fortran_order(columns);
+
+        auto roi = f.f(slice(1,3),slice(1,5),slice(0,6));
+        BOOST_CHECK(!roi.is_contiguous());
+        BOOST_CHECK_EQUAL(roi.run_length(),2u);
+        BOOST_CHECK_EQUAL(roi.segments().size(),24u);
+        check_fortran_order(roi);
+
+        auto strided = f.f(slice(0,4,2),slice(0,5),slice(1,6,2));
+        BOOST_CHECK_EQUAL(strided.run_length(),1u);
+        check_fortran_order(strided);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_conversion)
+    {
+        fortran_array_fixture f;
+
+        //conversion between the two storage orders 
+        carray_type c(f.f);
+        farray_type b(f.c);
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<6;++k)
+                {
+                    BOOST_CHECK_EQUAL(c(i,j,k),f.f(i,j,k));
+                    BOOST_CHECK_EQUAL(b(i,j,k),f.c(i,j,k));
+                }
+
+        //expressions are evaluated in the order of their operands
+        c = f.f+f.f;
+        b = f.f*2;
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<6;++k)
+                {
+                    BOOST_CHECK_EQUAL(c(i,j,k),2*f.f(i,j,k));
+                    BOOST_CHECK_EQUAL(b(i,j,k),2*f.f(i,j,k));
+                }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_copies)
+    {
+        fortran_array_fixture f;
+
+        //C-ordered view to a Fortran array
+        farray_type roi(f.c(slice(1,3),slice(0,5),slice(2,5)));
+        for(size_t i=0;i<2;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<3;++k)
+                    BOOST_CHECK_EQUAL(roi(i,j,k),f.c(1+i,j,2+k));
+
+        //Fortran array to a C-ordered view
+        auto view = f.c(slice(2,4),slice(0,5),slice(0,3));
+        view = roi;
+        for(size_t i=0;i<2;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<3;++k)
+                    BOOST_CHECK_EQUAL(f.c(2+i,j,k),roi(i,j,k));
+
+        //Fortran view to a Fortran array is copied along the segments
+        farray_type froi(f.f(slice(1,3),slice(1,5),slice(0,6)));
+        for(size_t i=0;i<2;++i)
+            for(size_t j=0;j<4;++j)
+                for(size_t k=0;k<6;++k)
+                    BOOST_CHECK_EQUAL(froi(i,j,k),f.f(1+i,1+j,k));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
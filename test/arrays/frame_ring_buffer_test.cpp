@@ -0,0 +1,212 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+using namespace pni::core;
+
+typedef frame_ring_buffer<uint16> buffer_type;
+typedef dynamic_array<uint16> frame_type;
+typedef dynamic_array<float64> sum_type;
+
+//
+// frame n has all pixels set to n%1000
+//
+frame_type create_frame(size_t n,const shape_t &shape = shape_t{7,9})
+{
+    auto frame = frame_type::create(shape);
+    std::fill(frame.begin(),frame.end(),uint16(n%1000));
+    return frame;
+}
+
+BOOST_AUTO_TEST_SUITE(frame_ring_buffer_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_construction)
+    {
+        buffer_type buffer(4,shape_t{7,9});
+        BOOST_CHECK_EQUAL(buffer.capacity(),4u);
+        BOOST_CHECK_EQUAL(buffer.size(),0u);
+        BOOST_CHECK_EQUAL(buffer.count(),0u);
+        BOOST_CHECK(buffer.frame_shape()==shape_t({7,9}));
+        BOOST_CHECK(buffer.window().empty());
+
+        BOOST_CHECK_THROW(buffer_type(0,shape_t{7,9}),value_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_push)
+    {
+        buffer_type buffer(4,shape_t{7,9});
+        auto frame = frame_type::create(shape_t{7,9});
+
+        for(size_t n=0;n<10;++n)
+        {
+            buffer.push(create_frame(n));
+            BOOST_CHECK_EQUAL(buffer.size(),std::min<size_t>(n+1,4));
+            BOOST_CHECK_EQUAL(buffer.count(),n+1);
+
+            BOOST_CHECK_EQUAL(buffer.copy_frame(0,frame),n);
+            for(auto v: frame) BOOST_CHECK_EQUAL(v,n);
+        }
+
+        //frames 6,7,8,9 remain
+        BOOST_CHECK_EQUAL(buffer.copy_frame(3,frame),6u);
+        BOOST_CHECK_EQUAL(frame[0],6);
+        BOOST_CHECK_THROW(buffer.copy_frame(4,frame),index_error);
+
+        auto window = buffer.window();
+        BOOST_REQUIRE_EQUAL(window.size(),4u);
+        for(size_t k=0;k<4;++k)
+        {
+            const auto &view = window[k];
+            BOOST_CHECK(view.template shape<shape_t>()==shape_t({7,9}));
+            BOOST_CHECK_EQUAL(view(6,8),6+k);
+        }
+
+        const auto latest = buffer.frame(1);
+        BOOST_CHECK_EQUAL(latest(0,0),8);
+        //frame 9 is stored in slot 1
+        BOOST_CHECK_EQUAL(buffer.slot(1)(3,3),9);
+        BOOST_CHECK(buffer.slot(1).is_contiguous());
+        BOOST_CHECK_THROW(buffer.slot(4),index_error);
+
+        BOOST_CHECK_THROW(buffer.push(frame_type::create(shape_t{7,8})),
+                          size_mismatch_error);
+        std::vector<uint16> small(3);
+        BOOST_CHECK_THROW(buffer.copy_frame(0,small),size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_rolling_sum)
+    {
+        buffer_type buffer(3,shape_t{7,9});
+        auto sum = sum_type::create(shape_t{7,9});
+        BOOST_CHECK_THROW(buffer.copy_mean(sum),value_error);
+
+        float64 expected = 0;
+        for(size_t n=0;n<10;++n)
+        {
+            buffer.push(create_frame(n));
+            expected += n;
+            if(n>=3) expected -= n-3;
+
+            BOOST_CHECK_EQUAL(buffer.copy_sum(sum),n+1);
+            for(auto v: sum) BOOST_CHECK_CLOSE(v,expected,1.e-10);
+            BOOST_CHECK_CLOSE(buffer.sum()[0],expected,1.e-10);
+
+            buffer.copy_mean(sum);
+            for(auto v: sum) 
+                BOOST_CHECK_CLOSE(v,expected/std::min<size_t>(n+1,3),1.e-10);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_long_stream)
+    {
+        //float frames with very different magnitudes - the incremental 
+        //updates of the sum are not exact
+        const size_t k = 7;
+        typedef dynamic_array<float32> float_frame_type;
+        frame_ring_buffer<float32> buffer(k,shape_t{3,5});
+        std::vector<float_frame_type> frames;
+        auto sum = sum_type::create(shape_t{3,5});
+
+        for(size_t n=0;n<20000;++n)
+        {
+            auto frame = float_frame_type::create(shape_t{3,5});
+            for(size_t i=0;i<frame.size();++i)
+                frame[i] = n%3 ? float32((n*i)%17)*0.1f+1.e-3f : 
+                                 1.e9f+float32(i);
+            buffer.push(frame);
+            frames.push_back(frame);
+            if(frames.size()>k) frames.erase(frames.begin());
+
+            //exact recomputation over the stored frames in push order
+            auto expected = sum_type::create(shape_t{3,5});
+            std::fill(expected.begin(),expected.end(),0.);
+            for(const auto &f: frames)
+                for(size_t i=0;i<f.size();++i) expected[i] += float64(f[i]);
+
+            buffer.copy_sum(sum);
+            for(size_t i=0;i<sum.size();++i)
+            {
+                //the error is bounded by the frames of one cycle
+                BOOST_CHECK_SMALL(sum[i]-expected[i],1.e-4);
+                //the sum is renewed when the last slot is written
+                if((n+1)%k==0) BOOST_CHECK_EQUAL(sum[i],expected[i]);
+            }
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_producer_consumer)
+    {
+        //a consumer must never see a frame or a sum which is partially 
+        //written 
+        const size_t nframes = 20000;
+        buffer_type buffer(8,shape_t{64,64});
+        std::atomic<bool> done(false);
+        std::atomic<size_t> errors(0);
+
+        auto consumer = [&buffer,&done,&errors]()
+        {
+            auto frame = frame_type::create(shape_t{64,64});
+            auto sum = sum_type::create(shape_t{64,64});
+            while(!done)
+            {
+                if(!buffer.count()) continue;
+
+                uint64 n = buffer.copy_frame(0,frame);
+                for(auto v: frame) if(v!=n%1000) ++errors;
+
+                buffer.copy_sum(sum);
+                for(auto v: sum) if(v!=sum[0]) ++errors;
+            }
+        };
+
+        std::vector<std::thread> consumers;
+        for(size_t i=0;i<3;++i) consumers.push_back(std::thread(consumer));
+
+        for(size_t n=0;n<nframes;++n) 
+            buffer.push(create_frame(n,shape_t{64,64}));
+        done = true;
+        for(auto &t: consumers) t.join();
+
+        BOOST_CHECK_EQUAL(errors.load(),0u);
+        BOOST_CHECK_EQUAL(buffer.count(),nframes);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
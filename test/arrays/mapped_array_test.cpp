@@ -0,0 +1,221 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures.hpp>
+#include <fstream>
+#include <cstdio>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef mapped_array<int32> array_type;
+typedef array_factory<array_type> factory_type;
+
+struct mapped_array_fixture
+{
+    string filename;
+    shape_t shape;
+    std::vector<int32> data;
+
+    //
+    // write a file with a 100 Byte header followed by the data
+    //
+    mapped_array_fixture():
+        filename("mapped_array_test.raw"),
+        shape(shape_t{3,4,5}),
+        data(60)
+    {
+        std::iota(data.begin(),data.end(),0);
+        std::ofstream stream(filename,std::ios::binary);
+        string header(100,'h');
+        stream.write(header.data(),header.size());
+        stream.write(reinterpret_cast<const char*>(data.data()),
+                     data.size()*sizeof(int32));
+    }
+
+    ~mapped_array_fixture()
+    {
+        std::remove(filename.c_str());
+    }
+
+    std::vector<int32> read_file() const
+    {
+        std::vector<int32> buffer(data.size());
+        std::ifstream stream(filename,std::ios::binary);
+        stream.seekg(100);
+        stream.read(reinterpret_cast<char*>(buffer.data()),
+                    buffer.size()*sizeof(int32));
+        return buffer;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(mapped_array_test,mapped_array_fixture)
+
+    BOOST_AUTO_TEST_CASE(test_map_read_only)
+    {
+        auto a = factory_type::map(filename,shape,map_mode::READ_ONLY,100);
+        BOOST_CHECK_EQUAL(a.size(),60u);
+        BOOST_CHECK_EQUAL(a.rank(),3u);
+        BOOST_CHECK(a.storage().mode()==map_mode::READ_ONLY);
+        BOOST_CHECK(std::equal(a.begin(),a.end(),data.begin()));
+        BOOST_CHECK_EQUAL(a(1,2,3),int32(1*20+2*5+3));
+
+        a.storage().advise(map_advice::SEQUENTIAL);
+        a.storage().advise(map_advice::WILLNEED,10,20);
+        BOOST_CHECK_THROW(a.storage().advise(map_advice::RANDOM,50,20),
+                          range_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_map_read_write)
+    {
+        {
+            auto a = factory_type::map(filename,shape,map_mode::READ_WRITE,100);
+            a *= 2;
+            a(0,0,0) = -1;
+            a.storage().sync();
+        }
+
+        auto buffer = read_file();
+        BOOST_CHECK_EQUAL(buffer[0],-1);
+        for(size_t i=1;i<buffer.size();++i)
+            BOOST_CHECK_EQUAL(buffer[i],2*data[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_map_errors)
+    {
+        BOOST_CHECK_THROW(factory_type::map("no_such_file.raw",shape),
+                          file_error);
+        //the file is too small for this shape
+        BOOST_CHECK_THROW(factory_type::map(filename,shape_t{10,10},
+                                            map_mode::READ_ONLY,100),
+                          size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_create_mapped)
+    {
+        {
+            auto a = factory_type::create_mapped(filename,shape_t{10,6});
+            BOOST_CHECK_EQUAL(a.size(),60u);
+            BOOST_CHECK(std::all_of(a.begin(),a.end(),
+                                    [](int32 v){ return v==0; }));
+            std::copy(data.begin(),data.end(),a.begin());
+        }
+
+        auto b = factory_type::map(filename,shape_t{60});
+        BOOST_CHECK(std::equal(b.begin(),b.end(),data.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_write_read_only)
+    {
+        {
+            //writing to a read-only mapping changes only the memory
+            auto a = factory_type::map(filename,shape,map_mode::READ_ONLY,100);
+            a *= 2;
+            a[5] = 1000;
+            BOOST_CHECK_EQUAL(a[5],1000);
+            BOOST_CHECK_EQUAL(a[6],12);
+        }
+
+        auto buffer = read_file();
+        BOOST_CHECK(std::equal(buffer.begin(),buffer.end(),data.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy)
+    {
+        auto a = factory_type::map(filename,shape,map_mode::READ_WRITE,100);
+        auto b = a;
+        BOOST_CHECK(a.data()!=b.data());
+        BOOST_CHECK(std::equal(b.begin(),b.end(),data.begin()));
+
+        //the copy is independent of the file
+        b[5] = 1000;
+        BOOST_CHECK_EQUAL(a[5],5);
+
+        auto c = array_type::create(shape_t{2});
+        c = b;
+        BOOST_CHECK_EQUAL(c.size(),60u);
+        BOOST_CHECK_EQUAL(c[5],1000);
+
+        //moving transfers the mapping
+        const int32 *ptr = a.data();
+        auto d = std::move(a);
+        BOOST_CHECK_EQUAL(d.data(),ptr);
+        d[5] = 2000;
+        d.storage().sync();
+        BOOST_CHECK_EQUAL(read_file()[5],2000);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_anonymous)
+    {
+        //arrays created without a file are backed by anonymous memory
+        auto a = array_type::create(shape_t{4,5});
+        BOOST_CHECK_EQUAL(a.size(),20u);
+        BOOST_CHECK(std::all_of(a.begin(),a.end(),
+                                [](int32 v){ return v==0; }));
+
+        auto b = factory_type::map(filename,shape,map_mode::READ_ONLY,100);
+        auto c = array_type::create(shape);
+        c = b+b;
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_EQUAL(c[i],2*data[i]);
+
+        auto v = b(1,slice(0,4),slice(0,5));
+        array_type d(v);
+        BOOST_CHECK(std::equal(d.begin(),d.end(),data.begin()+20));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_type_erasure)
+    {
+        auto a = map_array(type_id_t::INT32,filename,shape,
+                           map_mode::READ_ONLY,100);
+        BOOST_CHECK(a.type_id()==type_id_t::INT32);
+        BOOST_CHECK_EQUAL(a.size(),60u);
+        BOOST_CHECK_EQUAL(a[7].as<int32>(),7);
+
+        BOOST_CHECK_THROW(map_array(type_id_t::STRING,filename,shape),
+                          type_error);
+
+        auto b = make_mapped_array(type_id_t::FLOAT64,filename,shape_t{2,3});
+        BOOST_CHECK(b.type_id()==type_id_t::FLOAT64);
+        BOOST_CHECK_EQUAL(b.size(),6u);
+        BOOST_CHECK_EQUAL(b[5].as<float64>(),0.0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
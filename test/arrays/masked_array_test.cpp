@@ -0,0 +1,260 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<dynamic_array<int32>,
+                         dynamic_array<uint16>,
+                         dynamic_array<float32>,
+                         dynamic_array<float64>,
+                         fixed_dim_array<int64,2>
+                        > masked_array_types;
+
+//
+// runs the algorithms with 4 threads - the shape is chosen such that the 
+// rows do not fill complete SIMD packets
+//
+struct masked_array_fixture
+{
+    size_t nthreads;
+    size_t threshold;
+    dynamic_array<bool_t> mask;
+
+    masked_array_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold()),
+        mask(dynamic_array<bool_t>::create(shape_t{37,45}))
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+
+        for(size_t i=0;i<mask.size();++i) mask[i] = (i*7)%5<2;
+    }
+
+    ~masked_array_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+
+    size_t count() const
+    {
+        return std::count_if(mask.begin(),mask.end(),
+                             [](bool_t v) { return bool(v); });
+    }
+};
+
+template<typename AT> AT create_array(const shape_t &shape)
+{
+    auto a = AT::create(shape);
+    for(size_t i=0;i<a.size();++i) a[i] = i%100;
+    return a;
+}
+
+//
+// true if a[m] compiles for an array of type AT and a mask of type MT
+//
+template<
+         typename AT,
+         typename MT
+        >
+struct has_masked_access
+{
+    template<typename A,typename M>
+    static auto test(int) -> decltype(std::declval<A&>()[std::declval<M>()],
+                                      std::true_type());
+
+    template<typename A,typename M> static std::false_type test(...);
+
+    static const bool value = decltype(test<AT,const MT&>(0))::value;
+};
+
+BOOST_FIXTURE_TEST_SUITE(masked_array_test,masked_array_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_mask_count)
+    {
+        BOOST_CHECK_EQUAL(mask_count(mask),count());
+
+        auto bytes = dynamic_array<uint8>::create(shape_t{1000});
+        std::fill(bytes.begin(),bytes.end(),0);
+        bytes[0] = bytes[63] = bytes[64] = bytes[999] = 255;
+        BOOST_CHECK_EQUAL(mask_count(bytes),4u);
+
+        //a strided view uses the [] operator
+        BOOST_CHECK_EQUAL(mask_count(mask(slice(0,37),slice(0,45,5))),
+                          37u*9);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_fill,AT,masked_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        auto a = create_array<AT>(shape_t{37,45});
+        auto orig = a;
+
+        a[mask] = value_type(101);
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i],mask[i] ? value_type(101) : orig[i]);
+
+        a = orig;
+        masked_fill(a,mask,value_type(7));
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i],mask[i] ? value_type(7) : orig[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_assign,AT,masked_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        auto a = create_array<AT>(shape_t{37,45});
+        auto orig = a;
+
+        std::vector<value_type> values(count());
+        std::iota(values.begin(),values.end(),value_type(0));
+        a[mask] = values;
+
+        size_t k = 0;
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i],mask[i] ? values[k++] : orig[i]);
+        BOOST_CHECK_EQUAL(k,values.size());
+
+        //the number of values must match the number of selected elements
+        values.push_back(value_type(1));
+        BOOST_CHECK_THROW(a[mask] = values,size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_reductions,AT,masked_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        auto a = create_array<AT>(shape_t{37,45});
+
+        value_type sum(0),min_value(100),max_value(0);
+        float64 total = 0.;
+        for(size_t i=0;i<a.size();++i)
+        {
+            if(!mask[i]) continue;
+            sum += a[i];
+            total += a[i];
+            min_value = std::min(min_value,a[i]);
+            max_value = std::max(max_value,a[i]);
+        }
+
+        BOOST_CHECK_EQUAL(masked_sum(a,mask),sum);
+        BOOST_CHECK_EQUAL(masked_min(a,mask),min_value);
+        BOOST_CHECK_EQUAL(masked_max(a,mask),max_value);
+        BOOST_CHECK_CLOSE(masked_mean(a,mask),
+                          total/float64(count()),1.e-8);
+
+        auto empty = dynamic_array<bool_t>::create(shape_t{37,45});
+        std::fill(empty.begin(),empty.end(),false);
+        BOOST_CHECK_EQUAL(masked_sum(a,empty),value_type(0));
+        BOOST_CHECK_THROW(masked_min(a,empty),value_error);
+        BOOST_CHECK_THROW(masked_mean(a,empty),value_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        auto a = create_array<dynamic_array<float32>>(shape_t{4,37,45});
+        auto orig = a;
+
+        //contiguous view
+        auto frame = a(2,slice(0,37),slice(0,45));
+        frame[mask] = -1.f;
+        BOOST_CHECK_EQUAL(masked_sum(frame,mask),-float32(count()));
+
+        //non-contiguous view
+        auto roi = a(slice(0,4),3,slice(0,45));
+        auto roi_mask = mask(slice(0,4),slice(0,45));
+        roi[roi_mask] = -2.f;
+
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<37;++j)
+                for(size_t k=0;k<45;++k)
+                {
+                    float32 expected = orig(i,j,k);
+                    if(i==2 && mask(j,k)) expected = -1.f;
+                    if(j==3 && mask(i,k)) expected = -2.f;
+                    BOOST_CHECK_EQUAL(a(i,j,k),expected);
+                }
+
+        BOOST_CHECK_EQUAL(masked_max(roi,roi_mask),-2.f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_mask_types)
+    {
+        //only byte masks and bitmask_array select elements 
+        BOOST_CHECK(is_mask_array<dynamic_array<bool_t>>::value);
+        BOOST_CHECK(is_mask_array<dynamic_array<uint8>>::value);
+        BOOST_CHECK((is_mask_array<fixed_dim_array<uint8,2>>::value));
+        BOOST_CHECK(is_mask_array<bitmask_array>::value);
+        auto view = mask(slice(0,37),slice(0,45));
+        BOOST_CHECK(is_mask_array<decltype(view)>::value);
+        BOOST_CHECK(!is_mask_array<dynamic_array<float64>>::value);
+        BOOST_CHECK(!is_mask_array<dynamic_array<int32>>::value);
+        BOOST_CHECK(!is_mask_array<std::vector<bool_t>>::value);
+        BOOST_CHECK(!is_mask_array<size_t>::value);
+
+        typedef dynamic_array<float32> array_type;
+        typedef decltype(view) mask_view_type;
+        BOOST_CHECK((has_masked_access<array_type,bitmask_array>::value));
+        BOOST_CHECK((has_masked_access<array_type,mask_view_type>::value));
+        BOOST_CHECK((!has_masked_access<array_type,
+                                        dynamic_array<float64>>::value));
+        BOOST_CHECK((!has_masked_access<array_type,
+                                        dynamic_array<int32>>::value));
+
+        //the linear [] operator is used for integer arguments
+        auto a = create_array<dynamic_array<float32>>(shape_t{37,45});
+        BOOST_CHECK_EQUAL(a[10],10.f);
+        BOOST_CHECK_EQUAL(a(slice(0,37),slice(0,45))[10],10.f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        auto a = create_array<dynamic_array<float32>>(shape_t{37,44});
+        BOOST_CHECK_THROW(a[mask] = 1.f,size_mismatch_error);
+        BOOST_CHECK_THROW(masked_fill(a,mask,1.f),size_mismatch_error);
+        BOOST_CHECK_THROW(masked_sum(a,mask),size_mismatch_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,252 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <cmath>
+#include <complex>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<float32,float64> plane_types;
+
+//
+// the shape (13,37) is not a multiple of the packet size - the last 
+// elements of all expressions are evaluated element wise
+//
+template<typename T> struct soa_complex_fixture
+{
+    typedef std::complex<T> complex_type;
+    typedef soa_complex_array<T> array_type;
+    typedef dynamic_array<complex_type> interleaved_type;
+    typedef dynamic_array<T> real_type;
+
+    shape_t shape;
+    interleaved_type ia,ib;
+    real_type r;
+    array_type a,b;
+
+    soa_complex_fixture():
+        shape{13,37},
+        ia(interleaved_type::create(shape)),
+        ib(interleaved_type::create(shape)),
+        r(real_type::create(shape)),
+        a(),
+        b()
+    {
+        for(size_t i=0;i<ia.size();++i)
+        {
+            ia[i] = complex_type(T(i%17)-T(8),T(0.5)*T(i%11));
+            ib[i] = complex_type(T(1)+T(i%5),T(i%7)-T(3));
+            r[i]  = T(0.25)*T(i%9);
+        }
+        a = array_type(ia);
+        b = array_type(ib);
+    }
+};
+
+//
+// packet evaluation may round differently (fused multiply add)
+//
+template<
+         typename VTYPE,
+         typename T
+        > 
+void check_close(const VTYPE &a,const std::complex<T> &b)
+{
+    T tol = std::numeric_limits<T>::epsilon()*T(16);
+    BOOST_CHECK_SMALL(std::abs(std::complex<T>(a)-b),tol*(T(1)+std::abs(b)));
+}
+
+BOOST_AUTO_TEST_SUITE(soa_complex_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_creation,T,plane_types)
+    {
+        typedef soa_complex_array<T> array_type;
+
+        auto z = array_type::create(shape_t{3,4});
+        BOOST_CHECK_EQUAL(z.size(),12u);
+        BOOST_CHECK_EQUAL(z.rank(),2u);
+        auto s = z.template shape<shape_t>();
+        BOOST_CHECK_EQUAL(s[0],3u);
+        BOOST_CHECK_EQUAL(s[1],4u);
+        for(auto v: z) BOOST_CHECK_EQUAL(v,std::complex<T>());
+
+        z(1,2) = std::complex<T>(1,-2);
+        BOOST_CHECK_EQUAL(z[6],std::complex<T>(1,-2));
+        BOOST_CHECK_EQUAL(z(shape_t{1,2}).real(),T(1));
+        BOOST_CHECK_EQUAL(z.real()[6],T(1));
+        BOOST_CHECK_EQUAL(z.imag()[6],T(-2));
+        z[0] = z[6];
+        BOOST_CHECK_EQUAL(z.at(0),std::complex<T>(1,-2));
+        BOOST_CHECK_THROW(z.at(12),index_error);
+
+        z.fill(std::complex<T>(3,4));
+        BOOST_CHECK_EQUAL(std::count(z.begin(),z.end(),std::complex<T>(3,4)),
+                          12);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_conversion,T,plane_types)
+    {
+        soa_complex_fixture<T> f;
+
+        for(size_t i=0;i<f.ia.size();++i)
+        {
+            BOOST_CHECK_EQUAL(f.a[i],f.ia[i]);
+            BOOST_CHECK_EQUAL(f.a.real()[i],f.ia[i].real());
+            BOOST_CHECK_EQUAL(f.a.imag()[i],f.ia[i].imag());
+        }
+
+        auto c = decltype(f.ia)::create(f.shape);
+        interleave(f.a,c);
+        BOOST_CHECK(std::equal(c.begin(),c.end(),f.ia.begin()));
+
+        //a strided destination is written element by element
+        auto d = decltype(f.ia)::create(shape_t{13,74});
+        auto v = d(slice(0,13),slice(0,74,2));
+        interleave(f.a,v);
+        for(size_t i=0;i<v.size();++i) BOOST_CHECK_EQUAL(v[i],f.ia[i]);
+        BOOST_CHECK_THROW(interleave(f.a,d),size_mismatch_error);
+
+        //real arrays and views
+        f.b = f.r;
+        for(size_t i=0;i<f.r.size();++i)
+            BOOST_CHECK_EQUAL(f.b[i],std::complex<T>(f.r[i]));
+
+        f.b = f.ia(slice(0,13),slice(0,37));
+        for(size_t i=0;i<f.ia.size();++i) BOOST_CHECK_EQUAL(f.b[i],f.ia[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_planes,T,plane_types)
+    {
+        soa_complex_fixture<T> f;
+
+        //the planes refer to the data of the array
+        f.a.real() *= T(2);
+        f.a.imag() = f.r;
+        for(size_t i=0;i<f.a.size();++i)
+            BOOST_CHECK_EQUAL(f.a[i],std::complex<T>(T(2)*f.ia[i].real(),
+                                                     f.r[i]));
+
+        auto abs = dynamic_array<T>(f.b.abs());
+        auto arg = dynamic_array<T>(f.b.arg());
+        auto sum = dynamic_array<T>(f.b.abs()+f.r);
+        const auto lazy = f.b.abs();
+        for(size_t i=0;i<f.b.size();++i)
+        {
+            BOOST_CHECK_CLOSE(abs[i],std::abs(f.ib[i]),1e-4);
+            BOOST_CHECK_CLOSE(lazy[i],std::abs(f.ib[i]),1e-4);
+            BOOST_CHECK_CLOSE(arg[i],std::arg(f.ib[i]),1e-4);
+            BOOST_CHECK_CLOSE(sum[i],std::abs(f.ib[i])+f.r[i],1e-4);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_arithmetic,T,plane_types)
+    {
+        typedef std::complex<T> complex_type;
+        soa_complex_fixture<T> f;
+        auto z = soa_complex_array<T>::create(f.shape);
+        complex_type s(T(0.5),T(-2));
+
+        z = f.a*f.b+f.a;
+        for(size_t i=0;i<z.size();++i) 
+            check_close(z[i],f.ia[i]*f.ib[i]+f.ia[i]);
+
+        z = f.a*s-f.b*T(3);
+        for(size_t i=0;i<z.size();++i) 
+            check_close(z[i],f.ia[i]*s-f.ib[i]*T(3));
+
+        //real operands change only the real part in sums
+        z = f.a+f.r*f.r-T(1);
+        for(size_t i=0;i<z.size();++i) 
+            check_close(z[i],f.ia[i]+f.r[i]*f.r[i]-T(1));
+
+        z = f.a*f.r-f.b;
+        for(size_t i=0;i<z.size();++i) 
+            check_close(z[i],f.ia[i]*f.r[i]-f.ib[i]);
+
+        //divisions are evaluated element by element
+        z = f.a/f.b;
+        for(size_t i=0;i<z.size();++i) 
+            BOOST_CHECK_EQUAL(z[i],f.ia[i]/f.ib[i]);
+
+        //mixed with interleaved arrays
+        z = f.a-f.ib;
+        for(size_t i=0;i<z.size();++i) 
+            BOOST_CHECK_EQUAL(z[i],f.ia[i]-f.ib[i]);
+
+        BOOST_CHECK_THROW(z = f.a.real()(slice(0,2),slice(0,37)),
+                          size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_inplace_arithmetic,T,plane_types)
+    {
+        typedef std::complex<T> complex_type;
+        soa_complex_fixture<T> f;
+        auto ref = dynamic_array<complex_type>(f.ia);
+
+        f.a *= f.b;
+        f.a += complex_type(1,1);
+        f.a -= f.r;
+        f.a /= T(2);
+        for(size_t i=0;i<ref.size();++i)
+        {
+            ref[i] *= f.ib[i];
+            ref[i] += complex_type(1,1);
+            ref[i] -= f.r[i];
+            ref[i] /= T(2);
+            check_close(f.a[i],ref[i]);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_broadcast,T,plane_types)
+    {
+        typedef std::complex<T> complex_type;
+        soa_complex_fixture<T> f;
+
+        auto row = soa_complex_array<T>::create(shape_t{37});
+        for(size_t j=0;j<37;++j) row[j] = complex_type(T(j),T(1));
+
+        auto z = soa_complex_array<T>::create(f.shape);
+        z = f.a*row;
+        for(size_t i=0;i<13;++i)
+            for(size_t j=0;j<37;++j)
+                check_close(z(i,j),f.ia(i,j)*complex_type(T(j),T(1)));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
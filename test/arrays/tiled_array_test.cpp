@@ -0,0 +1,203 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef tiled_array<int32,4> tarray_type;
+typedef mdarray<std::vector<int32>,fixed_dim_tiled_index_map<3,4>> tvolume_type;
+typedef dynamic_array<int32> carray_type;
+
+struct tiled_array_fixture
+{
+    tarray_type t;
+    carray_type c;
+
+    tiled_array_fixture():
+        t(tarray_type::create(shape_t{10,6})),
+        c(carray_type::create(shape_t{10,6}))
+    {
+        std::iota(t.begin(),t.end(),0);
+        std::iota(c.begin(),c.end(),0);
+    }
+};
+
+//
+// the linear index of a view must follow the tiled order of its shape
+//
+template<typename VTYPE> void check_tiled_order(const VTYPE &view)
+{
+    const auto &map = view.map();
+    for(size_t index=0;index<view.size();++index)
+        BOOST_CHECK_EQUAL(view[index],view(map.template index<shape_t>(index)));
+
+    size_t index = 0;
+    for(auto iter = view.begin();iter!=view.end();++iter,++index)
+        BOOST_CHECK_EQUAL(*iter,view[index]);
+
+    auto iter = view.end();
+    while(iter!=view.begin())
+        BOOST_CHECK_EQUAL(*(--iter),view[--index]);
+
+    for(size_t i=0;i<view.size();i+=3)
+        BOOST_CHECK_EQUAL(*(view.begin()+i),view[i]);
+
+    const int32 *ptr = view.array().data();
+    for(auto seg: view.segments())
+        BOOST_CHECK_EQUAL(ptr[seg.offset],view[index++]);
+    BOOST_CHECK_EQUAL(index,view.size());
+}
+
+BOOST_AUTO_TEST_SUITE(tiled_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_layout)
+    {
+        tiled_array_fixture f;
+
+        //the first tile holds the (4,4) block at the origin
+        BOOST_CHECK_EQUAL(f.t(0,3),3);
+        BOOST_CHECK_EQUAL(f.t(1,0),4);
+        BOOST_CHECK_EQUAL(f.t(3,3),15);
+        //the truncated tile at the end of the first row of tiles
+        BOOST_CHECK_EQUAL(f.t(0,4),16);
+        BOOST_CHECK_EQUAL(f.t(1,4),18);
+        BOOST_CHECK_EQUAL(f.t(5,3),31);
+        BOOST_CHECK_EQUAL(f.t(9,5),59);
+
+        auto v = tvolume_type::create(shape_t{5,6,7});
+        std::iota(v.begin(),v.end(),0);
+        BOOST_CHECK_EQUAL(v(1,2,3),27);
+        BOOST_CHECK_EQUAL(v(4,5,6),209);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        tiled_array_fixture f;
+
+        auto roi = f.t(slice(3,8),slice(1,5));
+        BOOST_CHECK(!roi.is_contiguous());
+        BOOST_CHECK_EQUAL(roi.run_length(),1u);
+        BOOST_CHECK_EQUAL(roi.segments().size(),roi.size());
+        for(size_t i=0;i<5;++i)
+            for(size_t j=0;j<4;++j)
+                BOOST_CHECK_EQUAL(roi(i,j),f.t(3+i,1+j));
+        check_tiled_order(roi);
+
+        //a band of full tiles is not contiguous in the order of the view
+        auto band = f.t(slice(0,4),slice(0,6));
+        BOOST_CHECK(!band.is_contiguous());
+        check_tiled_order(band);
+
+        auto column = f.t(slice(0,10,2),3);
+        BOOST_CHECK_EQUAL(column.rank(),1u);
+        for(size_t i=0;i<5;++i)
+            BOOST_CHECK_EQUAL(column[i],f.t(2*i,3));
+        check_tiled_order(column);
+
+        std::fill(roi.begin(),roi.end(),-1);
+        BOOST_CHECK_EQUAL(std::count(f.t.begin(),f.t.end(),-1),20);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_conversion)
+    {
+        tiled_array_fixture f;
+
+        auto t = tarray_type::create(shape_t{10,6});
+        to_tiled(f.c,t);
+        for(size_t i=0;i<10;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(t(i,j),f.c(i,j));
+
+        auto c = carray_type::create(shape_t{10,6});
+        from_tiled(f.t,c);
+        for(size_t i=0;i<10;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(c(i,j),f.t(i,j));
+
+        auto wrong = carray_type::create(shape_t{6,10});
+        BOOST_CHECK_THROW(from_tiled(f.t,wrong),shape_mismatch_error);
+
+        //the general conversion gives the same result
+        carray_type c2(f.t);
+        BOOST_CHECK(std::equal(c.begin(),c.end(),c2.begin()));
+
+        //expressions with tiled operands
+        t = f.t+f.t;
+        for(size_t i=0;i<10;++i)
+            for(size_t j=0;j<6;++j)
+                BOOST_CHECK_EQUAL(t(i,j),2*f.t(i,j));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_copies)
+    {
+        tiled_array_fixture f;
+
+        //C-ordered view to a tiled array
+        tarray_type roi(f.c(slice(2,9),slice(1,6)));
+        for(size_t i=0;i<7;++i)
+            for(size_t j=0;j<5;++j)
+                BOOST_CHECK_EQUAL(roi(i,j),f.c(2+i,1+j));
+
+        //tiled view to a tiled array
+        tarray_type troi(f.t(slice(2,9),slice(1,6)));
+        for(size_t i=0;i<7;++i)
+            for(size_t j=0;j<5;++j)
+                BOOST_CHECK_EQUAL(troi(i,j),f.t(2+i,1+j));
+
+        //tiled array to a C-ordered view
+        auto view = f.c(slice(3,10),slice(0,5));
+        view = troi;
+        for(size_t i=0;i<7;++i)
+            for(size_t j=0;j<5;++j)
+                BOOST_CHECK_EQUAL(f.c(3+i,j),troi(i,j));
+
+        //tiled array to a tiled view
+        auto tview = f.t(slice(0,7),slice(1,6));
+        tview = troi;
+        for(size_t i=0;i<7;++i)
+            for(size_t j=0;j<5;++j)
+                BOOST_CHECK_EQUAL(f.t(i,1+j),troi(i,j));
+
+        //tiled view to memory
+        std::vector<int32> buffer(tview.size());
+        tview.copy_to(buffer.data());
+        BOOST_CHECK_EQUAL_COLLECTIONS(buffer.begin(),buffer.end(),
+                                      troi.begin(),troi.end());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef dynamic_array<int32> array_type;
+
+struct view_iterator_fixture
+{
+    array_type data;
+
+    view_iterator_fixture():
+        data(array_type::create(shape_t{6,7,8}))
+    {
+        std::iota(data.begin(),data.end(),0);
+    }
+};
+
+//
+// check the iterator against the [] operator of the view
+//
+template<typename VTYPE> void check_iteration(VTYPE &view)
+{
+    size_t index = 0;
+    for(auto iter = view.begin();iter!=view.end();++iter,++index)
+        BOOST_CHECK_EQUAL(*iter,view[index]);
+    BOOST_CHECK_EQUAL(index,view.size());
+
+    //backwards
+    auto iter = view.end();
+    while(iter!=view.begin())
+    {
+        --iter;
+        --index;
+        BOOST_CHECK_EQUAL(*iter,view[index]);
+    }
+    BOOST_CHECK_EQUAL(index,0u);
+
+    //random access
+    for(size_t i=0;i<view.size();i+=5)
+    {
+        auto i1 = view.begin()+i;
+        BOOST_CHECK_EQUAL(*i1,view[i]);
+        BOOST_CHECK_EQUAL(i1-view.begin(),ssize_t(i));
+
+        auto i2 = view.end()-(i+1);
+        BOOST_CHECK_EQUAL(*i2,view[view.size()-i-1]);
+    }
+
+    //const iteration
+    const VTYPE &cview = view;
+    BOOST_CHECK(std::equal(cview.begin(),cview.end(),view.begin()));
+}
+
+BOOST_FIXTURE_TEST_SUITE(view_iterator_test,view_iterator_fixture)
+
+    BOOST_AUTO_TEST_CASE(test_contiguous)
+    {
+        auto view = data(slice(1,3),slice(0,7),slice(0,8));
+        BOOST_CHECK(view.is_contiguous());
+        check_iteration(view);
+        BOOST_CHECK_EQUAL(view.run_length(),view.size());
+        BOOST_CHECK_EQUAL(view.begin().run_length(),view.size());
+        BOOST_CHECK_EQUAL((view.begin()+10).run_length(),view.size()-10);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_rows)
+    {
+        //full rows of a frame range - runs along the last two dimensions
+        auto v1 = data(slice(0,6),slice(2,5),slice(0,8));
+        check_iteration(v1);
+        BOOST_CHECK_EQUAL(v1.run_length(),24u);
+
+        //partial rows
+        auto v2 = data(slice(1,5),slice(2,5),slice(3,7));
+        check_iteration(v2);
+        BOOST_CHECK_EQUAL(v2.run_length(),4u);
+        auto iter = v2.begin()+1;
+        BOOST_CHECK_EQUAL(iter.run_length(),3u);
+        BOOST_CHECK_EQUAL(iter.data(),&(*iter));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_strided)
+    {
+        auto v1 = data(slice(0,6,2),slice(1,7,3),slice(0,8,3));
+        check_iteration(v1);
+        BOOST_CHECK_EQUAL(v1.run_length(),1u);
+        BOOST_CHECK_EQUAL(v1.begin().run_length(),1u);
+
+        //reduced rank
+        auto v2 = data(2,slice(0,7,2),slice(1,8));
+        BOOST_CHECK_EQUAL(v2.rank(),2u);
+        check_iteration(v2);
+
+        auto v3 = data(slice(0,6),3,4);
+        BOOST_CHECK_EQUAL(v3.rank(),1u);
+        check_iteration(v3);
+        BOOST_CHECK_EQUAL(v3.run_length(),1u);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_algorithms)
+    {
+        auto view = data(slice(1,5),slice(0,7,2),slice(2,8));
+
+        int32 sum = 0;
+        for(size_t i=0;i<view.size();++i) sum += view[i];
+        BOOST_CHECK_EQUAL(std::accumulate(view.begin(),view.end(),0),sum);
+
+        std::vector<int32> buffer(view.size());
+        std::copy(view.begin(),view.end(),buffer.begin());
+        for(size_t i=0;i<view.size();++i) 
+            BOOST_CHECK_EQUAL(buffer[i],view[i]);
+
+        std::fill(view.begin(),view.end(),-1);
+        BOOST_CHECK_EQUAL(std::count(data.begin(),data.end(),-1),
+                          ssize_t(view.size()));
+
+        //process the view run by run
+        auto iter = view.begin();
+        while(iter!=view.end())
+        {
+            size_t n = iter.run_length();
+            std::fill(iter.data(),iter.data()+n,-2);
+            iter += n;
+        }
+        BOOST_CHECK_EQUAL(std::count(data.begin(),data.end(),-2),
+                          ssize_t(view.size()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_invalid)
+    {
+        auto view = data(slice(0,6,2),slice(0,7),slice(0,8,2));
+        auto iter = view.end();
+        BOOST_CHECK(!iter);
+        BOOST_CHECK_THROW(*iter,iterator_error);
+        BOOST_CHECK(view.begin());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
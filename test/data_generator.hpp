@@ -166,6 +166,33 @@ template<typename T> class random_generator<std::complex<T>>
         }
 };
 
+//-----------------------------------------------------------------------------
+//!
+//! \brief 16Bit floating point random generator
+//!
+//! The values are generated as float32 and rounded to the 16Bit type. 
+//!
+template<typename FORMAT> class random_generator<half_t<FORMAT>>
+{
+    private:
+        typedef half_t<FORMAT> value_type;
+        typedef pni::core::type_info<value_type> tinfo_type;
+        random_generator<float32> _generator;
+    public:
+        random_generator(value_type a,value_type b):
+            _generator(a,b)
+        {}
+
+        random_generator():
+            _generator(0.2f*tinfo_type::min(),0.2f*tinfo_type::max())
+        {}
+
+        value_type operator()()
+        {
+            return _generator();
+        }
+};
+
 //-----------------------------------------------------------------------------
 template<> class random_generator<bool_t>
 {
@@ -36,6 +36,9 @@
 extern int cindex_implementation_test_init();
 extern int dynamic_cindex_map_test_init();
 extern int fixed_dim_cindex_map_test_init();
+extern int findex_implementation_test_init();
+extern int dynamic_findex_map_test_init();
+extern int tiled_implementation_test_init();
 
 
 bool init_function()
@@ -43,6 +46,9 @@ bool init_function()
     cindex_implementation_test_init();
     dynamic_cindex_map_test_init();
     fixed_dim_cindex_map_test_init();
+    findex_implementation_test_init();
+    dynamic_findex_map_test_init();
+    tiled_implementation_test_init();
     return true;
 }
 
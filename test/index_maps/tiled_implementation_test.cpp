@@ -0,0 +1,217 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 18, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/test/parameterized_test.hpp>
+#include <vector>
+#include <list>
+#include <array>
+#include <algorithm>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays/index_map/c_index_map_imp.hpp>
+#include <pni/core/arrays/index_map/tiled_index_map_imp.hpp>
+#include <pni/core/arrays/array_selection.hpp>
+
+using namespace pni::core;
+using namespace boost::unit_test;
+
+namespace tiled_implementation_test
+{
+
+    typedef tiled_index_map_imp<4> map_type; 
+    typedef array_selection sel_type;
+    typedef std::vector<slice> slice_vector;
+    typedef std::vector<size_t> index_type;
+    typedef std::vector<index_type> shape_list;
+
+    typedef struct{
+        index_type shape;
+        index_type index;
+        size_t expected_offset; 
+    } offset_test_arg;
+
+    typedef std::vector<offset_test_arg> offset_test_args;
+
+    typedef struct{
+        slice_vector sel;
+        index_type shape;
+        index_type sel_index;
+        size_t expected_offset;
+    } sel_offset_test_arg;
+
+    typedef std::vector<sel_offset_test_arg> sel_offset_test_args;
+
+    //------------------------------------------------------------------------
+    void test_index(const offset_test_arg &arg)
+    {
+        shape_t index(arg.shape.size());
+        map_type::index(arg.shape,index,arg.expected_offset);
+        BOOST_CHECK_EQUAL_COLLECTIONS(index.begin(),index.end(),
+                                      arg.index.begin(),arg.index.end());
+    }
+
+    //------------------------------------------------------------------------
+    void test_offset(const offset_test_arg &arg)
+    {
+        BOOST_CHECK_EQUAL(map_type::offset(arg.shape,arg.index),
+                          arg.expected_offset);
+    }
+
+    //------------------------------------------------------------------------
+    void test_selection_offset(const sel_offset_test_arg &arg)
+    {
+        array_selection s = array_selection::create(arg.sel);
+        BOOST_CHECK_EQUAL(map_type::offset(s,arg.shape,arg.sel_index),
+                          arg.expected_offset);
+    }
+
+    //------------------------------------------------------------------------
+    // every offset must be hit exactly once and index() must be the inverse 
+    // of offset()
+    void test_bijection(const index_type &shape)
+    {
+        size_t size = 1;
+        for(auto n: shape) size *= n;
+
+        std::vector<size_t> hits(size,0);
+        index_type index(shape.size());
+        for(size_t i=0;i<size;++i)
+        {
+            c_index_map_imp::index(shape,index,i);
+            size_t o = map_type::offset(shape,index);
+            BOOST_REQUIRE(o<size);
+            hits[o]++;
+
+            index_type result(shape.size());
+            map_type::index(shape,result,o);
+            BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),result.end(),
+                                          index.begin(),index.end());
+        }
+
+        BOOST_CHECK(std::all_of(hits.begin(),hits.end(),
+                                [](size_t h){ return h==1; }));
+    }
+
+    //------------------------------------------------------------------------
+    // the runs must cover all elements and map C offsets to tiled offsets
+    void test_runs(const index_type &shape)
+    {
+        size_t size = 1;
+        for(auto n: shape) size *= n;
+
+        size_t total = 0;
+        index_type index(shape.size());
+        map_type::for_each_run(shape,
+                [&](size_t c_offset,size_t tiled_offset,size_t n)
+                {
+                    BOOST_CHECK_EQUAL(tiled_offset,total);
+                    for(size_t i=0;i<n;++i)
+                    {
+                        c_index_map_imp::index(shape,index,c_offset+i);
+                        BOOST_CHECK_EQUAL(map_type::offset(shape,index),
+                                          tiled_offset+i);
+                    }
+                    total += n;
+                });
+
+        BOOST_CHECK_EQUAL(total,size);
+    }
+
+    //------------------------------------------------------------------------
+    // the unrolled computation for std::array indexes must agree with the 
+    // generic one - for power of two and other tile sizes
+    template<typename MAPT> void check_fixed_rank(const index_type &shape)
+    {
+        index_type index(3);
+        for(index[0]=0;index[0]<shape[0];++index[0])
+            for(index[1]=0;index[1]<shape[1];++index[1])
+                for(index[2]=0;index[2]<shape[2];++index[2])
+                {
+                    std::array<size_t,3> aindex{{index[0],index[1],index[2]}};
+                    BOOST_CHECK_EQUAL(MAPT::offset(shape,aindex),
+                                      MAPT::offset(shape,index));
+                }
+    }
+
+    void test_fixed_rank()
+    {
+        check_fixed_rank<map_type>({5,6,7});
+        check_fixed_rank<map_type>({8,4,9});
+        check_fixed_rank<tiled_index_map_imp<3>>({5,6,7});
+    }
+
+}
+
+
+//============================================================================
+int tiled_implementation_test_init()
+{
+    namespace test_ns = tiled_implementation_test;  
+
+    test_suite *ts = BOOST_TEST_SUITE("tiled_implementation_test");
+    test_ns::offset_test_args offset_args = {{{10},{5},5},
+                                             {{10,6},{5,3},31},
+                                             {{10,6},{9,5},59},
+                                             {{5,6,7},{1,2,3},27},
+                                             {{5,6,7},{4,5,6},209}};
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_index,
+                                  offset_args.begin(),
+                                  offset_args.end()));
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_offset,
+                                  offset_args.begin(),
+                                  offset_args.end()));
+
+    test_ns::sel_offset_test_args soffset_args = {
+    {{slice(5,7)},{10},{1},6},
+    {{slice(3,8),slice(1,5)},{10,6},{2,3},42},
+    {{slice(5,6),slice(0,6)},{10,6},{3},31}
+    };
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_selection_offset,
+                                  soffset_args.begin(),
+                                  soffset_args.end()));
+
+    test_ns::shape_list shapes = {{10},{8,8},{10,6},{3,9},{5,6,7}};
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_bijection,
+                                  shapes.begin(),shapes.end()));
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_runs,
+                                  shapes.begin(),shapes.end()));
+
+    ts->add(BOOST_TEST_CASE(&test_ns::test_fixed_rank));
+
+    framework::master_test_suite().add(ts);
+
+    return 0;
+}
+
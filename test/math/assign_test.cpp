@@ -0,0 +1,161 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/assign.hpp>
+#include "../data_generator.hpp"
+
+using namespace pni::core;
+
+typedef boost::mpl::list<dynamic_array<int32>,
+                         dynamic_array<uint8>,
+                         dynamic_array<float32>,
+                         dynamic_array<float64>,
+                         dynamic_array<complex64>
+                        > assign_array_types;
+
+//
+// force parallel execution with 4 threads for even the smallest arrays
+//
+template<typename AT> struct assign_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef typename type_info<value_type>::base_type base_type;
+    typedef random_generator<value_type> generator_type;
+
+    size_t nthreads;
+    size_t threshold;
+    shape_t shape;
+    generator_type generator;
+    AT a,b,c,r;
+
+    assign_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold()),
+        shape(shape_t{5,37,71}),
+        generator(base_type(1),base_type(10)),
+        a(AT::create(shape)),
+        b(AT::create(shape)),
+        c(AT::create(shape)),
+        r(AT::create(shape))
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+
+        std::generate(a.begin(),a.end(),generator);
+        std::generate(b.begin(),b.end(),generator);
+        std::generate(c.begin(),c.end(),generator);
+    }
+
+    ~assign_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(assign_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_parallel,AT,assign_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        assign_fixture<AT> f;
+
+        assign(f.r,f.a*f.b - f.c,parallel_execution());
+        for(size_t i=0;i<f.r.size();++i)
+            BOOST_CHECK_EQUAL(f.r[i],value_type(value_type(f.a[i]*f.b[i])-f.c[i]));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_sequential,AT,assign_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        assign_fixture<AT> f;
+
+        assign(f.r,f.a + f.b,sequential_execution());
+        for(size_t i=0;i<f.r.size();++i)
+            BOOST_CHECK_EQUAL(f.r[i],value_type(f.a[i]+f.b[i]));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_leaves)
+    {
+        assign_fixture<dynamic_array<float64>> f;
+
+        auto va = f.a(slice(0,5),slice(0,37),slice(0,70,2));
+        auto vb = f.b(slice(0,5),slice(0,37),slice(1,71,2));
+        BOOST_CHECK(!va.is_contiguous());
+        auto r = dynamic_array<float64>::create(va.shape<shape_t>());
+
+        assign(r,va*vb + 2.,parallel_execution());
+        for(size_t i=0;i<r.size();++i)
+            BOOST_CHECK_EQUAL(r[i],va[i]*vb[i]+2.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_destination)
+    {
+        assign_fixture<dynamic_array<float32>> f;
+        std::fill(f.r.begin(),f.r.end(),-1.f);
+
+        auto vr = f.r(slice(0,5),slice(0,37),slice(0,71,3));
+        auto va = f.a(slice(0,5),slice(0,37),slice(0,71,3));
+        auto vb = f.b(slice(0,5),slice(0,37),slice(0,71,3));
+
+        assign(vr,va/vb,parallel_execution());
+        for(size_t i=0;i<5;++i)
+            for(size_t j=0;j<37;++j)
+                for(size_t k=0;k<71;++k)
+                {
+                    if(k%3)
+                        BOOST_CHECK_EQUAL(f.r(i,j,k),-1.f);
+                    else
+                        BOOST_CHECK_EQUAL(f.r(i,j,k),f.a(i,j,k)/f.b(i,j,k));
+                }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_size_mismatch)
+    {
+        assign_fixture<dynamic_array<float64>> f;
+        auto r = dynamic_array<float64>::create(shape_t{10});
+
+        BOOST_CHECK_THROW(assign(r,f.a+f.b,parallel_execution()),
+                          size_mismatch_error);
+        BOOST_CHECK_THROW(assign(r,f.a+f.b,sequential_execution()),
+                          size_mismatch_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,306 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+#include <numeric>
+#include "../data_generator.hpp"
+
+using namespace pni::core;
+
+template<typename T>
+using simd_array = mdarray<std::vector<T>,dynamic_cindex_map,
+                           simd_inplace_arithmetics>;
+template<typename T>
+using parallel_array = mdarray<std::vector<T>,dynamic_cindex_map,
+                               parallel_inplace_arithmetics>;
+
+typedef boost::mpl::list<dynamic_array<int32>,
+                         dynamic_array<float32>,
+                         dynamic_array<float64>,
+                         simd_array<int32>,
+                         simd_array<float32>,
+                         simd_array<float64>,
+                         parallel_array<float64>
+                        > broadcast_array_types;
+
+//
+// a frame stack with a per pixel map, a per frame vector, a row and a 
+// column - the width is chosen such that there is a remainder for every 
+// packet size
+//
+template<typename AT> struct broadcast_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef typename type_info<value_type>::base_type base_type;
+    typedef random_generator<value_type> generator_type;
+
+    generator_type generator;
+    AT frames,map,vector,row,column,r;
+
+    broadcast_fixture():
+        generator(base_type(1),base_type(10)),
+        frames(AT::create(shape_t{4,9,37})),
+        map(AT::create(shape_t{9,37})),
+        vector(AT::create(shape_t{4,1,1})),
+        row(AT::create(shape_t{37})),
+        column(AT::create(shape_t{9,1})),
+        r(AT::create(shape_t{4,9,37}))
+    {
+        std::generate(frames.begin(),frames.end(),generator);
+        std::generate(map.begin(),map.end(),generator);
+        std::generate(vector.begin(),vector.end(),generator);
+        std::generate(row.begin(),row.end(),generator);
+        std::generate(column.begin(),column.end(),generator);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(broadcast_test)
+
+    BOOST_AUTO_TEST_CASE(test_broadcast_shape)
+    {
+        BOOST_CHECK(broadcast_shape(shape_t{4,9,37},shape_t{9,37})==
+                    (shape_t{4,9,37}));
+        BOOST_CHECK(broadcast_shape(shape_t{4,1,1},shape_t{9,37})==
+                    (shape_t{4,9,37}));
+        BOOST_CHECK(broadcast_shape(shape_t{9,1},shape_t{37})==
+                    (shape_t{9,37}));
+        BOOST_CHECK(broadcast_shape(shape_t(),shape_t{3})==(shape_t{3}));
+
+        BOOST_CHECK_THROW(broadcast_shape(shape_t{4,9,37},shape_t{9,36}),
+                          shape_mismatch_error);
+        BOOST_CHECK_THROW(broadcast_shape(shape_t{4,9},shape_t{4}),
+                          shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_broadcast_map)
+    {
+        //per pixel map - a run covers a frame
+        broadcast_map m1(shape_t{1,9,37},shape_t{4,9,37});
+        BOOST_CHECK(!m1.is_identity());
+        BOOST_CHECK_EQUAL(m1.run(),9u*37u);
+        BOOST_CHECK_EQUAL(m1.step(),1u);
+
+        //per frame vector - a run covers a single element
+        broadcast_map m2(shape_t{4,1,1},shape_t{4,9,37});
+        BOOST_CHECK_EQUAL(m2.run(),9u*37u);
+        BOOST_CHECK_EQUAL(m2.step(),0u);
+
+        //column 
+        broadcast_map m3(shape_t{1,9,1},shape_t{4,9,37});
+        BOOST_CHECK_EQUAL(m3.run(),37u);
+        BOOST_CHECK_EQUAL(m3.step(),0u);
+
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                {
+                    size_t index = (n*9+i)*37+j;
+                    BOOST_CHECK_EQUAL(m1(index),i*37+j);
+                    BOOST_CHECK_EQUAL(m2(index),n);
+                    BOOST_CHECK_EQUAL(m3(index),i);
+                }
+
+        BOOST_CHECK(broadcast_map().is_identity());
+        BOOST_CHECK_EQUAL(broadcast_map()(100),100u);
+        BOOST_CHECK_THROW(broadcast_map(shape_t{1,8,37},shape_t{4,9,37}),
+                          shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expressions,AT,broadcast_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        broadcast_fixture<AT> f;
+
+        f.r = f.frames - f.map;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                    BOOST_CHECK_EQUAL(f.r(n,i,j),
+                                      value_type(f.frames(n,i,j)-f.map(i,j)));
+
+        f.r = f.frames*f.vector + f.row;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                    BOOST_CHECK_EQUAL(f.r(n,i,j),
+                            value_type(value_type(f.frames(n,i,j)*
+                                                  f.vector(n,0,0))+f.row[j]));
+
+        //the left operand is broadcast
+        f.r = f.map/f.frames;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                    BOOST_CHECK_EQUAL(f.r(n,i,j),
+                                      value_type(f.map(i,j)/f.frames(n,i,j)));
+
+        //both operands are broadcast
+        AT outer(f.column*f.row);
+        BOOST_CHECK(outer.template shape<shape_t>()==(shape_t{9,37}));
+        for(size_t i=0;i<9;++i)
+            for(size_t j=0;j<37;++j)
+                BOOST_CHECK_EQUAL(outer(i,j),value_type(f.column(i,0)*f.row[j]));
+
+        //broadcast expressions are evaluated element wise
+        f.r = f.frames + (f.map-f.row);
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                    BOOST_CHECK_EQUAL(f.r(n,i,j),
+                            value_type(f.frames(n,i,j)+
+                                       value_type(f.map(i,j)-f.row[j])));
+
+        BOOST_CHECK_THROW(f.frames+f.map(slice(0,8),slice(0,37)),
+                          shape_mismatch_error);
+
+        //operands with the same number of elements but different shapes
+        auto row = AT::create(shape_t{1,9});
+        std::generate(row.begin(),row.end(),f.generator);
+        AT square(f.column+row);
+        BOOST_CHECK(square.template shape<shape_t>()==(shape_t{9,9}));
+        for(size_t i=0;i<9;++i)
+            for(size_t j=0;j<9;++j)
+                BOOST_CHECK_EQUAL(square(i,j),
+                                  value_type(f.column(i,0)+row(0,j)));
+
+        auto transposed = AT::create(shape_t{37,9});
+        BOOST_CHECK_THROW(f.map+transposed,shape_mismatch_error);
+        BOOST_CHECK_THROW(f.map*transposed,shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_views,AT,broadcast_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        broadcast_fixture<AT> f;
+
+        //a single frame of the stack as a per pixel map
+        auto frame = f.frames(1,slice(0,9),slice(0,37));
+        f.r = f.frames - frame;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                    BOOST_CHECK_EQUAL(f.r(n,i,j),
+                            value_type(f.frames(n,i,j)-f.frames(1,i,j)));
+
+        //a non-contiguous view
+        auto columns = AT::create(shape_t{37,2});
+        std::generate(columns.begin(),columns.end(),f.generator);
+        auto row = columns(slice(0,37),1);
+        f.r = f.frames + row;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                    BOOST_CHECK_EQUAL(f.r(n,i,j),
+                            value_type(f.frames(n,i,j)+columns(j,1)));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_inplace,AT,broadcast_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        broadcast_fixture<AT> f;
+        AT orig(f.frames);
+
+        f.frames += f.map;
+        f.frames *= f.vector;
+        f.frames -= f.row;
+        f.frames /= f.column;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                {
+                    value_type v = orig(n,i,j);
+                    v += f.map(i,j);
+                    v *= f.vector(n,0,0);
+                    v -= f.row[j];
+                    v /= f.column(i,0);
+                    BOOST_CHECK_EQUAL(f.frames(n,i,j),v);
+                }
+
+        //the l.h.s. cannot be broadcast
+        BOOST_CHECK_THROW(f.map += f.frames,shape_mismatch_error);
+        BOOST_CHECK_THROW(f.map += f.column(slice(0,3),0),
+                          shape_mismatch_error);
+
+        //operands with the same number of elements but different shapes
+        auto a = AT::create(shape_t{2,3});
+        BOOST_CHECK_THROW(a += AT::create(shape_t{3,2}),shape_mismatch_error);
+        BOOST_CHECK_THROW(a -= AT::create(shape_t{3,2}),shape_mismatch_error);
+        BOOST_CHECK_THROW(a *= AT::create(shape_t{3,2}),shape_mismatch_error);
+        BOOST_CHECK_THROW(a /= AT::create(shape_t{3,2}),shape_mismatch_error);
+        auto c = AT::create(shape_t{4,1});
+        BOOST_CHECK_THROW(c += AT::create(shape_t{1,4}),shape_mismatch_error);
+
+        //the shapes are equal after padding
+        auto b = AT::create(shape_t{1,3});
+        std::generate(b.begin(),b.end(),f.generator);
+        std::generate(a.begin(),a.end(),f.generator);
+        AT a_orig(a);
+        a += b;
+        a -= AT::create(shape_t{3});
+        for(size_t i=0;i<2;++i)
+            for(size_t j=0;j<3;++j)
+                BOOST_CHECK_EQUAL(a(i,j),value_type(a_orig(i,j)+b(0,j)));
+        AT r(b);
+        r += AT::create(shape_t{3});
+        for(size_t j=0;j<3;++j) BOOST_CHECK_EQUAL(r[j],b[j]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_fortran_order)
+    {
+        typedef mdarray<std::vector<int32>,dynamic_findex_map> farray_type;
+        auto frames = farray_type::create(shape_t{4,9,37});
+        auto map = farray_type::create(shape_t{9,37});
+        std::iota(frames.begin(),frames.end(),0);
+        std::iota(map.begin(),map.end(),1000);
+
+        farray_type r(frames + map);
+        frames += map;
+        for(size_t n=0;n<4;++n)
+            for(size_t i=0;i<9;++i)
+                for(size_t j=0;j<37;++j)
+                {
+                    BOOST_CHECK_EQUAL(r(n,i,j),frames(n,i,j));
+                    BOOST_CHECK_EQUAL(r(n,i,j),
+                            int32(frames.map().offset(shape_t{n,i,j}))+
+                            map(i,j));
+                }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
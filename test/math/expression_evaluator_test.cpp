@@ -0,0 +1,221 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
+#include <cmath>
+#include "../data_generator.hpp"
+
+using namespace pni::core;
+
+typedef boost::mpl::list<dynamic_array<int16>,
+                         dynamic_array<int32>,
+                         dynamic_array<uint64>,
+                         dynamic_array<float32>,
+                         dynamic_array<float64>,
+                         dynamic_array<float128>,
+                         dynamic_array<complex32>,
+                         dynamic_array<complex64>
+                        > evaluator_array_types;
+
+//
+// the shape is chosen such that there is a remainder for every packet size
+// and the arrays span several L1 blocks
+//
+template<typename AT> struct evaluator_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef typename type_info<value_type>::base_type base_type;
+    typedef random_generator<value_type> generator_type;
+
+    shape_t shape;
+    generator_type generator;
+    AT a,b,c,d,r;
+
+    evaluator_fixture():
+        shape(shape_t{3,47,93}),
+        generator(base_type(1),base_type(10)),
+        a(AT::create(shape)),
+        b(AT::create(shape)),
+        c(AT::create(shape)),
+        d(AT::create(shape)),
+        r(AT::create(shape))
+    {
+        std::generate(a.begin(),a.end(),generator);
+        std::generate(b.begin(),b.end(),generator);
+        std::generate(c.begin(),c.end(),generator);
+        std::generate(d.begin(),d.end(),generator);
+    }
+};
+
+//
+// complex multiplication and division are not evaluated exactly like
+// std::complex does. Thus we have to allow for rounding differences.
+//
+template<typename T> void check_result(const T &a,const T &b)
+{
+    BOOST_CHECK_EQUAL(a,b);
+}
+
+template<typename T>
+void check_result(const std::complex<T> &a,const std::complex<T> &b)
+{
+    T tol = T(16)*std::numeric_limits<T>::epsilon()*std::abs(b);
+    BOOST_CHECK_SMALL(std::abs(a-b),tol);
+}
+
+BOOST_AUTO_TEST_SUITE(expression_evaluator_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_add_sub_mult,AT,evaluator_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        evaluator_fixture<AT> f;
+        value_type s(3);
+
+        f.r = f.a*f.b + f.c - s;
+        for(size_t i=0;i<f.r.size();++i)
+            check_result(f.r[i],
+                value_type(value_type(value_type(f.a[i]*f.b[i])+f.c[i])-s));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_div,AT,evaluator_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        evaluator_fixture<AT> f;
+
+        f.r = f.a*f.b + f.c/f.d;
+        for(size_t i=0;i<f.r.size();++i)
+            check_result(f.r[i],
+                value_type(value_type(f.a[i]*f.b[i])+
+                           value_type(f.c[i]/f.d[i])));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_construction,AT,evaluator_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        evaluator_fixture<AT> f;
+
+        AT r(f.a - f.b*f.c);
+        BOOST_CHECK_EQUAL(r.size(),f.a.size());
+        for(size_t i=0;i<r.size();++i)
+            check_result(r[i],value_type(f.a[i]-value_type(f.b[i]*f.c[i])));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_integer_scalar)
+    {
+        evaluator_fixture<dynamic_array<float64>> f;
+
+        //integer scalars are converted to the element type
+        f.r = f.a*2 - f.b/4;
+        for(size_t i=0;i<f.r.size();++i)
+            BOOST_CHECK_EQUAL(f.r[i],f.a[i]*2.-f.b[i]/4.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_mixed_types)
+    {
+        evaluator_fixture<dynamic_array<float32>> f;
+
+        //a float64 scalar must not be converted to float32 before the 
+        //operation - the expression is evaluated element by element
+        f.r = f.a*0.1;
+        for(size_t i=0;i<f.r.size();++i)
+            BOOST_CHECK_EQUAL(f.r[i],float32(f.a[i]*0.1));
+
+        auto i32 = dynamic_array<int32>::create(f.shape);
+        std::fill(i32.begin(),i32.end(),7);
+        f.r = f.a + i32;
+        for(size_t i=0;i<f.r.size();++i)
+            BOOST_CHECK_EQUAL(f.r[i],f.a[i]+7);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        evaluator_fixture<dynamic_array<float64>> f;
+        auto r = dynamic_array<float64>::create(shape_t{47,93});
+
+        //contiguous view leaves
+        auto va = f.a(1,slice(0,47),slice(0,93));
+        auto vb = f.b(2,slice(0,47),slice(0,93));
+        r = va*vb + 1.;
+        for(size_t i=0;i<r.size();++i)
+            BOOST_CHECK_EQUAL(r[i],va[i]*vb[i]+1.);
+
+        //strided view leaves fall back to element wise evaluation
+        auto sa = f.a(slice(0,3),10,slice(0,93,2));
+        auto sb = f.b(slice(0,3),11,slice(0,93,2));
+        auto rs = dynamic_array<float64>::create(sa.shape<shape_t>());
+        rs = sa - sb;
+        for(size_t i=0;i<rs.size();++i)
+            BOOST_CHECK_EQUAL(rs[i],sa[i]-sb[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_aliasing)
+    {
+        evaluator_fixture<dynamic_array<float32>> f;
+        auto orig = dynamic_array<float32>::create(f.shape);
+        std::copy(f.a.begin(),f.a.end(),orig.begin());
+
+        //the destination is also a leaf of the expression
+        f.a = f.a*f.b + f.a;
+        for(size_t i=0;i<f.a.size();++i)
+            BOOST_CHECK_EQUAL(f.a[i],orig[i]*f.b[i]+orig[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_partial)
+    {
+        evaluator_fixture<dynamic_array<float64>> f;
+        std::fill(f.r.begin(),f.r.end(),-1.);
+
+        auto expr = f.a + f.b;
+        BOOST_CHECK(packet_evaluate(f.r,expr,100,1000) ==
+                    simd_packet<float64>::is_vectorized);
+        evaluate_expression(f.r,expr,100,1000);
+        for(size_t i=0;i<f.r.size();++i)
+        {
+            if(i>=100 && i<1000)
+                BOOST_CHECK_EQUAL(f.r[i],f.a[i]+f.b[i]);
+            else
+                BOOST_CHECK_EQUAL(f.r[i],-1.);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,212 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+#include "../data_generator.hpp"
+
+using namespace pni::core;
+
+template<typename T>
+using parallel_array = mdarray<std::vector<T>,dynamic_cindex_map,
+                               parallel_inplace_arithmetics>;
+
+typedef boost::mpl::list<parallel_array<int8>,
+                         parallel_array<int32>,
+                         parallel_array<uint16>,
+                         parallel_array<uint64>,
+                         parallel_array<float32>,
+                         parallel_array<float64>,
+                         parallel_array<complex64>
+                        > parallel_array_types;
+
+//
+// force parallel execution with 4 threads for even the smallest arrays
+//
+template<typename AT> struct parallel_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef typename type_info<value_type>::base_type base_type;
+    typedef random_generator<value_type> generator_type;
+
+    size_t nthreads;
+    size_t threshold;
+    shape_t shape;
+    generator_type generator;
+    AT lhs;
+    AT lhs_orig;
+    AT rhs;
+    value_type rhs_scalar;
+
+    parallel_fixture():
+        nthreads(default_thread_pool().size()),
+        threshold(parallel_threshold()),
+        shape(shape_t{7,19,33}),
+        generator(base_type(1),base_type(10)),
+        lhs(AT::create(shape)),
+        lhs_orig(AT::create(shape)),
+        rhs(AT::create(shape)),
+        rhs_scalar(generator())
+    {
+        default_thread_pool().resize(4);
+        set_parallel_threshold(1);
+
+        std::generate(lhs.begin(),lhs.end(),generator);
+        std::generate(rhs.begin(),rhs.end(),generator);
+        std::copy(lhs.begin(),lhs.end(),lhs_orig.begin());
+    }
+
+    ~parallel_fixture()
+    {
+        default_thread_pool().resize(nthreads);
+        set_parallel_threshold(threshold);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(parallel_inplace_arithmetics_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_add,AT,parallel_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f;
+
+        f.lhs += f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]+f.rhs[i]));
+
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        f.lhs += f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]+f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_sub,AT,parallel_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f;
+
+        f.lhs -= f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]-f.rhs[i]));
+
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        f.lhs -= f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]-f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_mult,AT,parallel_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f;
+
+        f.lhs *= f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]*f.rhs[i]));
+
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        f.lhs *= f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]*f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_div,AT,parallel_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f;
+
+        f.lhs /= f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]/f.rhs[i]));
+
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        f.lhs /= f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            BOOST_CHECK_EQUAL(f.lhs[i],value_type(f.lhs_orig[i]/f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_strided_view)
+    {
+        parallel_fixture<parallel_array<float64>> f;
+
+        auto view = f.lhs(slice(0,7),slice(2,19),slice(1,33,2));
+        BOOST_CHECK(!view.is_contiguous());
+        view *= 2.0;
+
+        for(size_t i=0;i<7;++i)
+            for(size_t j=0;j<19;++j)
+                for(size_t k=0;k<33;++k)
+                {
+                    float64 orig = f.lhs_orig(i,j,k);
+                    bool selected = j>=2 && k%2;
+                    BOOST_CHECK_EQUAL(f.lhs(i,j,k),selected ? 2.0*orig : orig);
+                }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_chunk_boundaries)
+    {
+        parallel_fixture<parallel_array<float64>> f;
+
+        //contiguous arrays are split on cache line boundaries
+        auto bounds = chunk_boundaries(f.lhs,4);
+        BOOST_CHECK_EQUAL(bounds.size(),5);
+        BOOST_CHECK_EQUAL(bounds.front(),0);
+        BOOST_CHECK_EQUAL(bounds.back(),f.lhs.size());
+        for(size_t c=1;c<4;++c)
+        {
+            BOOST_CHECK(bounds[c-1]<=bounds[c]);
+            auto address = reinterpret_cast<std::uintptr_t>(&f.lhs[bounds[c]]);
+            BOOST_CHECK_EQUAL(address%cache_line_size,0);
+        }
+
+        //views are split between rows
+        auto view = f.lhs(slice(0,7),slice(0,19),slice(0,30));
+        bounds = chunk_boundaries(view,4);
+        BOOST_CHECK_EQUAL(bounds.back(),view.size());
+        for(size_t c=1;c<4;++c)
+        {
+            BOOST_CHECK_EQUAL(bounds[c]%30,0);
+            auto last = reinterpret_cast<std::uintptr_t>(&view[bounds[c]-1]);
+            auto first = reinterpret_cast<std::uintptr_t>(&view[bounds[c]]);
+            BOOST_CHECK(last/cache_line_size != first/cache_line_size);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,229 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include <cmath>
+#include "../data_generator.hpp"
+
+using namespace pni::core;
+
+template<typename T>
+using simd_array = mdarray<std::vector<T>,dynamic_cindex_map,
+                           simd_inplace_arithmetics>;
+
+typedef boost::mpl::list<simd_array<int8>,
+                         simd_array<int16>,
+                         simd_array<int32>,
+                         simd_array<int64>,
+                         simd_array<uint8>,
+                         simd_array<uint16>,
+                         simd_array<uint32>,
+                         simd_array<uint64>,
+                         simd_array<float32>,
+                         simd_array<float64>,
+                         simd_array<float128>,
+                         simd_array<complex32>,
+                         simd_array<complex64>,
+                         simd_array<complex128>
+                        > simd_array_types;
+
+//
+// the shape is chosen such that there is a remainder for every packet size
+//
+template<typename AT> struct simd_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef typename type_info<value_type>::base_type base_type;
+    typedef random_generator<value_type> generator_type;
+
+    shape_t shape;
+    generator_type generator;
+    AT lhs;
+    AT lhs_orig;
+    AT rhs;
+    value_type rhs_scalar;
+
+    simd_fixture():
+        shape(shape_t{5,17,31}),
+        generator(base_type(1),base_type(10)),
+        lhs(AT::create(shape)),
+        lhs_orig(AT::create(shape)),
+        rhs(AT::create(shape)),
+        rhs_scalar(generator())
+    {
+        std::generate(lhs.begin(),lhs.end(),generator);
+        std::generate(rhs.begin(),rhs.end(),generator);
+        std::copy(lhs.begin(),lhs.end(),lhs_orig.begin());
+    }
+};
+
+//
+// complex multiplication and division are not evaluated exactly like
+// std::complex does. Thus we have to allow for rounding differences.
+//
+template<typename T> void check_result(const T &a,const T &b)
+{
+    BOOST_CHECK_EQUAL(a,b);
+}
+
+template<typename T>
+void check_result(const std::complex<T> &a,const std::complex<T> &b)
+{
+    T tol = T(8)*std::numeric_limits<T>::epsilon()*std::abs(b);
+    BOOST_CHECK_SMALL(std::abs(a-b),tol);
+}
+
+BOOST_AUTO_TEST_SUITE(simd_inplace_arithmetics_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_add,AT,simd_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        simd_fixture<AT> f;
+
+        f.lhs += f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],value_type(f.lhs_orig[i]+f.rhs[i]));
+
+        f.lhs += f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],
+                         value_type(value_type(f.lhs_orig[i]+f.rhs[i])+
+                                    f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_sub,AT,simd_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        simd_fixture<AT> f;
+
+        f.lhs -= f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],value_type(f.lhs_orig[i]-f.rhs[i]));
+
+        f.lhs -= f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],
+                         value_type(value_type(f.lhs_orig[i]-f.rhs[i])-
+                                    f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_mult,AT,simd_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        simd_fixture<AT> f;
+
+        f.lhs *= f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],value_type(f.lhs_orig[i]*f.rhs[i]));
+
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        f.lhs *= f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],value_type(f.lhs_orig[i]*f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_div,AT,simd_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        simd_fixture<AT> f;
+
+        f.lhs /= f.rhs;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],value_type(f.lhs_orig[i]/f.rhs[i]));
+
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        f.lhs /= f.rhs_scalar;
+        for(size_t i=0;i<f.lhs.size();++i)
+            check_result(f.lhs[i],value_type(f.lhs_orig[i]/f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_contiguous_view)
+    {
+        simd_fixture<simd_array<float32>> f;
+
+        auto view = f.lhs(1,slice(0,17),slice(0,31));
+        BOOST_CHECK(view.is_contiguous());
+        view += f.rhs(2,slice(0,17),slice(0,31));
+
+        for(size_t i=0;i<f.lhs.size();++i)
+        {
+            if(i>=527 && i<1054)
+                BOOST_CHECK_EQUAL(f.lhs[i],f.lhs_orig[i]+f.rhs[i+527]);
+            else
+                BOOST_CHECK_EQUAL(f.lhs[i],f.lhs_orig[i]);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_strided_view)
+    {
+        simd_fixture<simd_array<float64>> f;
+
+        //non-contiguous views must fall back to the default implementation
+        auto view = f.lhs(slice(0,5),3,slice(0,31,2));
+        BOOST_CHECK(!view.is_contiguous());
+        view *= 2.0;
+
+        for(size_t i=0;i<5;++i)
+            for(size_t j=0;j<31;++j)
+            {
+                float64 orig = f.lhs_orig(i,3,j);
+                BOOST_CHECK_EQUAL(f.lhs(i,3,j),j%2 ? orig : 2.0*orig);
+            }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_overlapping)
+    {
+        simd_fixture<simd_array<int32>> f;
+
+        //overlapping operands must be evaluated element by element
+        auto a = f.lhs(0,0,slice(1,31));
+        auto b = f.lhs(0,0,slice(0,30));
+        a += b;
+
+        int32 sum = f.lhs_orig[0];
+        for(size_t i=1;i<31;++i)
+        {
+            sum += f.lhs_orig[i];
+            BOOST_CHECK_EQUAL(f.lhs[i],sum);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
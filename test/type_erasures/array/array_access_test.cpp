@@ -29,6 +29,7 @@
 #ifdef __GNUG__
 #pragma GCC diagnostic pop
 #endif
+#include <vector>
 #include <pni/core/type_erasures.hpp>
 
 #include "array_types.hpp"
@@ -158,5 +159,81 @@ BOOST_AUTO_TEST_SUITE(array_access_test)
             }
         }
     }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_block_read,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+
+        array a(f.mdarray_1);
+        std::vector<value_type> buffer(a.size());
+        a.read(0,buffer.size(),buffer.data());
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(buffer[i],f.mdarray_1[i]);
+
+        //read only a part of the array
+        std::vector<value_type> part(3);
+        a.read(2,part.size(),type_id_map<value_type>::type_id,part.data());
+        for(size_t i=0;i<part.size();++i)
+            BOOST_CHECK_EQUAL(part[i],f.mdarray_1[i+2]);
+
+        BOOST_CHECK_THROW(a.read(4,3,buffer.data()),index_error);
+        BOOST_CHECK_THROW(a.read(7,0,buffer.data()),index_error);
+        BOOST_CHECK_NO_THROW(a.read(6,0,buffer.data()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_block_write,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+
+        array a(f.mdarray_1);
+        std::vector<value_type> buffer(f.mdarray_2.begin(),
+                                       f.mdarray_2.end());
+        a.write(1,4,buffer.data()+1);
+        for(size_t i=0;i<a.size();++i)
+        {
+            const value_type &expected = (i<1||i>4) ? f.mdarray_1[i] 
+                                                    : f.mdarray_2[i];
+            BOOST_CHECK_EQUAL(a[i].as<value_type>(),expected);
+        }
+
+        BOOST_CHECK_THROW(a.write(0,7,buffer.data()),index_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_block_conversion)
+    {
+        auto data = dynamic_array<int32>::create(shape_t{2,3});
+        for(size_t i=0;i<data.size();++i) data[i] = int32(i)-2;
+        array a(data);
+
+        std::vector<float64> f64(a.size());
+        a.read(0,f64.size(),f64.data());
+        for(size_t i=0;i<f64.size();++i) 
+            BOOST_CHECK_EQUAL(f64[i],float64(i)-2.);
+
+        //negative values do not fit into an unsigned type
+        std::vector<uint16> u16(a.size());
+        BOOST_CHECK_THROW(a.read(0,u16.size(),u16.data()),range_error);
+        a.read(2,4,u16.data());
+        BOOST_CHECK_EQUAL(u16[3],3);
+
+        std::vector<uint8> u8{10,20,30};
+        a.write(3,u8.size(),u8.data());
+        BOOST_CHECK_EQUAL(a[4].as<int32>(),20);
+
+        //floating point data cannot be stored in an integer array
+        BOOST_CHECK_THROW(a.write(0,f64.size(),f64.data()),type_error);
+        std::vector<string> str(a.size());
+        BOOST_CHECK_THROW(a.read(0,str.size(),str.data()),type_error);
+        BOOST_CHECK_THROW(a.read(0,1,type_id_t::NONE,str.data()),type_error);
+
+        array empty;
+        BOOST_CHECK_THROW(empty.read(0,0,f64.data()),
+                          memory_not_allocated_error);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -29,6 +29,8 @@
 #ifdef __GNUG__
 #pragma GCC diagnostic pop
 #endif
+#include <iterator>
+#include <vector>
 #include <pni/core/type_erasures.hpp>
 
 #include "array_types.hpp"
@@ -100,4 +102,112 @@ BOOST_AUTO_TEST_SUITE(array_iterator_test)
             BOOST_CHECK_EQUAL(v.as<value_type>(),f.mdarray_1[index++]); 
     }
 
+    //=========================================================================
+    BOOST_AUTO_TEST_CASE(test_block_boundaries)
+    {
+        //the iterators read the array in blocks - use a size which is not
+        //a multiple of the block size
+        auto data = dynamic_array<uint32>::create(shape_t{1000});
+        for(size_t i=0;i<data.size();++i) data[i] = i;
+        array a(data);
+        const array &r = a;
+
+        uint32 index = 0;
+        for(auto iter = r.begin();iter!=r.end();++iter,++index)
+            BOOST_CHECK_EQUAL((*iter).as<uint32>(),index);
+        BOOST_CHECK_EQUAL(index,1000);
+
+        //move backwards through the array 
+        auto iter = a.end();
+        while(iter!=a.begin())
+        {
+            --iter;
+            --index;
+            BOOST_CHECK_EQUAL((*iter).as<uint32>(),index);
+            *iter = 2*index;
+        }
+
+        //random access across blocks
+        auto citer = r.begin()+999;
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),1998);
+        citer -= 870;
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),258);
+        citer += 1;
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),260);
+    }
+
+    //=========================================================================
+    BOOST_AUTO_TEST_CASE(test_reverse_iteration)
+    {
+        typedef std::reverse_iterator<array::iterator> reverse_iterator;
+        typedef std::reverse_iterator<array::const_iterator> 
+            const_reverse_iterator;
+
+        auto data = dynamic_array<uint32>::create(shape_t{1000});
+        for(size_t i=0;i<data.size();++i) data[i] = i;
+        array a(data);
+        const array &r = a;
+
+        //reverse iterators dereference a temporary copy of the iterator
+        uint32 index = 1000;
+        for(auto iter = const_reverse_iterator(r.end());
+            iter!=const_reverse_iterator(r.begin());++iter)
+            BOOST_CHECK_EQUAL((*iter).as<uint32>(),--index);
+        BOOST_CHECK_EQUAL(index,0);
+
+        for(auto iter = reverse_iterator(a.end());
+            iter!=reverse_iterator(a.begin());++iter,++index)
+            *iter = index;
+        for(auto iter = r.begin();iter!=r.end();++iter)
+            BOOST_CHECK_EQUAL((*iter).as<uint32>(),--index);
+
+        //the same holds for *iter++ and *(iter+n)
+        auto iter = r.begin();
+        for(index=999;iter!=r.end();--index)
+            BOOST_CHECK_EQUAL((*iter++).as<uint32>(),index);
+
+        auto citer = r.begin();
+        for(index=0;index<1000;index+=7)
+            BOOST_CHECK_EQUAL((*(citer+index)).as<uint32>(),999-index);
+    }
+
+    //=========================================================================
+    BOOST_AUTO_TEST_CASE(test_live_reads)
+    {
+        //iterators must see changes made after they were dereferenced
+        auto data = dynamic_array<uint32>::create(shape_t{300});
+        for(size_t i=0;i<data.size();++i) data[i] = i;
+        array a(data);
+        const array &r = a;
+
+        auto citer = r.begin()+5;
+        auto iter = a.begin()+5;
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),5);
+        BOOST_CHECK_EQUAL((*iter).as<uint32>(),5);
+
+        //write through the array
+        a[5] = uint32(100);
+        a[6] = uint32(101);
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),100);
+        BOOST_CHECK_EQUAL((*iter).as<uint32>(),100);
+        BOOST_CHECK_EQUAL((*(citer+1)).as<uint32>(),101);
+        BOOST_CHECK_EQUAL((*(iter+1)).as<uint32>(),101);
+
+        //write through another iterator 
+        *(a.begin()+7) = uint32(200);
+        BOOST_CHECK_EQUAL((*(citer+2)).as<uint32>(),200);
+        BOOST_CHECK_EQUAL((*(iter+2)).as<uint32>(),200);
+
+        //write a block 
+        std::vector<uint32> block(10,300);
+        a.write(0,block.size(),block.data());
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),300);
+        BOOST_CHECK_EQUAL((*iter).as<uint32>(),300);
+
+        //write through the iterator itself
+        *iter = uint32(400);
+        BOOST_CHECK_EQUAL((*citer).as<uint32>(),400);
+        BOOST_CHECK_EQUAL((*iter).as<uint32>(),400);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
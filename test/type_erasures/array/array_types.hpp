@@ -39,6 +39,8 @@ typedef boost::mpl::list<pni::core::dynamic_array<pni::core::uint8>,
                          pni::core::dynamic_array<pni::core::int32>,
                          pni::core::dynamic_array<pni::core::uint64>,
                          pni::core::dynamic_array<pni::core::int64>,
+                         pni::core::dynamic_array<pni::core::float16>,
+                         pni::core::dynamic_array<pni::core::bfloat16>,
                          pni::core::dynamic_array<pni::core::float32>,
                          pni::core::dynamic_array<pni::core::float64>,
                          pni::core::dynamic_array<pni::core::float128>,
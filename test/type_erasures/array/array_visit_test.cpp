@@ -0,0 +1,160 @@
+//!
+//! (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//!
+//! This file is part of libpnicore.
+//!
+//! libpnicore is free software: you can redistribute it and/or modify
+//! it under the terms of the GNU General Public License as published by
+//! the Free Software Foundation, either version 2 of the License, or
+//! (at your option) any later version.
+//!
+//! libpnicore is distributed in the hope that it will be useful,
+//! but WITHOUT ANY WARRANTY; without even the implied warranty of
+//! MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//! GNU General Public License for more details.
+//!
+//! You should have received a copy of the GNU General Public License
+//! along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//!
+//! ============================================================================
+//!
+//! Created on: Oct 18, 2026
+//!     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//!
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <vector>
+#include <algorithm>
+#include <pni/core/type_erasures.hpp>
+
+#include "array_types.hpp"
+#include "fixture.hpp"
+
+using namespace pni::core;
+
+//visitor copying the elements of an array to a vector of values
+struct copy_visitor
+{
+    template<typename ATYPE> 
+    std::vector<value> operator()(const ATYPE &a) const
+    {
+        std::vector<value> result;
+        for(auto x: a) result.push_back(value(x));
+        return result;
+    }
+};
+
+//visitor setting all elements to the value of the first one
+struct fill_visitor
+{
+    template<typename ATYPE> void operator()(ATYPE &a) const
+    {
+        std::fill(a.begin(),a.end(),a[0]);
+    }
+};
+
+//visitor returning the shape of an array
+struct shape_visitor
+{
+    template<typename ATYPE> shape_t operator()(const ATYPE &a) const
+    {
+        return a.template shape<shape_t>();
+    }
+};
+
+//visitor summing up the elements of an integer array
+struct sum_visitor
+{
+    template<typename ATYPE> int64 operator()(const ATYPE &a) const
+    {
+        int64 s = 0;
+        for(auto x: a) s += x;
+        return s;
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(array_visit_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_visit_read,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+
+        array a(f.mdarray_1);
+        const array &aref = a;
+
+        std::vector<value> data = visit<primitive_types>(aref,copy_visitor());
+        BOOST_CHECK_EQUAL(data.size(),a.size());
+        for(size_t i=0;i<data.size();++i)
+            BOOST_CHECK_EQUAL(data[i].as<value_type>(),f.mdarray_1[i]);
+
+        shape_t s = visit<primitive_types>(a,shape_visitor());
+        BOOST_CHECK_EQUAL_COLLECTIONS(s.begin(),s.end(),
+                                      f.shape.begin(),f.shape.end());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_visit_write,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+
+        array a(f.mdarray_1);
+        visit<primitive_types>(a,fill_visitor());
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i].as<value_type>(),f.mdarray_1[0]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit_types)
+    {
+        auto data = dynamic_array<int16>::create(shape_t{3,4});
+        for(size_t i=0;i<data.size();++i) data[i] = int16(i);
+        array a(data);
+
+        BOOST_CHECK_EQUAL(visit<integer_types>(a,sum_visitor()),66);
+
+        //types which are not in the type list
+        array s(dynamic_array<string>::create(shape_t{3}));
+        BOOST_CHECK_THROW(visit(s,shape_visitor()),type_error);
+        BOOST_CHECK_THROW(visit<float_types>(a,shape_visitor()),type_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit_layouts)
+    {
+        typedef mdarray<std::vector<int16>,dynamic_findex_map> farray_type;
+        typedef tiled_array<int16,2> tarray_type;
+
+        //the visitor would see the elements at the wrong positions
+        auto fdata = farray_type::create(shape_t{3,4});
+        fdata(0,1) = 1;
+        array f(fdata);
+        const array &fref = f;
+        BOOST_CHECK_THROW(visit<integer_types>(f,sum_visitor()),type_error);
+        BOOST_CHECK_THROW(visit<integer_types>(fref,sum_visitor()),
+                          type_error);
+
+        auto tdata = tarray_type::create(shape_t{3,4});
+        tdata(0,2) = 2;
+        array t(tdata);
+        BOOST_CHECK_THROW(visit<integer_types>(t,sum_visitor()),type_error);
+
+        //views are visited if they are contiguous
+        auto cdata = dynamic_array<int16>::create(shape_t{3,4});
+        for(size_t i=0;i<cdata.size();++i) cdata[i] = int16(i);
+        array row(cdata(1,slice(0,4)));
+        BOOST_CHECK_EQUAL(visit<integer_types>(row,sum_visitor()),22);
+        array column(cdata(slice(0,3),1));
+        BOOST_CHECK_THROW(visit<integer_types>(column,sum_visitor()),
+                          type_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
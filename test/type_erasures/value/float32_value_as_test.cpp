@@ -121,6 +121,18 @@ BOOST_AUTO_TEST_SUITE(float32_value_as_test)
         BOOST_CHECK_THROW(v.as<target_type>(),type_error);
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_as_float16)
+    {
+        typedef float16 target_type;
+        fixture_type f=create_fixture();
+        value v(f.value_1);
+        BOOST_CHECK_THROW(v.as<target_type>(),range_error);
+
+        v = value_type(1000.5);
+        BOOST_CHECK_EQUAL(v.as<target_type>(),1000.5f);
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_as_float32)
     {
@@ -34,6 +34,8 @@ typedef boost::mpl::list<
                          pni::core::int32,
                          pni::core::uint64,
                          pni::core::int64,
+                         pni::core::float16,
+                         pni::core::bfloat16,
                          pni::core::float32,
                          pni::core::float64,
                          pni::core::float128,
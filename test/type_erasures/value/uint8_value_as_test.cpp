@@ -123,6 +123,15 @@ BOOST_AUTO_TEST_SUITE(uint8_value_as_test)
                          convert<target_type>(f.value_1));
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_convert_to_float16)
+    {
+        fixture_type f(0,200);
+        value v(f.value_1);
+        BOOST_CHECK_EQUAL(v.as<float16>(),float32(f.value_1));
+        BOOST_CHECK_EQUAL(v.as<bfloat16>(),float32(f.value_1));
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_convert_to_float32)
     {
@@ -31,6 +31,7 @@
 #pragma GCC diagnostic pop
 #endif 
 #include <boost/test/floating_point_comparison.hpp>
+#include <vector>
 #include <pni/core/type_erasures.hpp>
 
 #include "types.hpp"
@@ -58,7 +59,7 @@ BOOST_AUTO_TEST_SUITE(value_assignment_test)
         value v2 = make_value<uint8>();
         
         v2 = std::move(v1);
-        //v1 is invalid here
+        BOOST_CHECK_EQUAL(v1.type_id(),type_id_t::NONE);
         BOOST_CHECK(v2.type_id()==type_id_map<T>::type_id);
         BOOST_CHECK_EQUAL(f.value_1,v2.as<T>());
     }
@@ -74,6 +75,49 @@ BOOST_AUTO_TEST_SUITE(value_assignment_test)
         BOOST_CHECK_EQUAL(f.value_1,v1.as<T>());
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_replace_holder,T,all_types)
+    {
+        //numeric types are stored inline, strings on the heap
+        fixture<T> f;
+        value v1(f.value_1);
+        value v2(string("a string which does not fit into the buffer"));
+
+        std::swap(v1,v2);
+        BOOST_CHECK(v2.type_id()==type_id_map<T>::type_id);
+        BOOST_CHECK_EQUAL(v2.as<T>(),f.value_1);
+        BOOST_CHECK_EQUAL(v1.as<string>(),
+                          "a string which does not fit into the buffer");
+
+        v1 = v2;
+        BOOST_CHECK(v1.type_id()==type_id_map<T>::type_id);
+        BOOST_CHECK_EQUAL(v1.as<T>(),f.value_1);
+
+        v2 = value(string("text"));
+        BOOST_CHECK_EQUAL(v2.as<string>(),"text");
+        BOOST_CHECK_EQUAL(v1.as<T>(),f.value_1);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_record,T,all_types)
+    {
+        fixture<T> f;
+        std::vector<value> record;
+
+        //the vector moves its elements when it grows
+        for(size_t i=0;i<100;++i)
+        {
+            record.push_back(value(f.value_1));
+            record.push_back(value(string("field")));
+        }
+
+        for(size_t i=0;i<record.size();i+=2)
+        {
+            BOOST_CHECK_EQUAL(record[i].as<T>(),f.value_1);
+            BOOST_CHECK_EQUAL(record[i+1].as<string>(),"field");
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
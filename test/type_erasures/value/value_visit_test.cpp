@@ -0,0 +1,86 @@
+//!
+//! (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//!
+//! This file is part of libpnicore.
+//!
+//! libpnicore is free software: you can redistribute it and/or modify
+//! it under the terms of the GNU General Public License as published by
+//! the Free Software Foundation, either version 2 of the License, or
+//! (at your option) any later version.
+//!
+//! libpnicore is distributed in the hope that it will be useful,
+//! but WITHOUT ANY WARRANTY; without even the implied warranty of
+//! MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//! GNU General Public License for more details.
+//!
+//! You should have received a copy of the GNU General Public License
+//! along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//!
+//! ============================================================================
+//!
+//! Created on: Oct 18, 2026
+//!     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//!
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif 
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif 
+#include <pni/core/type_erasures.hpp>
+
+#include "types.hpp"
+#include "fixture.hpp"
+
+//visitor returning a copy of the data 
+struct copy_visitor
+{
+    template<typename T> value operator()(const T &x) const
+    {
+        return value(x);
+    }
+};
+
+//visitor returning the type ID of the data
+struct type_id_visitor
+{
+    template<typename T> type_id_t operator()(const T &) const
+    {
+        return type_id_map<T>::type_id;
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(value_visit_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_visit,T,all_types)
+    {
+        fixture<T> f;
+        value v(f.value_1);
+        type_id_t tid = type_id_map<T>::type_id;
+
+        value c = visit<primitive_types>(v,copy_visitor());
+        BOOST_CHECK_EQUAL(c.as<T>(),f.value_1);
+        BOOST_CHECK_EQUAL(visit<primitive_types>(v,type_id_visitor()),tid);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit_types)
+    {
+        BOOST_CHECK_EQUAL(visit(value(float32(1.2)),type_id_visitor()),
+                          type_id_t::FLOAT32);
+        BOOST_CHECK_EQUAL(visit<non_numeric_types>(value(string("hello")),
+                                                   type_id_visitor()),
+                          type_id_t::STRING);
+
+        //types which are not in the type list
+        BOOST_CHECK_THROW(visit(value(string("hello")),type_id_visitor()),
+                          type_error);
+        BOOST_CHECK_THROW(visit<non_numeric_types>(value(uint8(1)),
+                                                   type_id_visitor()),
+                          type_error);
+        BOOST_CHECK_THROW(visit(value(),type_id_visitor()),type_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
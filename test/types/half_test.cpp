@@ -0,0 +1,285 @@
+//
+// (c) Copyright 2014 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif 
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif 
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/simd_convert.hpp>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<float16,bfloat16> half_types;
+
+//
+// a value must not be closer to one of the neighbours of its 16Bit 
+// representation than to the representation itself
+//
+template<typename T> void check_nearest(float32 x)
+{
+    T h(x);
+    float32 d = std::fabs(float32(h)-x);
+    uint16 b = h.bits();
+    if((b&0x7fff)==0) return;
+
+    float32 below = T::from_bits(uint16(b-1));
+    BOOST_CHECK(std::fabs(below-x)>=d);
+    if((b&0x7fff)<std::numeric_limits<T>::max().bits())
+    {
+        float32 above = T::from_bits(uint16(b+1));
+        BOOST_CHECK(std::fabs(above-x)>=d);
+    }
+}
+
+//
+// data for the bulk conversion including special values and a length
+// which is not a multiple of the SIMD width
+//
+std::vector<float32> conversion_data()
+{
+    std::vector<float32> data;
+    for(size_t i=0;i<1000;++i) data.push_back(float32(i)*1.37f-500.f);
+    data.push_back(std::numeric_limits<float32>::infinity());
+    data.push_back(-std::numeric_limits<float32>::infinity());
+    data.push_back(std::numeric_limits<float32>::max());
+    data.push_back(1.e-7f);
+    data.push_back(-3.e-41f);
+    data.push_back(std::numeric_limits<float32>::quiet_NaN());
+    data.push_back(2049.f);
+    return data;
+}
+
+BOOST_AUTO_TEST_SUITE(half_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_construction,T,half_types)
+    {
+        BOOST_CHECK_EQUAL(sizeof(T),2u);
+        BOOST_CHECK_EQUAL(float32(T()),0.f);
+
+        T h = 1.5f;
+        BOOST_CHECK_EQUAL(float32(h),1.5f);
+        h = -256;
+        BOOST_CHECK_EQUAL(float32(h),-256.f);
+        BOOST_CHECK_EQUAL(T::from_bits(h.bits()),h);
+
+        //all integers with 8 significant bits are exact
+        for(int32 i=-256;i<=256;++i) BOOST_CHECK_EQUAL(float32(T(i)),i);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_float16_rounding)
+    {
+        BOOST_CHECK_EQUAL(float32(float16(2049.f)),2048.f);
+        BOOST_CHECK_EQUAL(float32(float16(2051.f)),2052.f);
+        BOOST_CHECK_EQUAL(float32(float16(65519.f)),65504.f);
+        BOOST_CHECK(std::isinf(float32(float16(65520.f))));
+        BOOST_CHECK(std::isinf(float32(float16(-1.e6f))));
+
+        //subnormal numbers
+        BOOST_CHECK_EQUAL(float16(std::ldexp(1.f,-24)).bits(),1);
+        BOOST_CHECK_EQUAL(float16(std::ldexp(1.f,-25)).bits(),0);
+        BOOST_CHECK_EQUAL(float16(std::ldexp(3.f,-25)).bits(),2);
+        BOOST_CHECK_EQUAL(float16(-std::ldexp(1.f,-14)).bits(),0x8400);
+
+        for(float32 x=-65000.f;x<65000.f;x+=0.731f) check_nearest<float16>(x);
+        for(float32 x=1.e-8f;x<1.e-3f;x*=1.0137f) check_nearest<float16>(x);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_bfloat16_rounding)
+    {
+        BOOST_CHECK_EQUAL(float32(bfloat16(257.f)),256.f);
+        BOOST_CHECK_EQUAL(float32(bfloat16(259.f)),260.f);
+        BOOST_CHECK(std::isinf(float32(
+                        bfloat16(std::numeric_limits<float32>::max()))));
+
+        for(float32 x=-1.e6f;x<1.e6f;x+=13.37f) check_nearest<bfloat16>(x);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_round_trip,T,half_types)
+    {
+        //every value except NaN survives the conversion to float32 
+        for(uint32 b=0;b<0x10000;++b)
+        {
+            T h = T::from_bits(uint16(b));
+            float32 f = h;
+            if(std::isnan(f)) 
+                BOOST_CHECK(std::isnan(float32(T(f))));
+            else
+                BOOST_CHECK_EQUAL(T(f).bits(),b);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_limits,T,half_types)
+    {
+        typedef std::numeric_limits<T> limits_type;
+
+        BOOST_CHECK(limits_type::is_specialized);
+        BOOST_CHECK(!limits_type::is_integer);
+        BOOST_CHECK(std::isinf(float32(limits_type::infinity())));
+        BOOST_CHECK(std::isnan(float32(limits_type::quiet_NaN())));
+        BOOST_CHECK_EQUAL(float32(limits_type::lowest()),
+                          -float32(limits_type::max()));
+        BOOST_CHECK_EQUAL(float32(T(1.f+float32(limits_type::epsilon()))),
+                          1.f+float32(limits_type::epsilon()));
+        BOOST_CHECK_EQUAL(float32(T(1.f+0.5f*limits_type::epsilon())),1.f);
+        BOOST_CHECK(float32(limits_type::denorm_min())>0.f);
+        BOOST_CHECK(float32(limits_type::denorm_min())<
+                    float32(limits_type::min()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_arithmetics,T,half_types)
+    {
+        T a = 1.5f;
+        T b = a*2;
+        BOOST_CHECK_EQUAL(b,3.f);
+        BOOST_CHECK(a<b);
+
+        b += a;
+        BOOST_CHECK_EQUAL(b,4.5f);
+        b -= 2;
+        BOOST_CHECK_EQUAL(b,2.5f);
+        b *= a;
+        BOOST_CHECK_EQUAL(b,3.75f);
+        b /= 3;
+        BOOST_CHECK_EQUAL(b,1.25f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_io,T,half_types)
+    {
+        std::stringstream ss;
+        ss<<T(-2.5f);
+        BOOST_CHECK_EQUAL(ss.str(),"-2.5");
+
+        T h;
+        ss>>h;
+        BOOST_CHECK_EQUAL(h,-2.5f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_convert)
+    {
+        BOOST_CHECK_EQUAL(convert<float16>(uint8(200)),200.f);
+        BOOST_CHECK_EQUAL(convert<float16>(int16(-1000)),-1000.f);
+        BOOST_CHECK_EQUAL(convert<float16>(uint16(60000)),60000.f);
+        BOOST_CHECK_THROW(convert<float16>(uint16(65535)),range_error);
+        BOOST_CHECK_THROW(convert<float16>(int32(-100000)),range_error);
+        BOOST_CHECK_THROW(convert<float16>(float64(1.e10)),range_error);
+        BOOST_CHECK(std::isinf(float32(convert<float16>(
+                        std::numeric_limits<float32>::infinity()))));
+
+        BOOST_CHECK_EQUAL(convert<bfloat16>(uint64(1)<<40),
+                          float32(uint64(1)<<40));
+        BOOST_CHECK_EQUAL(convert<bfloat16>(convert<float16>(0.25f)),0.25f);
+        BOOST_CHECK_THROW(convert<bfloat16>(float64(1.e39)),range_error);
+        BOOST_CHECK_THROW(convert<float16>(bfloat16(1.e10f)),range_error);
+
+        BOOST_CHECK_EQUAL(convert<float64>(float16(0.125f)),0.125);
+        BOOST_CHECK_EQUAL(convert<complex32>(bfloat16(-4.f)),
+                          complex32(-4.f,0.f));
+
+        BOOST_CHECK(is_unchecked_convertible(type_id_t::INT8,
+                                             type_id_t::FLOAT16));
+        BOOST_CHECK(is_checked_convertible(type_id_t::INT32,
+                                           type_id_t::FLOAT16));
+        BOOST_CHECK(is_unchecked_convertible(type_id_t::INT32,
+                                             type_id_t::BFLOAT16));
+        BOOST_CHECK(is_unchecked_convertible(type_id_t::FLOAT16,
+                                             type_id_t::FLOAT32));
+        BOOST_CHECK(is_checked_convertible(type_id_t::FLOAT32,
+                                           type_id_t::BFLOAT16));
+        BOOST_CHECK(!is_convertible(type_id_t::FLOAT16,type_id_t::INT32));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_simd_convert,T,half_types)
+    {
+        auto data = conversion_data();
+        size_t n = data.size();
+
+        std::vector<T> packed(n);
+        simd_convert(data.data(),n,packed.data());
+        for(size_t i=0;i<n;++i)
+        {
+            if(std::isnan(data[i])) 
+                BOOST_CHECK(std::isnan(float32(packed[i])));
+            else
+                BOOST_CHECK_EQUAL(packed[i].bits(),T(data[i]).bits());
+        }
+
+        std::vector<float32> unpacked(n);
+        simd_convert(packed.data(),n,unpacked.data());
+        for(size_t i=0;i<n;++i)
+        {
+            if(std::isnan(data[i])) 
+                BOOST_CHECK(std::isnan(unpacked[i]));
+            else
+                BOOST_CHECK_EQUAL(unpacked[i],float32(packed[i]));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_mdarray,T,half_types)
+    {
+        auto data = conversion_data();
+        data.resize(1000);
+        auto a = dynamic_array<float32>::create(shape_t{10,100});
+        std::copy(data.begin(),data.end(),a.begin());
+
+        //conversion of the entire array 
+        dynamic_array<T> h(a);
+        for(size_t i=0;i<a.size();++i) BOOST_CHECK_EQUAL(h[i],T(a[i]));
+
+        auto b = dynamic_array<float32>::create(shape_t{10,100});
+        b = h;
+        for(size_t i=0;i<b.size();++i) BOOST_CHECK_EQUAL(b[i],float32(h[i]));
+
+        //conversion of a view
+        dynamic_array<T> v(a(slice(2,6),slice(10,40)));
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<30;++j)
+                BOOST_CHECK_EQUAL(v(i,j),T(a(i+2,j+10)));
+
+        //arithmetics are computed in single precision
+        dynamic_array<T> s(h+h);
+        for(size_t i=0;i<s.size();++i) 
+            BOOST_CHECK_EQUAL(s[i],T(2.f*float32(h[i])));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
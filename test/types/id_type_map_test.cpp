@@ -92,6 +92,15 @@ BOOST_AUTO_TEST_SUITE(id_type_map_test)
         BOOST_CHECK((std::is_same<map_type::type,int64>::value));
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_id_type_map_float16)
+    {
+        typedef id_type_map<type_id_t::FLOAT16> map_type;
+        BOOST_CHECK((std::is_same<map_type::type,float16>::value));
+        typedef id_type_map<type_id_t::BFLOAT16> bmap_type;
+        BOOST_CHECK((std::is_same<bmap_type::type,bfloat16>::value));
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_id_type_map_float32)
     {
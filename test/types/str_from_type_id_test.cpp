@@ -83,6 +83,13 @@ BOOST_AUTO_TEST_SUITE(str_from_type_id_test)
         BOOST_CHECK_EQUAL(str_from_type_id(type_id_t::UINT64),"uint64");
     }
     
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_float16_str_from_type_id)
+    {
+        BOOST_CHECK_EQUAL(str_from_type_id(type_id_t::FLOAT16),"float16");
+        BOOST_CHECK_EQUAL(str_from_type_id(type_id_t::BFLOAT16),"bfloat16");
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_float32_str_from_type_id)
     {
@@ -36,7 +36,9 @@ static const id_vector_type integer_ids = { pni::core::type_id_t::UINT8,
                                             pni::core::type_id_t::UINT64,
                                             pni::core::type_id_t::INT64};
 
-static const id_vector_type float_ids = {pni::core::type_id_t::FLOAT32,
+static const id_vector_type float_ids = {pni::core::type_id_t::FLOAT16,
+                                         pni::core::type_id_t::BFLOAT16,
+                                         pni::core::type_id_t::FLOAT32,
                                          pni::core::type_id_t::FLOAT64,
                                          pni::core::type_id_t::FLOAT128};
 
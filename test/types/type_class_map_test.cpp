@@ -73,6 +73,8 @@ BOOST_AUTO_TEST_SUITE(type_class_map_test)
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_type_class_map_float)
     {
+        BOOST_CHECK(type_class_map<float16>::type_class == type_class_t::FLOAT);
+        BOOST_CHECK(type_class_map<bfloat16>::type_class == type_class_t::FLOAT);
         BOOST_CHECK(type_class_map<float32>::type_class == type_class_t::FLOAT);
         BOOST_CHECK(type_class_map<float64>::type_class == type_class_t::FLOAT);
         BOOST_CHECK(type_class_map<float128>::type_class == type_class_t::FLOAT);
@@ -91,6 +91,15 @@ BOOST_AUTO_TEST_SUITE(type_id_from_str_test)
         BOOST_CHECK_EQUAL(type_id_from_str("ui64"),type_id_t::UINT64);
     }
 
+    //,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,
+    BOOST_AUTO_TEST_CASE(test_float16_id_from_str)
+    {
+        BOOST_CHECK_EQUAL(type_id_from_str("float16"),type_id_t::FLOAT16);
+        BOOST_CHECK_EQUAL(type_id_from_str("f16"),type_id_t::FLOAT16);
+        BOOST_CHECK_EQUAL(type_id_from_str("bfloat16"),type_id_t::BFLOAT16);
+        BOOST_CHECK_EQUAL(type_id_from_str("bf16"),type_id_t::BFLOAT16);
+    }
+
     //,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,
     BOOST_AUTO_TEST_CASE(test_float32_id_from_str)
     {
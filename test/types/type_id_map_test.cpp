@@ -85,6 +85,13 @@ BOOST_AUTO_TEST_SUITE(type_id_map_test)
         BOOST_CHECK(type_id_map<int64>::type_id == type_id_t::INT64);
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_id_map_float16)
+    {
+        BOOST_CHECK(type_id_map<float16>::type_id == type_id_t::FLOAT16);
+        BOOST_CHECK(type_id_map<bfloat16>::type_id == type_id_t::BFLOAT16);
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_id_map_float32)
     {
@@ -40,6 +40,7 @@ typedef boost::mpl::list<uint8,int8,
                          uint16,int16,
                          uint32,int32,
                          uint64,int64,
+                         float16,bfloat16,
                          float32,float64,float128,
                          complex32,complex64,complex128,
                          string,bool_t> scalar_types;
@@ -63,6 +64,7 @@ typedef boost::mpl::list<darray<uint8>,darray<int8>,
                          darray<uint16>,darray<int16>,
                          darray<uint32>,darray<int32>,
                          darray<uint64>,darray<int64>,
+                         darray<float16>,darray<bfloat16>,
                          darray<float32>,darray<float64>,darray<float128>,
                          darray<complex32>,
                          darray<complex64>,
@@ -82,6 +82,34 @@ BOOST_AUTO_TEST_SUITE(type_info_test)
         BOOST_CHECK(pni::core::type_info<int64>::size==8);
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_type_info_float16)
+    {
+        typedef pni::core::type_info<float16> info_type;
+
+        BOOST_CHECK_EQUAL(float32(info_type::min()),-65504.f);
+        BOOST_CHECK_EQUAL(float32(info_type::max()),65504.f);
+        BOOST_CHECK(info_type::size==2);
+        BOOST_CHECK(!info_type::is_integer);
+        BOOST_CHECK(info_type::is_signed);
+        BOOST_CHECK(!info_type::is_complex);
+        BOOST_CHECK(info_type::is_negative(float16(-1.f)));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_type_info_bfloat16)
+    {
+        typedef pni::core::type_info<bfloat16> info_type;
+        typedef std::numeric_limits<float32> limits_type; 
+
+        BOOST_CHECK_CLOSE(float32(info_type::min()),-limits_type::max(),1.);
+        BOOST_CHECK_CLOSE(float32(info_type::max()),+limits_type::max(),1.);
+        BOOST_CHECK(info_type::size==2);
+        BOOST_CHECK(!info_type::is_integer);
+        BOOST_CHECK(info_type::is_signed);
+        BOOST_CHECK(!info_type::is_complex);
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE(test_type_info_float32)
     {
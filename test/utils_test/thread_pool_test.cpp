@@ -0,0 +1,147 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 18, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <pni/core/utilities/thread_pool.hpp>
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(thread_pool_test)
+
+    BOOST_AUTO_TEST_CASE(test_construction)
+    {
+        thread_pool pool(4);
+        BOOST_CHECK_EQUAL(pool.size(),4);
+
+        pool.resize(2);
+        BOOST_CHECK_EQUAL(pool.size(),2);
+
+        pool.resize(0);
+        BOOST_CHECK_EQUAL(pool.size(),1);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_run)
+    {
+        thread_pool pool(4);
+        std::vector<size_t> data(1000,0);
+
+        for(size_t n=0;n<10;++n)
+            pool.run(data.size(),[&data](size_t i){ data[i] += i; });
+
+        for(size_t i=0;i<data.size();++i)
+            BOOST_CHECK_EQUAL(data[i],10*i);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_nested_run)
+    {
+        thread_pool pool(3);
+        std::atomic<size_t> count(0);
+
+        pool.run(4,[&pool,&count](size_t)
+        {
+            pool.run(5,[&count](size_t){ ++count; });
+        });
+
+        BOOST_CHECK_EQUAL(count.load(),20);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_fixed_assignment)
+    {
+        thread_pool pool(4);
+        std::vector<std::thread::id> first(4),second(4);
+
+        //with one task per thread every task runs on the same thread
+        pool.run(4,[&first](size_t i){ first[i] = std::this_thread::get_id(); });
+        pool.run(4,[&second](size_t i){ second[i] = std::this_thread::get_id(); });
+
+        BOOST_CHECK(first[0] == std::this_thread::get_id());
+        for(size_t i=0;i<4;++i)
+        {
+            BOOST_CHECK(first[i] == second[i]);
+            for(size_t j=0;j<i;++j) BOOST_CHECK(first[i] != first[j]);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_exception)
+    {
+        thread_pool pool(4);
+        std::atomic<size_t> count(0);
+
+        BOOST_CHECK_THROW(pool.run(100,[&count](size_t i)
+                          {
+                              ++count;
+                              if(i==50) throw std::runtime_error("task failed");
+                          }),std::runtime_error);
+        BOOST_CHECK_EQUAL(count.load(),100);
+
+        //the pool must still be usable
+        pool.run(10,[&count](size_t){ ++count; });
+        BOOST_CHECK_EQUAL(count.load(),110);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_resize_run)
+    {
+        thread_pool pool(2);
+        std::vector<size_t> data(1000,0);
+
+        //threads started by resize() must only execute new jobs
+        pool.run(data.size(),[&data](size_t i){ data[i] += i; });
+        pool.resize(4);
+        pool.run(data.size(),[&data](size_t i){ data[i] += i; });
+        pool.resize(3);
+        pool.run(data.size(),[&data](size_t i){ data[i] += i; });
+
+        for(size_t i=0;i<data.size();++i)
+            BOOST_CHECK_EQUAL(data[i],3*i);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_threshold)
+    {
+        size_t orig = parallel_threshold();
+
+        set_parallel_threshold(100);
+        BOOST_CHECK_EQUAL(parallel_threshold(),100);
+
+        set_parallel_threshold(orig);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()